@@ -50,7 +50,7 @@ SensAmplTNLP::SensAmplTNLP(
    SmartPtr<AmplSuffixHandler> suff_handler = get_suffix_handler();
    ASL_pfgh* asl = AmplSolverObject();
 
-   const Index* parameter_flags = suff_handler->GetIntegerSuffixValues("parameter", AmplSuffixHandler::Variable_Source);
+   const int* parameter_flags = suff_handler->GetIntegerSuffixValues("parameter", AmplSuffixHandler::Variable_Source);
 
    if( parameter_flags_ != NULL )
    {
@@ -311,7 +311,7 @@ bool SensAmplTNLP::get_var_con_metadata(
    return retval;
 }
 
-const Index* SensAmplTNLP::get_index_suffix(
+const int* SensAmplTNLP::get_index_suffix(
    const char* suffix_name
 )
 {
@@ -319,7 +319,7 @@ const Index* SensAmplTNLP::get_index_suffix(
 
    SmartPtr<AmplSuffixHandler> suffix_handler = get_suffix_handler();
 
-   const Index* index_suffix = suffix_handler->GetIntegerSuffixValues(suffix_name, AmplSuffixHandler::Variable_Source);
+   const int* index_suffix = suffix_handler->GetIntegerSuffixValues(suffix_name, AmplSuffixHandler::Variable_Source);
 
    return index_suffix;
 }
@@ -386,7 +386,7 @@ std::vector<Number> SensAmplTNLP::get_number_suffix_vec(
    return number_suffix;
 }
 
-const Index* SensAmplTNLP::get_index_suffix_constr(
+const int* SensAmplTNLP::get_index_suffix_constr(
    const char* suffix_name
 )
 {
@@ -394,7 +394,7 @@ const Index* SensAmplTNLP::get_index_suffix_constr(
 
    SmartPtr<AmplSuffixHandler> suffix_handler = get_suffix_handler();
 
-   const Index* index_suffix = suffix_handler->GetIntegerSuffixValues(suffix_name,
+   const int* index_suffix = suffix_handler->GetIntegerSuffixValues(suffix_name,
                                AmplSuffixHandler::Constraint_Source);
 
    if( index_suffix == NULL )
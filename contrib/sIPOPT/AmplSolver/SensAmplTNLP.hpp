@@ -99,7 +99,7 @@ public:
       IpoptCalculatedQuantities* ip_cq
    );
 
-   const Index* get_index_suffix(
+   const int* get_index_suffix(
       const char* suffix_name
    );
 
@@ -115,7 +115,7 @@ public:
       const char* suffix_name
    );
 
-   const Index* get_index_suffix_constr(
+   const int* get_index_suffix_constr(
       const char* suffix_name
    );
 
@@ -184,7 +184,7 @@ void IndexPCalculator::PrintImpl(
    DBG_START_METH("IndexPCalculator::PrintImpl", dbg_verbosity);
 
    const Number* col_val;
-   jnlst.PrintfIndented(level, category, indent, "%sIndexPCalculator \"%s\" with %d rows and %d columns:\n",
+   jnlst.PrintfIndented(level, category, indent, "%sIndexPCalculator \"%s\" with %" IPOPT_INDEX_FORMAT " rows and %" IPOPT_INDEX_FORMAT " columns:\n",
                         prefix.c_str(), name.c_str(), nrows_, ncols_);
    Index col_counter = 0;
    for( std::map<Index, SmartPtr<PColumn> >::const_iterator j = cols_.begin(); j != cols_.end(); ++j )
@@ -192,7 +192,7 @@ void IndexPCalculator::PrintImpl(
       col_val = j->second->Values();
       for( Index i = 0; i < nrows_; ++i )
       {
-         jnlst.PrintfIndented(level, category, indent, "%s%s[%5d,%5d]=%23.16e\n", prefix.c_str(), name.c_str(), i,
+         jnlst.PrintfIndented(level, category, indent, "%s%s[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "]=%23.16e\n", prefix.c_str(), name.c_str(), i,
                               col_counter, col_val[i]);
       }
       col_counter++;
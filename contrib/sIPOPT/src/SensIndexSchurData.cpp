@@ -335,13 +335,13 @@ void IndexSchurData::PrintImpl(
 {
    DBG_START_METH("IndexSchurData::PrintImpl", dbg_verbosity);
 
-   jnlst.PrintfIndented(level, category, indent, "%sIndexSchurData \"%s\" with %d rows:\n", prefix.c_str(),
+   jnlst.PrintfIndented(level, category, indent, "%sIndexSchurData \"%s\" with %" IPOPT_INDEX_FORMAT " rows:\n", prefix.c_str(),
                         name.c_str(), GetNRowsAdded());
    if( Is_Initialized() )
    {
       for( unsigned int i = 0; i < idx_.size(); i++ )
       {
-         jnlst.PrintfIndented(level, category, indent, "%s%s[%5d,%5d]=%d\n", prefix.c_str(), name.c_str(), i, idx_[i],
+         jnlst.PrintfIndented(level, category, indent, "%s%s[%5d,%5" IPOPT_INDEX_FORMAT "]=%" IPOPT_INDEX_FORMAT "\n", prefix.c_str(), name.c_str(), i, idx_[i],
                               val_[i]);
       }
    }
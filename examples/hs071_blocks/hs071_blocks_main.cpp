@@ -0,0 +1,146 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#include "IpIpoptApplication.hpp"
+#include "IpSolveStatistics.hpp"
+#include "hs071_blocks_nlp.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace Ipopt;
+
+int main(
+   int    /*argv*/,
+   char** /*argc*/
+)
+{
+   // Receives the warnings of the derivative checker, see below; declared
+   // first, so that it outlives the journal that writes to it
+   std::ostringstream nlp_warnings;
+
+   SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+
+   app->Options()->SetNumericValue("tol", 1e-7);
+   app->Options()->SetStringValue("mu_strategy", "adaptive");
+   // Evaluate the derivative blocks, the perturbed points of the
+   // derivative checker and of the finite differences, and the
+   // problems of a batch on two threads (if Ipopt has been compiled
+   // with OpenMP support)
+   app->Options()->SetIntegerValue("num_threads", 2);
+
+   ApplicationReturnStatus status;
+   status = app->Initialize();
+   if( status != Solve_Succeeded )
+   {
+      std::cout << std::endl << std::endl << "*** Error during initialization!" << std::endl;
+      return (int) status;
+   }
+
+   // Collect the warnings of the derivative checker to see whether it
+   // detected errors
+   SmartPtr<StreamJournal> nlp_journal = new StreamJournal("NLPWarnings", J_NONE);
+   nlp_journal->SetOutputStream(&nlp_warnings);
+   nlp_journal->SetPrintLevel(J_NLP, J_WARNING);
+   app->Jnlst()->AddJournal(GetRawPtr(nlp_journal));
+
+   // Check the derivatives that are evaluated by blocks and solve
+   // the problem with them
+   app->Options()->SetStringValue("derivative_test", "second-order");
+   SmartPtr<HS071_Blocks_NLP> mynlp = new HS071_Blocks_NLP();
+   status = app->OptimizeTNLP(GetRawPtr(mynlp));
+   if( status != Solve_Succeeded )
+   {
+      std::cout << std::endl << std::endl << "*** The problem FAILED!" << std::endl;
+      return (int) status;
+   }
+   const Index iter_count = app->Statistics()->IterationCount();
+   const Number final_obj = mynlp->final_obj();
+
+   // Check the derivatives again with the derivative checker that perturbs
+   // groups of variables at once, and with the one that checks a sample of
+   // the variables and constraints and a random direction
+   const char* test_modes[] = { "colored", "sampled" };
+   app->Options()->SetIntegerValue("derivative_test_sample_size", 2);
+   for( int i = 0; i < 2; i++ )
+   {
+      app->Options()->SetStringValue("derivative_test_mode", test_modes[i]);
+      status = app->OptimizeTNLP(GetRawPtr(mynlp));
+      if( status != Solve_Succeeded )
+      {
+         std::cout << std::endl << std::endl << "*** The problem FAILED!" << std::endl;
+         return (int) status;
+      }
+   }
+   if( nlp_warnings.str().find("Derivative checker detected") != std::string::npos )
+   {
+      std::cout << std::endl << std::endl << "*** The derivative checker detected errors!" << std::endl;
+      return (int) Internal_Error;
+   }
+
+   // Evaluate the functions at several trial points of the backtracking
+   // line search at once, which must not change the iterates
+   app->Options()->SetStringValue("derivative_test", "none");
+   app->Options()->SetIntegerValue("parallel_trial_points", 4);
+   status = app->OptimizeTNLP(GetRawPtr(mynlp));
+   if( status != Solve_Succeeded )
+   {
+      std::cout << std::endl << std::endl << "*** The problem FAILED!" << std::endl;
+      return (int) status;
+   }
+   if( app->Statistics()->IterationCount() != iter_count || std::fabs(mynlp->final_obj() - final_obj) > 1e-10 )
+   {
+      std::cout << std::endl << std::endl << "*** The iterates changed with parallel trial points!" << std::endl;
+      return (int) Internal_Error;
+   }
+   app->Options()->SetIntegerValue("parallel_trial_points", 1);
+
+   // Approximate the Hessian by finite differences of the Jacobian
+   // blocks
+   app->Options()->SetStringValue("hessian_approximation", "finite-difference-values");
+   status = app->OptimizeTNLP(GetRawPtr(mynlp));
+   if( status != Solve_Succeeded )
+   {
+      std::cout << std::endl << std::endl << "*** The problem FAILED!" << std::endl;
+      return (int) status;
+   }
+   app->Options()->SetStringValue("hessian_approximation", "exact");
+
+   // Solve several instances of the problem at once
+   const Index nbatch = 4;
+   std::vector<SmartPtr<TNLP> > tnlps;
+   for( Index i = 0; i < nbatch; i++ )
+   {
+      tnlps.push_back(new HS071_Blocks_NLP());
+   }
+   std::vector<ApplicationReturnStatus> batch_status;
+   std::vector<SmartPtr<SolveStatistics> > batch_statistics;
+   app->OptimizeTNLPBatch(tnlps, batch_status, batch_statistics);
+   for( Index i = 0; i < nbatch; i++ )
+   {
+      const Number obj = static_cast<HS071_Blocks_NLP*>(GetRawPtr(tnlps[i]))->final_obj();
+      std::cout << "Batch problem " << i << ": status " << batch_status[i] << ", f(x*) = " << obj << std::endl;
+      if( batch_status[i] != Solve_Succeeded )
+      {
+         status = batch_status[i];
+      }
+      else if( std::fabs(obj - final_obj) > 1e-6 )
+      {
+         status = Internal_Error;
+      }
+   }
+
+   if( status == Solve_Succeeded )
+   {
+      std::cout << std::endl << std::endl << "*** The problems solved!" << std::endl;
+   }
+   else
+   {
+      std::cout << std::endl << std::endl << "*** A problem of the batch FAILED!" << std::endl;
+   }
+
+   return (int) status;
+}
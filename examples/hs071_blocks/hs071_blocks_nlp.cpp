@@ -0,0 +1,390 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#include "hs071_blocks_nlp.hpp"
+
+#include <cassert>
+
+using namespace Ipopt;
+
+#ifdef __GNUC__
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+
+// constructor
+HS071_Blocks_NLP::HS071_Blocks_NLP()
+   : final_obj_(0.)
+{ }
+
+// destructor
+HS071_Blocks_NLP::~HS071_Blocks_NLP()
+{ }
+
+// returns the size of the problem
+bool HS071_Blocks_NLP::get_nlp_info(
+   Index&          n,
+   Index&          m,
+   Index&          nnz_jac_g,
+   Index&          nnz_h_lag,
+   IndexStyleEnum& index_style
+)
+{
+   n = 4;
+   m = 2;
+
+   // the Jacobian and the lower left triangle of the Hessian are dense
+   nnz_jac_g = 8;
+   nnz_h_lag = 10;
+
+   index_style = TNLP::C_STYLE;
+
+   return true;
+}
+
+// returns the variable bounds
+bool HS071_Blocks_NLP::get_bounds_info(
+   Index   n,
+   Number* x_l,
+   Number* x_u,
+   Index   m,
+   Number* g_l,
+   Number* g_u
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   for( Index i = 0; i < 4; i++ )
+   {
+      x_l[i] = 1.0;
+      x_u[i] = 5.0;
+   }
+
+   g_l[0] = 25;
+   g_u[0] = 2e19;
+
+   g_l[1] = g_u[1] = 40.0;
+
+   return true;
+}
+
+// returns the initial point for the problem
+bool HS071_Blocks_NLP::get_starting_point(
+   Index   n,
+   bool    init_x,
+   Number* x,
+   bool    init_z,
+   Number* z_L,
+   Number* z_U,
+   Index   m,
+   bool    init_lambda,
+   Number* lambda
+)
+{
+   assert(init_x == true);
+   assert(init_z == false);
+   assert(init_lambda == false);
+
+   x[0] = 1.0;
+   x[1] = 5.0;
+   x[2] = 5.0;
+   x[3] = 1.0;
+
+   return true;
+}
+
+// returns the value of the objective function
+bool HS071_Blocks_NLP::eval_f(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Number&       obj_value
+)
+{
+   assert(n == 4);
+
+   obj_value = x[0] * x[3] * (x[0] + x[1] + x[2]) + x[2];
+
+   return true;
+}
+
+// return the gradient of the objective function grad_{x} f(x)
+bool HS071_Blocks_NLP::eval_grad_f(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Number*       grad_f
+)
+{
+   assert(n == 4);
+
+   grad_f[0] = x[0] * x[3] + x[3] * (x[0] + x[1] + x[2]);
+   grad_f[1] = x[0] * x[3];
+   grad_f[2] = x[0] * x[3] + 1;
+   grad_f[3] = x[0] * (x[0] + x[1] + x[2]);
+
+   return true;
+}
+
+// return the value of the constraints: g(x)
+bool HS071_Blocks_NLP::eval_g(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Index         m,
+   Number*       g
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   g[0] = x[0] * x[1] * x[2] * x[3];
+   g[1] = x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3];
+
+   return true;
+}
+
+// return the structure or values of the Jacobian
+bool HS071_Blocks_NLP::eval_jac_g(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Index         m,
+   Index         nele_jac,
+   Index*        iRow,
+   Index*        jCol,
+   Number*       values
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   if( values == NULL )
+   {
+      // the entries are ordered by constraints, and hence by blocks
+      for( Index i = 0; i < 8; i++ )
+      {
+         iRow[i] = i / 4;
+         jCol[i] = i % 4;
+      }
+   }
+   else
+   {
+      eval_jac_g_block(0, n, x, new_x, m, 4, values);
+      eval_jac_g_block(1, n, x, new_x, m, 4, values + 4);
+   }
+
+   return true;
+}
+
+// return the structure or values of the Hessian
+bool HS071_Blocks_NLP::eval_h(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Number        obj_factor,
+   Index         m,
+   const Number* lambda,
+   bool          new_lambda,
+   Index         nele_hess,
+   Index*        iRow,
+   Index*        jCol,
+   Number*       values
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   if( values == NULL )
+   {
+      // the lower left triangle, row by row
+      Index idx = 0;
+      for( Index row = 0; row < 4; row++ )
+      {
+         for( Index col = 0; col <= row; col++ )
+         {
+            iRow[idx] = row;
+            jCol[idx] = col;
+            idx++;
+         }
+      }
+
+      assert(idx == nele_hess);
+   }
+   else
+   {
+      eval_h_block(0, n, x, new_x, obj_factor, m, lambda, new_lambda, 6, values);
+      eval_h_block(1, n, x, new_x, obj_factor, m, lambda, new_lambda, 4, values + 6);
+   }
+
+   return true;
+}
+
+// return the function values and first derivatives at once
+bool HS071_Blocks_NLP::eval_all(
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Number*       obj_value,
+   Number*       grad_f,
+   Index         m,
+   Number*       g,
+   Index         nele_jac,
+   Number*       jac_values
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   // products that are shared between the requested quantities
+   const Number sum123 = x[0] + x[1] + x[2];
+   const Number x14 = x[0] * x[3];
+   const Number x23 = x[1] * x[2];
+
+   if( obj_value != NULL )
+   {
+      *obj_value = x14 * sum123 + x[2];
+   }
+   if( grad_f != NULL )
+   {
+      grad_f[0] = x14 + x[3] * sum123;
+      grad_f[1] = x14;
+      grad_f[2] = x14 + 1;
+      grad_f[3] = x[0] * sum123;
+   }
+   if( g != NULL )
+   {
+      g[0] = x14 * x23;
+      g[1] = x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3];
+   }
+   if( jac_values != NULL )
+   {
+      jac_values[0] = x23 * x[3];
+      jac_values[1] = x14 * x[2];
+      jac_values[2] = x14 * x[1];
+      jac_values[3] = x[0] * x23;
+      jac_values[4] = 2 * x[0];
+      jac_values[5] = 2 * x[1];
+      jac_values[6] = 2 * x[2];
+      jac_values[7] = 2 * x[3];
+   }
+
+   return true;
+}
+
+// the constraints 0 and 1 form blocks 0 and 1; the Hessian entries of
+// rows 0 to 2 belong to block 0 and those of row 3 to block 1
+bool HS071_Blocks_NLP::get_derivative_blocks(
+   Index  num_blocks,
+   Index  m,
+   Index  nele_hess,
+   Index* con_block_start,
+   Index* hess_block_start
+)
+{
+   assert(num_blocks == 2);
+   assert(m == 2);
+   assert(nele_hess == 10);
+
+   con_block_start[0] = 0;
+   con_block_start[1] = 1;
+   con_block_start[2] = 2;
+
+   hess_block_start[0] = 0;
+   hess_block_start[1] = 6;
+   hess_block_start[2] = 10;
+
+   return true;
+}
+
+// return the Jacobian entries of one constraint
+bool HS071_Blocks_NLP::eval_jac_g_block(
+   Index         block,
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Index         m,
+   Index         nele_jac_block,
+   Number*       values
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+   assert(nele_jac_block == 4);
+
+   if( block == 0 )
+   {
+      values[0] = x[1] * x[2] * x[3]; // 0,0
+      values[1] = x[0] * x[2] * x[3]; // 0,1
+      values[2] = x[0] * x[1] * x[3]; // 0,2
+      values[3] = x[0] * x[1] * x[2]; // 0,3
+   }
+   else
+   {
+      values[0] = 2 * x[0]; // 1,0
+      values[1] = 2 * x[1]; // 1,1
+      values[2] = 2 * x[2]; // 1,2
+      values[3] = 2 * x[3]; // 1,3
+   }
+
+   return true;
+}
+
+// return the Hessian entries of the Lagrangian in the rows of one block
+bool HS071_Blocks_NLP::eval_h_block(
+   Index         block,
+   Index         n,
+   const Number* x,
+   bool          new_x,
+   Number        obj_factor,
+   Index         m,
+   const Number* lambda,
+   bool          new_lambda,
+   Index         nele_hess_block,
+   Number*       values
+)
+{
+   assert(n == 4);
+   assert(m == 2);
+
+   if( block == 0 )
+   {
+      assert(nele_hess_block == 6);
+      values[0] = obj_factor * (2 * x[3]) + lambda[1] * 2;       // 0,0
+      values[1] = obj_factor * (x[3]) + lambda[0] * (x[2] * x[3]); // 1,0
+      values[2] = lambda[1] * 2;                                   // 1,1
+      values[3] = obj_factor * (x[3]) + lambda[0] * (x[1] * x[3]); // 2,0
+      values[4] = lambda[0] * (x[0] * x[3]);                       // 2,1
+      values[5] = lambda[1] * 2;                                   // 2,2
+   }
+   else
+   {
+      assert(nele_hess_block == 4);
+      values[0] = obj_factor * (2 * x[0] + x[1] + x[2]) + lambda[0] * (x[1] * x[2]); // 3,0
+      values[1] = obj_factor * (x[0]) + lambda[0] * (x[0] * x[2]);                   // 3,1
+      values[2] = obj_factor * (x[0]) + lambda[0] * (x[0] * x[1]);                   // 3,2
+      values[3] = lambda[1] * 2;                                                     // 3,3
+   }
+
+   return true;
+}
+
+// store the objective value; the solves of a batch run concurrently,
+// so nothing is printed here
+void HS071_Blocks_NLP::finalize_solution(
+   SolverReturn               status,
+   Index                      n,
+   const Number*              x,
+   const Number*              z_L,
+   const Number*              z_U,
+   Index                      m,
+   const Number*              g,
+   const Number*              lambda,
+   Number                     obj_value,
+   const IpoptData*           ip_data,
+   IpoptCalculatedQuantities* ip_cq
+)
+{
+   final_obj_ = obj_value;
+}
@@ -0,0 +1,251 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#ifndef __HS071_BLOCKS_NLP_HPP__
+#define __HS071_BLOCKS_NLP_HPP__
+
+#include "IpTNLP.hpp"
+
+using namespace Ipopt;
+
+/** C++ Example NLP for the parallel evaluation of derivatives.
+ *
+ *  HS071_Blocks_NLP implements problem 71 of the Hock-Schittkowski
+ *  test suite, see also the hs071_cpp example.  In addition to the
+ *  methods of HS071_NLP, it
+ *  - declares its evaluation methods as reentrant, so that Ipopt can
+ *    evaluate several perturbed points at once for finite differences
+ *    and in the derivative checker,
+ *  - evaluates the objective, the constraints, and their first
+ *    derivatives at once in eval_all, and
+ *  - splits the derivatives into two blocks, one per constraint, which
+ *    Ipopt evaluates concurrently by eval_jac_g_block and eval_h_block.
+ *
+ *  The evaluation methods do not change any member of this class, so
+ *  they can be called from several threads at the same time.
+ *
+ * Problem hs071 looks like this
+ *
+ *     min   x1*x4*(x1 + x2 + x3)  +  x3
+ *     s.t.  x1*x2*x3*x4                   >=  25
+ *           x1**2 + x2**2 + x3**2 + x4**2  =  40
+ *           1 <=  x1,x2,x3,x4  <= 5
+ *
+ *     Starting point:
+ *        x = (1, 5, 5, 1)
+ *
+ *     Optimal solution:
+ *        x = (1.00000000, 4.74299963, 3.82114998, 1.37940829)
+ */
+class HS071_Blocks_NLP: public TNLP
+{
+public:
+   /** Default constructor */
+   HS071_Blocks_NLP();
+
+   /** Default destructor */
+   virtual ~HS071_Blocks_NLP();
+
+   /** Objective value of the last solve */
+   Number final_obj() const
+   {
+      return final_obj_;
+   }
+
+   /**@name Overloaded from TNLP */
+   //@{
+   /** Method to return some info about the NLP */
+   virtual bool get_nlp_info(
+      Index&          n,
+      Index&          m,
+      Index&          nnz_jac_g,
+      Index&          nnz_h_lag,
+      IndexStyleEnum& index_style
+   );
+
+   /** Method to return the bounds for my problem */
+   virtual bool get_bounds_info(
+      Index   n,
+      Number* x_l,
+      Number* x_u,
+      Index   m,
+      Number* g_l,
+      Number* g_u
+   );
+
+   /** Method to return the starting point for the algorithm */
+   virtual bool get_starting_point(
+      Index   n,
+      bool    init_x,
+      Number* x,
+      bool    init_z,
+      Number* z_L,
+      Number* z_U,
+      Index   m,
+      bool    init_lambda,
+      Number* lambda
+   );
+
+   /** Method to return the objective value */
+   virtual bool eval_f(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number&       obj_value
+   );
+
+   /** Method to return the gradient of the objective */
+   virtual bool eval_grad_f(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number*       grad_f
+   );
+
+   /** Method to return the constraint residuals */
+   virtual bool eval_g(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Index         m,
+      Number*       g
+   );
+
+   /** Method to return:
+    *   1) The structure of the Jacobian (if "values" is NULL)
+    *   2) The values of the Jacobian (if "values" is not NULL)
+    */
+   virtual bool eval_jac_g(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Index         m,
+      Index         nele_jac,
+      Index*        iRow,
+      Index*        jCol,
+      Number*       values
+   );
+
+   /** Method to return:
+    *   1) The structure of the Hessian of the Lagrangian (if "values" is NULL)
+    *   2) The values of the Hessian of the Lagrangian (if "values" is not NULL)
+    */
+   virtual bool eval_h(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number        obj_factor,
+      Index         m,
+      const Number* lambda,
+      bool          new_lambda,
+      Index         nele_hess,
+      Index*        iRow,
+      Index*        jCol,
+      Number*       values
+   );
+
+   /** Method to return the function values and first derivatives at once */
+   virtual bool eval_all(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number*       obj_value,
+      Number*       grad_f,
+      Index         m,
+      Number*       g,
+      Index         nele_jac,
+      Number*       jac_values
+   );
+
+   /** This method is called when the algorithm is complete so the TNLP can store/write the solution */
+   virtual void finalize_solution(
+      SolverReturn               status,
+      Index                      n,
+      const Number*              x,
+      const Number*              z_L,
+      const Number*              z_U,
+      Index                      m,
+      const Number*              g,
+      const Number*              lambda,
+      Number                     obj_value,
+      const IpoptData*           ip_data,
+      IpoptCalculatedQuantities* ip_cq
+   );
+   //@}
+
+   /**@name Methods for the parallel evaluation, overloaded from TNLP */
+   //@{
+   /** The evaluation methods do not modify this object */
+   virtual bool is_reentrant()
+   {
+      return true;
+   }
+
+   /** One block for each constraint */
+   virtual Index get_number_of_derivative_blocks()
+   {
+      return 2;
+   }
+
+   /** Method to return the partition of the constraints and the Hessian entries */
+   virtual bool get_derivative_blocks(
+      Index  num_blocks,
+      Index  m,
+      Index  nele_hess,
+      Index* con_block_start,
+      Index* hess_block_start
+   );
+
+   /** Method to return the values of the Jacobian entries of one block */
+   virtual bool eval_jac_g_block(
+      Index         block,
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Index         m,
+      Index         nele_jac_block,
+      Number*       values
+   );
+
+   /** Method to return the values of the Hessian entries of one block */
+   virtual bool eval_h_block(
+      Index         block,
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number        obj_factor,
+      Index         m,
+      const Number* lambda,
+      bool          new_lambda,
+      Index         nele_hess_block,
+      Number*       values
+   );
+   //@}
+
+private:
+   /** Objective value at the solution of the last solve */
+   Number final_obj_;
+
+   /**@name Methods to block default compiler methods.
+    *
+    * The compiler automatically generates the following three methods.
+    *  Since the default compiler implementation is generally not what
+    *  you want (for all but the most simple classes), we usually
+    *  put the declarations of these methods in the private section
+    *  and never implement them. This prevents the compiler from
+    *  implementing an incorrect "default" behavior without us
+    *  knowing. (See Scott Meyers book, "Effective C++")
+    */
+   //@{
+   HS071_Blocks_NLP(
+      const HS071_Blocks_NLP&
+   );
+
+   HS071_Blocks_NLP& operator=(
+      const HS071_Blocks_NLP&
+   );
+   //@}
+};
+
+#endif
@@ -185,22 +185,22 @@ int main()
       printf("\n\nSolution of the primal variables, x\n");
       for( i = 0; i < n; i++ )
       {
-         printf("x[%d] = %e\n", i, x[i]);
+         printf("x[%" IPOPT_INDEX_FORMAT "] = %e\n", i, x[i]);
       }
 
       printf("\n\nSolution of the constraint multipliers, lambda\n");
       for( i = 0; i < m; i++ )
       {
-         printf("lambda[%d] = %e\n", i, mult_g[i]);
+         printf("lambda[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_g[i]);
       }
       printf("\n\nSolution of the bound multipliers, z_L and z_U\n");
       for( i = 0; i < n; i++ )
       {
-         printf("z_L[%d] = %e\n", i, mult_x_L[i]);
+         printf("z_L[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_x_L[i]);
       }
       for( i = 0; i < n; i++ )
       {
-         printf("z_U[%d] = %e\n", i, mult_x_U[i]);
+         printf("z_U[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_x_U[i]);
       }
 
       printf("\n\nObjective value\nf(x*) = %e\n", obj);
@@ -233,22 +233,22 @@ int main()
          printf("\n\nSolution of the primal variables, x\n");
          for( i = 0; i < n; i++ )
          {
-            printf("x[%d] = %e\n", i, x[i]);
+            printf("x[%" IPOPT_INDEX_FORMAT "] = %e\n", i, x[i]);
          }
 
          printf("\n\nSolution of the constraint multipliers, lambda\n");
          for( i = 0; i < m; i++ )
          {
-            printf("lambda[%d] = %e\n", i, mult_g[i]);
+            printf("lambda[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_g[i]);
          }
          printf("\n\nSolution of the bound multipliers, z_L and z_U\n");
          for( i = 0; i < n; i++ )
          {
-            printf("z_L[%d] = %e\n", i, mult_x_L[i]);
+            printf("z_L[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_x_L[i]);
          }
          for( i = 0; i < n; i++ )
          {
-            printf("z_U[%d] = %e\n", i, mult_x_U[i]);
+            printf("z_U[%" IPOPT_INDEX_FORMAT "] = %e\n", i, mult_x_U[i]);
          }
 
          printf("\n\nObjective value\nf(x*) = %e\n", obj);
@@ -497,7 +497,7 @@ Bool intermediate_cb(
    UserDataPtr user_data
 )
 {
-   printf("Testing intermediate callback in iteration %d\n", iter_count);
+   printf("Testing intermediate callback in iteration %" IPOPT_INDEX_FORMAT "\n", iter_count);
    if( inf_pr < 1e-4 )
    {
       return FALSE;
@@ -0,0 +1,360 @@
+/* Copyright (C) 2020 COIN-OR Foundation
+ * All Rights Reserved.
+ * This code is published under the Eclipse Public License.
+ *
+ * This example solves problem 71 of the Hock-Schittkowski test suite (see
+ * also examples/hs071_c) with a MUMPS that runs on all processes of
+ * MPI_COMM_WORLD, e.g., when started by
+ *
+ *    mpirun -np 4 ./hs071_mpi
+ *
+ * The process with rank 0 runs Ipopt, all others only take part in the
+ * calls of MUMPS.  This requires Ipopt to be built with a parallel MUMPS.
+ */
+
+#include "IpStdCInterface.h"
+#include <mpi.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdio.h>
+
+/* Function Declarations */
+static Bool eval_f(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number*     obj_value,
+   UserDataPtr user_data
+);
+
+static Bool eval_grad_f(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number*     grad_f,
+   UserDataPtr user_data
+);
+
+static Bool eval_g(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Index       m,
+   Number*     g,
+   UserDataPtr user_data
+);
+
+static Bool eval_jac_g(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Index       m,
+   Index       nele_jac,
+   Index*      iRow,
+   Index*      jCol,
+   Number*     values,
+   UserDataPtr user_data
+);
+
+static Bool eval_h(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number      obj_factor,
+   Index       m,
+   Number*     lambda,
+   Bool        new_lambda,
+   Index       nele_hess,
+   Index*      iRow,
+   Index*      jCol,
+   Number*     values,
+   UserDataPtr user_data
+);
+
+/** Run Ipopt on the process with rank 0 of the communicator. */
+static enum ApplicationReturnStatus solve_on_host(
+   Int comm_fortran
+)
+{
+   Index n = 4;                         /* number of variables */
+   Index m = 2;                         /* number of constraints */
+   Number x_L[4] = { 1., 1., 1., 1. };  /* lower bounds on x */
+   Number x_U[4] = { 5., 5., 5., 5. };  /* upper bounds on x */
+   Number g_L[2] = { 25., 40. };        /* lower bounds on g */
+   Number g_U[2] = { 2e19, 40. };       /* upper bounds on g */
+   Number x[4] = { 1., 5., 5., 1. };    /* starting point and solution vector */
+   IpoptProblem nlp = NULL;             /* IpoptProblem */
+   enum ApplicationReturnStatus status; /* Solve return code */
+   Number obj;                          /* objective value */
+   Index i;                             /* generic counter */
+
+   /* create the IpoptProblem, with 8 nonzeros in the Jacobian and 10 in the
+    * lower triangle of the Hessian, and C-style indexing */
+   nlp = CreateIpoptProblem(n, x_L, x_U, m, g_L, g_U, 8, 10, 0,
+                            &eval_f, &eval_g, &eval_grad_f,
+                            &eval_jac_g, &eval_h);
+
+   /* let MUMPS run on all processes of the communicator */
+   AddIpoptStrOption(nlp, "linear_solver", "mumps");
+   AddIpoptIntOption(nlp, "mumps_mpi_comm", comm_fortran);
+   AddIpoptNumOption(nlp, "tol", 1e-7);
+   AddIpoptStrOption(nlp, "mu_strategy", "adaptive");
+
+   status = IpoptSolve(nlp, x, NULL, &obj, NULL, NULL, NULL, NULL);
+
+   if( status == Solve_Succeeded )
+   {
+      printf("\n\nSolution of the primal variables, x\n");
+      for( i = 0; i < n; i++ )
+      {
+         printf("x[%" IPOPT_INDEX_FORMAT "] = %e\n", i, x[i]);
+      }
+      printf("\n\nObjective value\nf(x*) = %e\n", obj);
+   }
+   else
+   {
+      printf("\n\nERROR OCCURRED DURING IPOPT OPTIMIZATION.\n");
+   }
+
+   /* the MUMPS instances of the problem are freed here */
+   FreeIpoptProblem(nlp);
+
+   return status;
+}
+
+/** Main Program */
+/* [MAIN] */
+int main(
+   int   argc,
+   char* argv[]
+)
+{
+   int rank;
+   Int comm_fortran;
+   int retval = EXIT_SUCCESS;
+
+   MPI_Init(&argc, &argv);
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+   comm_fortran = (Int) MPI_Comm_c2f(MPI_COMM_WORLD);
+
+   if( rank == 0 )
+   {
+      if( solve_on_host(comm_fortran) != Solve_Succeeded )
+      {
+         retval = EXIT_FAILURE;
+      }
+
+      /* let the other processes leave RunIpoptMumpsService */
+      if( !StopIpoptMumpsService(comm_fortran) )
+      {
+         printf("Ipopt has not been built with a parallel MUMPS.\n");
+         retval = EXIT_FAILURE;
+      }
+   }
+   else
+   {
+      /* take part in all calls of MUMPS on the process with rank 0,
+       * until it calls StopIpoptMumpsService */
+      if( !RunIpoptMumpsService(comm_fortran) )
+      {
+         retval = EXIT_FAILURE;
+      }
+   }
+
+   MPI_Finalize();
+
+   return retval;
+}
+/* [MAIN] */
+
+/* Function Implementations */
+static Bool eval_f(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number*     obj_value,
+   UserDataPtr user_data
+)
+{
+   assert(n == 4);
+   (void) n;
+
+   (void) new_x;
+   (void) user_data;
+
+   *obj_value = x[0] * x[3] * (x[0] + x[1] + x[2]) + x[2];
+
+   return TRUE;
+}
+
+static Bool eval_grad_f(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number*     grad_f,
+   UserDataPtr user_data
+)
+{
+   assert(n == 4);
+   (void) n;
+
+   (void) new_x;
+   (void) user_data;
+
+   grad_f[0] = x[0] * x[3] + x[3] * (x[0] + x[1] + x[2]);
+   grad_f[1] = x[0] * x[3];
+   grad_f[2] = x[0] * x[3] + 1;
+   grad_f[3] = x[0] * (x[0] + x[1] + x[2]);
+
+   return TRUE;
+}
+
+static Bool eval_g(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Index       m,
+   Number*     g,
+   UserDataPtr user_data
+)
+{
+   assert(n == 4);
+   (void) n;
+   assert(m == 2);
+   (void) m;
+
+   (void) new_x;
+   (void) user_data;
+
+   g[0] = x[0] * x[1] * x[2] * x[3];
+   g[1] = x[0] * x[0] + x[1] * x[1] + x[2] * x[2] + x[3] * x[3];
+
+   return TRUE;
+}
+
+static Bool eval_jac_g(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Index       m,
+   Index       nele_jac,
+   Index*      iRow,
+   Index*      jCol,
+   Number*     values,
+   UserDataPtr user_data
+)
+{
+   Index i;
+
+   (void) n;
+   (void) new_x;
+   (void) m;
+   (void) nele_jac;
+   (void) user_data;
+
+   if( values == NULL )
+   {
+      /* this particular jacobian is dense */
+      for( i = 0; i < 8; i++ )
+      {
+         iRow[i] = i / 4;
+         jCol[i] = i % 4;
+      }
+   }
+   else
+   {
+      values[0] = x[1] * x[2] * x[3]; /* 0,0 */
+      values[1] = x[0] * x[2] * x[3]; /* 0,1 */
+      values[2] = x[0] * x[1] * x[3]; /* 0,2 */
+      values[3] = x[0] * x[1] * x[2]; /* 0,3 */
+
+      values[4] = 2 * x[0]; /* 1,0 */
+      values[5] = 2 * x[1]; /* 1,1 */
+      values[6] = 2 * x[2]; /* 1,2 */
+      values[7] = 2 * x[3]; /* 1,3 */
+   }
+
+   return TRUE;
+}
+
+static Bool eval_h(
+   Index       n,
+   Number*     x,
+   Bool        new_x,
+   Number      obj_factor,
+   Index       m,
+   Number*     lambda,
+   Bool        new_lambda,
+   Index       nele_hess,
+   Index*      iRow,
+   Index*      jCol,
+   Number*     values,
+   UserDataPtr user_data
+)
+{
+   Index idx = 0; /* nonzero element counter */
+   Index row = 0; /* row counter for loop */
+   Index col = 0; /* col counter for loop */
+
+   (void) n;
+   (void) new_x;
+   (void) m;
+   (void) new_lambda;
+   (void) user_data;
+
+   if( values == NULL )
+   {
+      /* the hessian for this problem is actually dense, fill the lower left
+       * triangle only */
+      for( row = 0; row < 4; row++ )
+      {
+         for( col = 0; col <= row; col++ )
+         {
+            iRow[idx] = row;
+            jCol[idx] = col;
+            idx++;
+         }
+      }
+
+      assert(idx == nele_hess);
+      (void) nele_hess;
+   }
+   else
+   {
+      /* fill the objective portion */
+      values[0] = obj_factor * (2 * x[3]); /* 0,0 */
+
+      values[1] = obj_factor * (x[3]); /* 1,0 */
+      values[2] = 0; /* 1,1 */
+
+      values[3] = obj_factor * (x[3]); /* 2,0 */
+      values[4] = 0; /* 2,1 */
+      values[5] = 0; /* 2,2 */
+
+      values[6] = obj_factor * (2 * x[0] + x[1] + x[2]); /* 3,0 */
+      values[7] = obj_factor * (x[0]); /* 3,1 */
+      values[8] = obj_factor * (x[0]); /* 3,2 */
+      values[9] = 0; /* 3,3 */
+
+      /* add the portion for the first constraint */
+      values[1] += lambda[0] * (x[2] * x[3]); /* 1,0 */
+
+      values[3] += lambda[0] * (x[1] * x[3]); /* 2,0 */
+      values[4] += lambda[0] * (x[0] * x[3]); /* 2,1 */
+
+      values[6] += lambda[0] * (x[1] * x[2]); /* 3,0 */
+      values[7] += lambda[0] * (x[0] * x[2]); /* 3,1 */
+      values[8] += lambda[0] * (x[0] * x[1]); /* 3,2 */
+
+      /* add the portion for the second constraint */
+      values[0] += lambda[1] * 2; /* 0,0 */
+
+      values[2] += lambda[1] * 2; /* 1,1 */
+
+      values[5] += lambda[1] * 2; /* 2,2 */
+
+      values[9] += lambda[1] * 2; /* 3,3 */
+   }
+
+   return TRUE;
+}
@@ -174,7 +174,7 @@ bool IterativePardisoSolverInterface::InitializeImpl(
    //options.GetIntegerValue("pardiso_out_of_core_power",
    //                        pardiso_out_of_core_power, prefix);
    options.GetBoolValue("pardiso_skip_inertia_check", skip_inertia_check_, prefix);
-   int max_iterref_steps;
+   Index max_iterref_steps;
    options.GetIntegerValue("pardiso_max_iterative_refinement_steps", max_iterref_steps, prefix);
 
    // PD system
@@ -197,9 +197,9 @@ bool IterativePardisoSolverInterface::InitializeImpl(
    options.GetNumericValue("pardiso_iter_inverse_norm_factor", normal_pardiso_iter_inverse_norm_factor_,
                            prefix + "normal.");
 
-   int pardiso_msglvl;
+   Index pardiso_msglvl;
    options.GetIntegerValue("pardiso_msglvl", pardiso_msglvl, prefix);
-   int order;
+   Index order;
    options.GetEnumValue("pardiso_order", order, prefix);
    options.GetIntegerValue("pardiso_max_droptol_corrections", pardiso_max_droptol_corrections_, prefix);
 
@@ -280,7 +280,7 @@ bool IterativePardisoSolverInterface::InitializeImpl(
    // Matching information:  IPARM_[12] = 2 robust,  but more  expensive method
    IPARM_[12] = (int) match_strat_;
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "Pardiso matching strategy (IPARM(13)): %d\n", IPARM_[12]);
+                  "Pardiso matching strategy (IPARM(13)): %" IPOPT_INDEX_FORMAT "\n", IPARM_[12]);
 
    IPARM_[20] = 3; // Results in better accuracy
    IPARM_[23] = 1; // parallel fac
@@ -435,15 +435,15 @@ static void write_iajaa_matrix(
       mat_file = fopen(mat_name, "w");
 
       fprintf(mat_file, "%d\n", N);
-      fprintf(mat_file, "%d\n", NNZ);
+      fprintf(mat_file, "%" IPOPT_INDEX_FORMAT "\n", NNZ);
 
       for( i = 0; i < N + 1; i++ )
       {
-         fprintf(mat_file, "%d\n", ia[i]);
+         fprintf(mat_file, "%" IPOPT_INDEX_FORMAT "\n", ia[i]);
       }
       for( i = 0; i < NNZ; i++ )
       {
-         fprintf(mat_file, "%d\n", ja[i]);
+         fprintf(mat_file, "%" IPOPT_INDEX_FORMAT "\n", ja[i]);
       }
       for( i = 0; i < NNZ; i++ )
       {
@@ -535,24 +535,24 @@ ESymSolverStatus IterativePardisoSolverInterface::Factorization(
          if( ERROR == -7 )
          {
             Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
-                           "Pardiso symbolic factorization returns ERROR = %d.  Matrix is singular.\n", ERROR);
+                           "Pardiso symbolic factorization returns ERROR = %" IPOPT_INDEX_FORMAT ".  Matrix is singular.\n", ERROR);
             return SYMSOLVER_SINGULAR;
          }
          else if( ERROR != 0 )
          {
             Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                           "Error in Pardiso during symbolic factorization phase.  ERROR = %d.\n", ERROR);
+                           "Error in Pardiso during symbolic factorization phase.  ERROR = %" IPOPT_INDEX_FORMAT ".\n", ERROR);
             return SYMSOLVER_FATAL_ERROR;
          }
          have_symbolic_factorization_ = true;
          just_performed_symbolic_factorization = true;
 
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "Memory in KB required for the symbolic factorization  = %d.\n", IPARM_[14]);
+                        "Memory in KB required for the symbolic factorization  = %" IPOPT_INDEX_FORMAT ".\n", IPARM_[14]);
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "Integer memory in KB required for the numerical factorization  = %d.\n", IPARM_[15]);
+                        "Integer memory in KB required for the numerical factorization  = %" IPOPT_INDEX_FORMAT ".\n", IPARM_[15]);
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "Double  memory in KB required for the numerical factorization  = %d.\n", IPARM_[16]);
+                        "Double  memory in KB required for the numerical factorization  = %" IPOPT_INDEX_FORMAT ".\n", IPARM_[16]);
       }
 
       PHASE = 22;
@@ -613,7 +613,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Factorization(
       if( ERROR == -7 )
       {
          Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
-                        "Pardiso factorization returns ERROR = %d.  Matrix is singular.\n", ERROR);
+                        "Pardiso factorization returns ERROR = %" IPOPT_INDEX_FORMAT ".  Matrix is singular.\n", ERROR);
          return SYMSOLVER_SINGULAR;
       }
       else if( ERROR == -4 )
@@ -625,7 +625,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Factorization(
       else if( ERROR != 0 )
       {
          Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                        "Error in Pardiso during factorization phase.  ERROR = %d.\n", ERROR);
+                        "Error in Pardiso during factorization phase.  ERROR = %" IPOPT_INDEX_FORMAT ".\n", ERROR);
          return SYMSOLVER_FATAL_ERROR;
       }
 
@@ -633,7 +633,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Factorization(
       if( IPARM_[13] != 0 )
       {
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "Number of perturbed pivots in factorization phase = %d.\n", IPARM_[13]);
+                        "Number of perturbed pivots in factorization phase = %" IPOPT_INDEX_FORMAT ".\n", IPARM_[13]);
          if( HaveIpData() )
          {
             IpData().Append_info_string("Pp");
@@ -658,7 +658,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Factorization(
    if( check_NegEVals && (numberOfNegEVals != negevals_) )
    {
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                     "Wrong inertia: required are %d, but we got %d.\n", numberOfNegEVals, negevals_);
+                     "Wrong inertia: required are %" IPOPT_INDEX_FORMAT ", but we got %" IPOPT_INDEX_FORMAT ".\n", numberOfNegEVals, negevals_);
       return SYMSOLVER_WRONG_INERTIA;
    }
 
@@ -738,7 +738,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Solve(
       if( ERROR <= -100 && ERROR >= -110 )
       {
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "Iterative solver in Pardiso did not converge (ERROR = %d)\n", ERROR);
+                        "Iterative solver in Pardiso did not converge (ERROR = %" IPOPT_INDEX_FORMAT ")\n", ERROR);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
                         "  Decreasing drop tolerances from DPARM_[ 4] = %e and DPARM_[ 5] = %e ", DPARM_[4], DPARM_[5]);
          if( is_normal )
@@ -767,12 +767,12 @@ ESymSolverStatus IterativePardisoSolverInterface::Solve(
          if( is_normal )
          {
             Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                           "Number of iterations in Pardiso iterative solver for normal step = %d.\n", iterations_used);
+                           "Number of iterations in Pardiso iterative solver for normal step = %" IPOPT_INDEX_FORMAT ".\n", iterations_used);
          }
          else
          {
             Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                           "Number of iterations in Pardiso iterative solver for PD step = %d.\n", iterations_used);
+                           "Number of iterations in Pardiso iterative solver for PD step = %" IPOPT_INDEX_FORMAT ".\n", iterations_used);
          }
       }
       tester->Clear();
@@ -817,7 +817,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Solve(
    if( IPARM_[6] != 0 )
    {
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                     "Number of iterative refinement steps = %d.\n", IPARM_[6]);
+                     "Number of iterative refinement steps = %" IPOPT_INDEX_FORMAT ".\n", IPARM_[6]);
       if( HaveIpData() )
       {
          IpData().Append_info_string("Pi");
@@ -831,7 +831,7 @@ ESymSolverStatus IterativePardisoSolverInterface::Solve(
    if( ERROR != 0 )
    {
       Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                     "Error in Pardiso during solve phase.  ERROR = %d.\n", ERROR);
+                     "Error in Pardiso during solve phase.  ERROR = %" IPOPT_INDEX_FORMAT ".\n", ERROR);
       return SYMSOLVER_FATAL_ERROR;
    }
    if( test_result_ == IterativeSolverTerminationTester::MODIFY_HESSIAN )
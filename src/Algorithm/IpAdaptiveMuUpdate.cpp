@@ -504,7 +504,7 @@ void AdaptiveMuUpdate::RememberCurrentPointAsAccepted()
             {
                num_refs++;
                Jnlst().Printf(J_MOREDETAILED, J_BARRIER_UPDATE,
-                              "pd system reference[%2d] = %.6e\n", num_refs, *iter);
+                              "pd system reference[%2" IPOPT_INDEX_FORMAT "] = %.6e\n", num_refs, *iter);
             }
          }
       }
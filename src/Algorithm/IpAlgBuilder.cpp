@@ -53,6 +53,8 @@
 #ifdef IPOPT_HAS_HSL
 #include "CoinHslConfig.h"
 #endif
+#include "IpLapackSolverInterface.hpp"
+#include "IpLdlSolverInterface.hpp"
 #include "IpMa27TSolverInterface.hpp"
 #include "IpMa57TSolverInterface.hpp"
 #include "IpMa77SolverInterface.hpp"
@@ -92,7 +94,7 @@ void AlgorithmBuilder::RegisterOptions(
 )
 {
    roptions->SetRegisteringCategory("Linear Solver");
-   roptions->AddStringOption9(
+   roptions->AddStringOption11(
       "linear_solver",
       "Linear solver used for step computations.",
 #ifdef COINHSL_HAS_MA27
@@ -101,10 +103,10 @@ void AlgorithmBuilder::RegisterOptions(
 # ifdef COINHSL_HAS_MA57
       "ma57",
 # else
-# ifdef COINHSL_HAS_MA97
+# if defined(COINHSL_HAS_MA97) && !defined(IPOPT_INT64)
       "ma97",
 #else
-#   ifdef COINHSL_HAS_MA86
+#   if defined(COINHSL_HAS_MA86) && !defined(IPOPT_INT64)
       "ma86",
 #   else
 #    ifdef IPOPT_HAS_PARDISO
@@ -116,10 +118,10 @@ void AlgorithmBuilder::RegisterOptions(
 #      ifdef IPOPT_HAS_MUMPS
       "mumps",
 #      else
-#       ifdef COINHSL_HAS_MA77
+#       if defined(COINHSL_HAS_MA77) && !defined(IPOPT_INT64)
       "ma77",
 #       else
-      "ma27",
+      "ldl",
 #       endif
 #      endif
 #     endif
@@ -136,10 +138,14 @@ void AlgorithmBuilder::RegisterOptions(
       "pardiso", "use the Pardiso package",
       "wsmp", "use WSMP package",
       "mumps", "use MUMPS package",
+      "ldl", "use Ipopt's supernodal LDL^T factorization",
+      "lapack", "use the dense LDL^T factorization of LAPACK",
       "custom", "use custom linear solver",
       "Determines which linear algebra package is to be used for the solution of the augmented linear system (for obtaining the search directions). "
       "Note, the code must have been compiled with the linear solver you want to choose. "
-      "Depending on your Ipopt installation, not all options are available.");
+      "Depending on your Ipopt installation, not all options are available, except for ldl, which is always available. "
+      "If this option is not set, small and dense linear systems are solved with lapack instead of the default linear solver "
+      "(see dense_linear_solver_max_dim).");
    roptions->SetRegisteringCategory("Linear Solver");
    roptions->AddStringOption3(
       "linear_system_scaling", "Method for scaling the linear system.",
@@ -248,7 +254,7 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
 {
    SmartPtr<SparseSymLinearSolverInterface> SolverInterface;
    std::string linear_solver;
-   options.GetStringValue("linear_solver", linear_solver, prefix);
+   bool linear_solver_set = options.GetStringValue("linear_solver", linear_solver, prefix);
    if( linear_solver == "ma27" )
    {
 #ifndef COINHSL_HAS_MA27
@@ -305,7 +311,9 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
    }
    else if( linear_solver == "ma77" )
    {
-#ifndef COINHSL_HAS_MA77
+#if defined(IPOPT_INT64)
+      THROW_EXCEPTION(OPTION_INVALID, "HSL_MA77 cannot be used with 64-bit integers.");
+#elif !defined(COINHSL_HAS_MA77)
 # ifdef IPOPT_HAS_LINEARSOLVERLOADER
       SolverInterface = new Ma77SolverInterface();
       if (!LSL_isMA77available())
@@ -332,7 +340,9 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
    }
    else if( linear_solver == "ma86" )
    {
-#ifndef COINHSL_HAS_MA86
+#if defined(IPOPT_INT64)
+      THROW_EXCEPTION(OPTION_INVALID, "HSL_MA86 cannot be used with 64-bit integers.");
+#elif !defined(COINHSL_HAS_MA86)
 # ifdef IPOPT_HAS_LINEARSOLVERLOADER
       SolverInterface = new Ma86SolverInterface();
       if (!LSL_isMA86available())
@@ -383,7 +393,9 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
    }
    else if( linear_solver == "ma97" )
    {
-#ifndef COINHSL_HAS_MA97
+#if defined(IPOPT_INT64)
+      THROW_EXCEPTION(OPTION_INVALID, "HSL_MA97 cannot be used with 64-bit integers.");
+#elif !defined(COINHSL_HAS_MA97)
 # ifdef IPOPT_HAS_LINEARSOLVERLOADER
       SolverInterface = new Ma97SolverInterface();
       if (!LSL_isMA97available())
@@ -436,6 +448,20 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
       THROW_EXCEPTION(OPTION_INVALID, "Selected linear solver MUMPS not available.");
 #endif
 
+   }
+   else if( linear_solver == "ldl" )
+   {
+      SolverInterface = new LdlSolverInterface();
+   }
+   else if( linear_solver == "lapack" )
+   {
+#ifdef IPOPT_HAS_LAPACK
+      SolverInterface = new LapackSolverInterface();
+#else
+
+      THROW_EXCEPTION(OPTION_INVALID, "Selected linear solver LAPACK not available.");
+#endif
+
    }
    else if( linear_solver == "custom" )
    {
@@ -482,7 +508,17 @@ SmartPtr<SymLinearSolver> AlgorithmBuilder::SymLinearSolverFactory(
       ScalingMethod = new SlackBasedTSymScalingMethod();
    }
 
-   SmartPtr<SymLinearSolver> ScaledSolver = new TSymLinearSolver(SolverInterface, ScalingMethod);
+   // If no linear solver has been chosen, small and dense linear systems
+   // are solved by LAPACK
+   SmartPtr<SparseSymLinearSolverInterface> DenseSolverInterface;
+#ifdef IPOPT_HAS_LAPACK
+   if( !linear_solver_set && linear_solver != "lapack" )
+   {
+      DenseSolverInterface = new LapackSolverInterface();
+   }
+#endif
+
+   SmartPtr<SymLinearSolver> ScaledSolver = new TSymLinearSolver(SolverInterface, ScalingMethod, DenseSolverInterface);
    return ScaledSolver;
 }
 
@@ -717,6 +753,7 @@ SmartPtr<HessianUpdater> AlgorithmBuilder::BuildHessianUpdater(
    switch( hessian_approximation )
    {
       case EXACT:
+      case FINDIFF_VALUES:
          HessUpdater = new ExactHessianUpdater();
          break;
       case LIMITED_MEMORY:
@@ -919,6 +956,7 @@ SmartPtr<LineSearch> AlgorithmBuilder::BuildLineSearch(
       switch( hessian_approximation )
       {
          case EXACT:
+         case FINDIFF_VALUES:
             resto_HessUpdater = new ExactHessianUpdater();
             break;
          case LIMITED_MEMORY:
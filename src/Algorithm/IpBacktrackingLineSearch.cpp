@@ -53,6 +53,15 @@ void BacktrackingLineSearch::RegisterOptions(
       1.0, true,
       0.5,
       "At every step of the backtracking line search, the trial step size is reduced by this factor.");
+   roptions->AddLowerBoundedIntegerOption(
+      "parallel_trial_points",
+      "Number of trial step sizes of the backtracking line search for which the functions are evaluated at once.",
+      1,
+      1,
+      "If larger than 1, the objective and constraint functions are evaluated at this number of successive trial step sizes "
+      "at the same time, concurrently on several threads if the NLP supports it (see TNLP::is_reentrant). "
+      "The trial points are then checked in the usual order, so that the accepted step size is the same as with the value 1. "
+      "This can reduce the wallclock time if function evaluations are expensive and trial points are frequently rejected.");
 
    std::string prev_category = roptions->RegisteringCategory();
    roptions->SetRegisteringCategory("Undocumented");
@@ -195,6 +204,7 @@ bool BacktrackingLineSearch::InitializeImpl(
 )
 {
    options.GetNumericValue("alpha_red_factor", alpha_red_factor_, prefix);
+   options.GetIntegerValue("parallel_trial_points", parallel_trial_points_, prefix);
    options.GetBoolValue("magic_steps", magic_steps_, prefix);
    options.GetBoolValue("accept_every_trial_step", accept_every_trial_step_, prefix);
    options.GetIntegerValue("accept_after_max_steps", accept_after_max_steps_, prefix);
@@ -254,7 +264,7 @@ void BacktrackingLineSearch::FindAcceptableTrialPoint()
    DBG_START_METH("BacktrackingLineSearch::FindAcceptableTrialPoint",
                   dbg_verbosity);
    Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
-                  "--> Starting line search in iteration %d <--\n", IpData().iter_count());
+                  "--> Starting line search in iteration %" IPOPT_INDEX_FORMAT " <--\n", IpData().iter_count());
 
    Number curr_mu = IpData().curr_mu();
    if( last_mu_ != curr_mu )
@@ -573,7 +583,7 @@ void BacktrackingLineSearch::FindAcceptableTrialPoint()
                if( found_acceptable )
                {
                   Jnlst().Printf(J_WARNING, J_LINE_SEARCH,
-                                 "Restoration phase is called at almost feasible point,\n  but acceptable point from iteration %d could be restored.\n",
+                                 "Restoration phase is called at almost feasible point,\n  but acceptable point from iteration %" IPOPT_INDEX_FORMAT " could be restored.\n",
                                  acceptable_iteration_number_);
                   THROW_EXCEPTION(ACCEPTABLE_POINT_REACHED,
                                   "Restoration phase called at almost feasible point, but acceptable point could be restored.\n");
@@ -723,6 +733,12 @@ bool BacktrackingLineSearch::DoBacktrackingLineSearch(
 
    if( !accept )
    {
+      // Trial values of x for which the functions are evaluated at once
+      bool prepare_trial_points = parallel_trial_points_ > 1 && !in_watchdog_ && !accept_every_trial_step_;
+      std::vector<SmartPtr<const Vector> > trial_x;
+      // Position of the trial point for alpha_primal in trial_x
+      size_t trial_k = 0;
+
       // Loop over decreasing step sizes until acceptable point is
       // found or until step size becomes too small
 
@@ -736,7 +752,19 @@ bool BacktrackingLineSearch::DoBacktrackingLineSearch(
          try
          {
             // Compute the primal trial point
-            IpData().SetTrialPrimalVariablesFromStep(alpha_primal, *actual_delta->x(), *actual_delta->s());
+            if( prepare_trial_points )
+            {
+               if( trial_k == trial_x.size() )
+               {
+                  PrepareTrialPoints(alpha_primal, alpha_min, n_steps, *actual_delta->x(), trial_x);
+                  trial_k = 0;
+               }
+               IpData().SetTrialPrimalVariablesFromStep(*trial_x[trial_k], alpha_primal, *actual_delta->s());
+            }
+            else
+            {
+               IpData().SetTrialPrimalVariablesFromStep(alpha_primal, *actual_delta->x(), *actual_delta->s());
+            }
 
             if( magic_steps_ )
             {
@@ -815,6 +843,8 @@ bool BacktrackingLineSearch::DoBacktrackingLineSearch(
          // Point is not yet acceptable, try a shorter one
          alpha_primal *= alpha_red_factor_;
          n_steps++;
+         // the prepared trial points follow the same sequence of step sizes
+         trial_k++;
       }
    } /* if (!accept) */
 
@@ -841,6 +871,44 @@ bool BacktrackingLineSearch::DoBacktrackingLineSearch(
    return accept;
 }
 
+void BacktrackingLineSearch::PrepareTrialPoints(
+   Number                                alpha_primal,
+   Number                                alpha_min,
+   Index                                 n_steps,
+   const Vector&                         delta_x,
+   std::vector<SmartPtr<const Vector> >& trial_x
+)
+{
+   DBG_START_METH("BacktrackingLineSearch::PrepareTrialPoints",
+                  dbg_verbosity);
+
+   trial_x.clear();
+
+   // Take the step sizes that the loop in DoBacktrackingLineSearch would
+   // try next if the trial points are rejected
+   SmartPtr<const Vector> curr_x = IpData().curr()->x();
+   Number alpha = alpha_primal;
+   for( Index k = 0; k < parallel_trial_points_; k++ )
+   {
+      if( k > 0 && alpha <= alpha_min )
+      {
+         break;
+      }
+      if( accept_after_max_steps_ != -1 && k > 0 && n_steps + k > accept_after_max_steps_ )
+      {
+         break;
+      }
+      SmartPtr<Vector> x = curr_x->MakeNew();
+      x->AddTwoVectors(1., *curr_x, alpha, delta_x, 0.);
+      trial_x.push_back(ConstPtr(x));
+      alpha *= alpha_red_factor_;
+   }
+
+   Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
+                  "Evaluating functions at %d trial points at once.\n", (int) trial_x.size());
+   IpNLP().PrepareEvaluationAtPoints(trial_x);
+}
+
 void BacktrackingLineSearch::StartWatchDog()
 {
    DBG_START_FUN("BacktrackingLineSearch::StartWatchDog", dbg_verbosity);
@@ -253,6 +253,22 @@ private:
     *  violation. */
    void PerformMagicStep();
 
+   /** Compute the trial values of x for the step size alpha_primal and
+    *  the following smaller step sizes of the backtracking line search, up
+    *  to parallel_trial_points of them, and let the NLP evaluate the
+    *  functions at all of them at once.
+    *
+    *  trial_x[k] is the trial point for the step size alpha_primal times
+    *  alpha_red_factor to the power k.
+    */
+   void PrepareTrialPoints(
+      Number                                alpha_primal,
+      Number                                alpha_min,
+      Index                                 n_steps,
+      const Vector&                         delta_x,
+      std::vector<SmartPtr<const Vector> >& trial_x
+   );
+
    /** Detect if the search direction is too small.
     *
     *  This should be
@@ -288,6 +304,10 @@ private:
     *  point is rejected. */
    Number alpha_red_factor_;
 
+   /** Number of trial step sizes for which the functions are evaluated
+    *  at once. */
+   Index parallel_trial_points_;
+
    /** enumeration for the different alpha_for_y_ settings */
    enum AlphaForYEnum
    {
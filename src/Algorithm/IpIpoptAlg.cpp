@@ -499,7 +499,7 @@ void IpoptAlgorithm::UpdateHessian()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Update HessianMatrix for Iteration %d:", IpData().iter_count());
+                  "*** Update HessianMatrix for Iteration %" IPOPT_INDEX_FORMAT ":", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
    hessian_updater_->UpdateHessian();
@@ -510,7 +510,7 @@ bool IpoptAlgorithm::UpdateBarrierParameter()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Update Barrier Parameter for Iteration %d:", IpData().iter_count());
+                  "*** Update Barrier Parameter for Iteration %" IPOPT_INDEX_FORMAT ":", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
    bool retval = mu_update_->UpdateBarrierParameter();
@@ -536,7 +536,7 @@ bool IpoptAlgorithm::ComputeSearchDirection()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Solving the Primal Dual System for Iteration %d:", IpData().iter_count());
+                  "*** Solving the Primal Dual System for Iteration %" IPOPT_INDEX_FORMAT ":", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
 
@@ -545,13 +545,13 @@ bool IpoptAlgorithm::ComputeSearchDirection()
    if( retval )
    {
       Jnlst().Printf(J_MOREVECTOR, J_MAIN,
-                     "*** Step Calculated for Iteration: %d\n", IpData().iter_count());
+                     "*** Step Calculated for Iteration: %" IPOPT_INDEX_FORMAT "\n", IpData().iter_count());
       IpData().delta()->Print(Jnlst(), J_MOREVECTOR, J_MAIN, "delta");
    }
    else
    {
       Jnlst().Printf(J_DETAILED, J_MAIN,
-                     "*** Step could not be computed in iteration %d!\n", IpData().iter_count());
+                     "*** Step could not be computed in iteration %" IPOPT_INDEX_FORMAT "!\n", IpData().iter_count());
    }
 
    return retval;
@@ -562,7 +562,7 @@ void IpoptAlgorithm::ComputeAcceptableTrialPoint()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Finding Acceptable Trial Point for Iteration %d:", IpData().iter_count());
+                  "*** Finding Acceptable Trial Point for Iteration %" IPOPT_INDEX_FORMAT ":", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
    line_search_->FindAcceptableTrialPoint();
@@ -602,12 +602,12 @@ void IpoptAlgorithm::AcceptTrialPoint()
       if( adjusted_slacks == 1 )
       {
          Jnlst().Printf(J_WARNING, J_MAIN,
-                        "In iteration %d, %d Slack too small, adjusting variable bound\n", IpData().iter_count(), adjusted_slacks);
+                        "In iteration %" IPOPT_INDEX_FORMAT ", %" IPOPT_INDEX_FORMAT " Slack too small, adjusting variable bound\n", IpData().iter_count(), adjusted_slacks);
       }
       else
       {
          Jnlst().Printf(J_WARNING, J_MAIN,
-                        "In iteration %d, %d Slacks too small, adjusting variable bounds\n", IpData().iter_count(), adjusted_slacks);
+                        "In iteration %" IPOPT_INDEX_FORMAT ", %" IPOPT_INDEX_FORMAT " Slacks too small, adjusting variable bounds\n", IpData().iter_count(), adjusted_slacks);
       }
       if( Jnlst().ProduceOutput(J_VECTOR, J_MAIN) )
       {
@@ -773,23 +773,23 @@ void IpoptAlgorithm::PrintProblemStatistics()
                          ns_tot, ns_only_lower, ns_both, ns_only_upper);
 
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "Total number of variables............................: %8d\n", nx_tot);
+                  "Total number of variables............................: %8" IPOPT_INDEX_FORMAT "\n", nx_tot);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "                     variables with only lower bounds: %8d\n", nx_only_lower);
+                  "                     variables with only lower bounds: %8" IPOPT_INDEX_FORMAT "\n", nx_only_lower);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "                variables with lower and upper bounds: %8d\n", nx_both);
+                  "                variables with lower and upper bounds: %8" IPOPT_INDEX_FORMAT "\n", nx_both);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "                     variables with only upper bounds: %8d\n", nx_only_upper);
+                  "                     variables with only upper bounds: %8" IPOPT_INDEX_FORMAT "\n", nx_only_upper);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "Total number of equality constraints.................: %8d\n", IpData().curr()->y_c()->Dim());
+                  "Total number of equality constraints.................: %8" IPOPT_INDEX_FORMAT "\n", IpData().curr()->y_c()->Dim());
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "Total number of inequality constraints...............: %8d\n", ns_tot);
+                  "Total number of inequality constraints...............: %8" IPOPT_INDEX_FORMAT "\n", ns_tot);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "        inequality constraints with only lower bounds: %8d\n", ns_only_lower);
+                  "        inequality constraints with only lower bounds: %8" IPOPT_INDEX_FORMAT "\n", ns_only_lower);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "   inequality constraints with lower and upper bounds: %8d\n", ns_both);
+                  "   inequality constraints with lower and upper bounds: %8" IPOPT_INDEX_FORMAT "\n", ns_both);
    Jnlst().Printf(J_SUMMARY, J_STATISTICS,
-                  "        inequality constraints with only upper bounds: %8d\n\n", ns_only_upper);
+                  "        inequality constraints with only upper bounds: %8" IPOPT_INDEX_FORMAT "\n\n", ns_only_upper);
 }
 
 void IpoptAlgorithm::ComputeFeasibilityMultipliers()
@@ -18,6 +18,12 @@ namespace Ipopt
 static const Index dbg_verbosity = 0;
 #endif
 
+/** Quantities that are needed at every trial point */
+static const int trial_point_requests = IpoptNLP::EVAL_F | IpoptNLP::EVAL_C | IpoptNLP::EVAL_D;
+/** Quantities that are needed at every accepted (current) point */
+static const int curr_point_requests = trial_point_requests | IpoptNLP::EVAL_GRAD_F | IpoptNLP::EVAL_JAC_C
+                                       | IpoptNLP::EVAL_JAC_D;
+
 IpoptCalculatedQuantities::IpoptCalculatedQuantities(
    const SmartPtr<IpoptNLP>&  ip_nlp,
    const SmartPtr<IpoptData>& ip_data
@@ -564,6 +570,7 @@ Number IpoptCalculatedQuantities::curr_f()
       if( !trial_f_cache_.GetCachedResult(result, tdeps, sdeps) )
       {
          DBG_PRINT((2, "evaluate curr f\n"));
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          if( objective_depends_on_mu )
          {
             result = ip_nlp_->f(*x, ip_data_->curr_mu());
@@ -611,6 +618,7 @@ Number IpoptCalculatedQuantities::trial_f()
       if( !curr_f_cache_.GetCachedResult(result, tdeps, sdeps) )
       {
          DBG_PRINT((2, "evaluate trial f\n"));
+         ip_nlp_->PrepareEvaluation(*x, trial_point_requests);
          if( objective_depends_on_mu )
          {
             result = ip_nlp_->f(*x, ip_data_->curr_mu());
@@ -655,6 +663,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::curr_grad_f()
    {
       if( !trial_grad_f_cache_.GetCachedResult(result, tdeps, sdeps) )
       {
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          if( objective_depends_on_mu )
          {
             result = ip_nlp_->grad_f(*x, ip_data_->curr_mu());
@@ -1087,6 +1096,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::curr_c()
    {
       if( !trial_c_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          result = ip_nlp_->c(*x);
       }
       curr_c_cache_.AddCachedResult1Dep(result, *x);
@@ -1110,6 +1120,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::trial_c()
    {
       if( !curr_c_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, trial_point_requests);
          result = ip_nlp_->c(*x);
       }
       trial_c_cache_.AddCachedResult1Dep(result, *x);
@@ -1133,6 +1144,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::curr_d()
    {
       if( !trial_d_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          result = ip_nlp_->d(*x);
       }
       curr_d_cache_.AddCachedResult1Dep(result, *x);
@@ -1156,6 +1168,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::trial_d()
    {
       if( !curr_d_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, trial_point_requests);
          result = ip_nlp_->d(*x);
       }
       trial_d_cache_.AddCachedResult1Dep(result, *x);
@@ -1220,6 +1233,7 @@ SmartPtr<const Matrix> IpoptCalculatedQuantities::curr_jac_c()
    {
       if( !trial_jac_c_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          result = ip_nlp_->jac_c(*x);
       }
       curr_jac_c_cache_.AddCachedResult1Dep(result, *x);
@@ -1256,6 +1270,7 @@ SmartPtr<const Matrix> IpoptCalculatedQuantities::curr_jac_d()
    {
       if( !trial_jac_d_cache_.GetCachedResult1Dep(result, *x) )
       {
+         ip_nlp_->PrepareEvaluation(*x, curr_point_requests);
          result = ip_nlp_->jac_d(*x);
       }
       curr_jac_d_cache_.AddCachedResult1Dep(result, *x);
@@ -1924,8 +1939,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::CalcCompl(
    DBG_START_METH("IpoptCalculatedQuantities::CalcCompl()",
                   dbg_verbosity);
    SmartPtr<Vector> result = slack.MakeNew();
-   result->Copy(slack);
-   result->ElementWiseMultiply(mult);
+   result->AddVectorProduct(1., slack, mult, 0.);
    return ConstPtr(result);
 }
 
@@ -3055,10 +3069,8 @@ Number IpoptCalculatedQuantities::trial_primal_dual_system_error(
 
 Number IpoptCalculatedQuantities::CalcFracToBound(
    const Vector& slack_L,
-   Vector&       tmp_L,
    const Matrix& P_L,
    const Vector& slack_U,
-   Vector&       tmp_U,
    const Matrix& P_U,
    const Vector& delta,
    Number        tau
@@ -3067,25 +3079,13 @@ Number IpoptCalculatedQuantities::CalcFracToBound(
    DBG_START_METH("IpoptCalculatedQuantities::CalcFracToBound",
                   dbg_verbosity);
 
-   Number alpha_L = 1.0;
-   Number alpha_U = 1.0;
-   if( slack_L.Dim() > 0 )
-   {
-      P_L.TransMultVector(1.0, delta, 0.0, tmp_L);
-      alpha_L = slack_L.FracToBound(tmp_L, tau);
-   }
-
-   if( slack_U.Dim() > 0 )
-   {
-      P_U.TransMultVector(-1.0, delta, 0.0, tmp_U);
-      alpha_U = slack_U.FracToBound(tmp_U, tau);
-   }
+   // lower and upper bounds are treated in one pass over delta
+   Number alpha = P_L.FracToBoundMTdLU(slack_L, P_U, slack_U, delta, tau);
 
-   DBG_PRINT((1, "alpha_L = %lf, alpha_U = %lf\n", alpha_L, alpha_U));
-   DBG_ASSERT(alpha_L >= 0.0 && alpha_L <= 1.0
-              && alpha_U >= 0.0 && alpha_U <= 1.0);
+   DBG_PRINT((1, "alpha = %lf\n", alpha));
+   DBG_ASSERT(alpha >= 0.0 && alpha <= 1.0);
 
-   return Min(alpha_L, alpha_U);
+   return alpha;
 }
 
 Number IpoptCalculatedQuantities::primal_frac_to_the_bound(
@@ -3111,10 +3111,8 @@ Number IpoptCalculatedQuantities::primal_frac_to_the_bound(
    if( !primal_frac_to_the_bound_cache_.GetCachedResult(result, tdeps, sdeps) )
    {
       result = Min(
-                  CalcFracToBound(*curr_slack_x_L(), Tmp_x_L(), *ip_nlp_->Px_L(), *curr_slack_x_U(), Tmp_x_U(), *ip_nlp_->Px_U(),
-                                  delta_x, tau),
-                  CalcFracToBound(*curr_slack_s_L(), Tmp_s_L(), *ip_nlp_->Pd_L(), *curr_slack_s_U(), Tmp_s_U(), *ip_nlp_->Pd_U(),
-                                  delta_s, tau));
+                  CalcFracToBound(*curr_slack_x_L(), *ip_nlp_->Px_L(), *curr_slack_x_U(), *ip_nlp_->Px_U(), delta_x, tau),
+                  CalcFracToBound(*curr_slack_s_L(), *ip_nlp_->Pd_L(), *curr_slack_s_U(), *ip_nlp_->Pd_U(), delta_s, tau));
 
       primal_frac_to_the_bound_cache_.AddCachedResult(result, tdeps, sdeps);
    }
@@ -3245,9 +3243,7 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::curr_sigma_x()
    {
       SmartPtr<Vector> sigma = x->MakeNew();
 
-      sigma->Set(0.);
-      ip_nlp_->Px_L()->AddMSinvZ(1., *curr_slack_x_L(), *z_L, *sigma);
-      ip_nlp_->Px_U()->AddMSinvZ(1., *curr_slack_x_U(), *z_U, *sigma);
+      ip_nlp_->Px_L()->MSinvZLU(*curr_slack_x_L(), *z_L, *ip_nlp_->Px_U(), *curr_slack_x_U(), *z_U, *sigma);
 
       DBG_PRINT_VECTOR(2, "sigma_x", *sigma);
 
@@ -3271,11 +3267,8 @@ SmartPtr<const Vector> IpoptCalculatedQuantities::curr_sigma_s()
    {
       SmartPtr<Vector> sigma = s->MakeNew();
 
-      sigma->Set(0.);
-      ip_nlp_->Pd_L()->AddMSinvZ(1., *curr_slack_s_L(), *v_L, *sigma);
-      DBG_PRINT_VECTOR(2, "sigma1", *sigma);
-      ip_nlp_->Pd_U()->AddMSinvZ(1., *curr_slack_s_U(), *v_U, *sigma);
-      DBG_PRINT_VECTOR(2, "sigma2", *sigma);
+      ip_nlp_->Pd_L()->MSinvZLU(*curr_slack_s_L(), *v_L, *ip_nlp_->Pd_U(), *curr_slack_s_U(), *v_U, *sigma);
+      DBG_PRINT_VECTOR(2, "sigma_s", *sigma);
 
       result = ConstPtr(sigma);
       curr_sigma_s_cache_.AddCachedResult3Dep(result, *s, *v_L, *v_U);
@@ -14,7 +14,8 @@ IpoptData::IpoptData(
    SmartPtr<IpoptAdditionalData> add_data /*= NULL*/,
    Number                        cpu_time_start /*= -1.*/
 )
-   : cpu_time_start_(cpu_time_start),
+   : linear_solver_statistics_(new LinearSolverStatistics()),
+     cpu_time_start_(cpu_time_start),
      add_data_(add_data)
 { }
 
@@ -195,6 +196,28 @@ void IpoptData::SetTrialPrimalVariablesFromStep(
    set_trial(newvec);
 }
 
+void IpoptData::SetTrialPrimalVariablesFromStep(
+   const Vector& trial_x,
+   Number        alpha,
+   const Vector& delta_s
+)
+{
+   DBG_ASSERT(have_prototypes_);
+
+   if( IsNull(trial_) )
+   {
+      trial_ = iterates_space_->MakeNewIteratesVector(false);
+   }
+
+   SmartPtr<IteratesVector> newvec = trial_->MakeNewContainer();
+   newvec->Set_x(trial_x);
+
+   newvec->create_new_s();
+   newvec->s_NonConst()->AddTwoVectors(1., *curr_->s(), alpha, delta_s, 0.);
+
+   set_trial(newvec);
+}
+
 void IpoptData::SetTrialEqMultipliersFromStep(
    Number        alpha,
    const Vector& delta_y_c,
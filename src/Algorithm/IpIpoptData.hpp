@@ -12,6 +12,7 @@
 #include "IpIteratesVector.hpp"
 #include "IpRegOptions.hpp"
 #include "IpTimingStatistics.hpp"
+#include "IpLinearSolverStatistics.hpp"
 
 namespace Ipopt
 {
@@ -169,6 +170,18 @@ public:
       const Vector& delta_x,
       const Vector& delta_s
    );
+
+   /** Set the primal trial variables to the given x and the value of s
+    *  from the provided step with step length alpha.
+    *
+    *  The pointer to trial_x is copied (no copy of the data, to keep
+    *  cache tags the same), so trial_x must not be modified afterwards.
+    */
+   void SetTrialPrimalVariablesFromStep(
+      const Vector& trial_x,
+      Number        alpha,
+      const Vector& delta_s
+   );
    /** Set the values of the trial values for the equality constraint
     *  multipliers (y_c and y_d) from provided step with step length
     *  alpha.
@@ -352,6 +365,8 @@ public:
    )
    {
       iter_count_ = iter_count;
+      timing_statistics_.SetIteration(iter_count);
+      linear_solver_statistics_->SetIteration(iter_count);
    }
 
    Number curr_mu() const
@@ -590,6 +605,31 @@ public:
       return timing_statistics_;
    }
 
+   /** Return statistics about the factorizations of the linear systems */
+   LinearSolverStatistics& LinearSolverStats()
+   {
+      return *linear_solver_statistics_;
+   }
+
+   /** Return statistics about the factorizations of the linear systems */
+   const LinearSolverStatistics& LinearSolverStats() const
+   {
+      return *linear_solver_statistics_;
+   }
+
+   /** Set the object collecting the statistics about the factorizations
+    *  of the linear systems.
+    *
+    *  This allows the restoration phase to report its factorizations to
+    *  the statistics of the regular algorithm.
+    */
+   void SetLinearSolverStats(
+      const SmartPtr<LinearSolverStatistics>& linear_solver_statistics
+   )
+   {
+      linear_solver_statistics_ = linear_solver_statistics;
+   }
+
    /** Resetting CPU Start Time */
    void ResetCpuStartTime()
    {
@@ -765,6 +805,9 @@ private:
    /** TimingStatistics object collecting all Ipopt timing statistics */
    TimingStatistics timing_statistics_;
 
+   /** Object collecting statistics about the factorizations of the linear systems */
+   SmartPtr<LinearSolverStatistics> linear_solver_statistics_;
+
    /** CPU time counter at begin of optimization. */
    Number cpu_time_start_;
 
@@ -11,6 +11,8 @@
 #include "IpJournalist.hpp"
 #include "IpNLPScaling.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 // forward declarations
@@ -127,6 +129,43 @@ public:
       const Vector& yd
    ) = 0;
 
+   /** Flags for the quantities that can be requested by PrepareEvaluation */
+   enum EvaluationRequest
+   {
+      EVAL_F = 1,
+      EVAL_GRAD_F = 2,
+      EVAL_C = 4,
+      EVAL_D = 8,
+      EVAL_JAC_C = 16,
+      EVAL_JAC_D = 32
+   };
+
+   /** Announce that the given quantities (a combination of
+    *  EvaluationRequest flags) are needed at x.
+    *
+    *  An implementation may evaluate those that are not available yet
+    *  in one call of the NLP and keep them for the accessor methods
+    *  above.  The default implementation does nothing.
+    */
+   virtual void PrepareEvaluation(
+      const Vector& /*x*/,
+      int           /*requests*/
+   )
+   { }
+
+   /** Announce that the objective and constraint functions are needed
+    *  at each of the points x, e.g., at several trial points of a line
+    *  search.
+    *
+    *  An implementation may evaluate them concurrently and keep them for
+    *  the accessor methods above.  The default implementation does
+    *  nothing.
+    */
+   virtual void PrepareEvaluationAtPoints(
+      const std::vector<SmartPtr<const Vector> >& /*x*/
+   )
+   { }
+
    /** Lower bounds on x */
    virtual SmartPtr<const Vector> x_L() const = 0;
 
@@ -693,7 +693,7 @@ void LimMemQuasiNewtonUpdater::UpdateHessian()
       lm_skipped_iter_++;
    }
    Jnlst().Printf(J_DETAILED, J_HESSIAN_APPROXIMATION,
-                  "Number of successive iterations with skipping: %d\n", lm_skipped_iter_);
+                  "Number of successive iterations with skipping: %" IPOPT_INDEX_FORMAT "\n", lm_skipped_iter_);
 
    // Keep stuff around in case we want to skip SR1 retroactively
    // because of negative curvature!
@@ -1209,17 +1209,10 @@ void LimMemQuasiNewtonUpdater::ShiftMultiVector(
    const Vector&                v_new
 )
 {
-   Index ncols = V->NCols();
-
-   SmartPtr<MultiVectorMatrix> new_V = V->MakeNewMultiVectorMatrix();
-
-   for( Index i = 0; i < ncols - 1; i++ )
-   {
-      new_V->SetVector(i, *V->GetVector(i + 1));
-   }
-   new_V->SetVector(ncols - 1, v_new);
-
-   V = new_V;
+   // The matrix might be referenced by the current Hessian approximation or
+   // the backup of the internal data, so we create a new one.  Only
+   // pointers to the column vectors are copied.
+   V = V->MakeNewShiftedMultiVectorMatrix(v_new);
 }
 
 void LimMemQuasiNewtonUpdater::ShiftDenseVector(
@@ -1229,10 +1222,19 @@ void LimMemQuasiNewtonUpdater::ShiftDenseVector(
 {
    Index ndim = V->Dim();
 
-   SmartPtr<DenseVector> new_V = V->MakeNewDenseVector();
+   // Shift in place, unless V is also held by the backup of the internal data
+   SmartPtr<DenseVector> new_V;
+   if( V->ReferenceCount() == 1 )
+   {
+      new_V = V;
+   }
+   else
+   {
+      new_V = V->MakeNewDenseVector();
+   }
 
    DBG_ASSERT(!V->IsHomogeneous());
-   Number* Vvalues = V->Values();
+   const Number* Vvalues = V->Values();
    Number* new_Vvalues = new_V->Values();
    for( Index i = 0; i < ndim - 1; i++ )
    {
@@ -1254,9 +1256,20 @@ void LimMemQuasiNewtonUpdater::ShiftLMatrix(
    DBG_ASSERT(S.NCols() == ndim);
    DBG_ASSERT(Y.NCols() == ndim);
 
-   SmartPtr<DenseGenMatrix> new_V = V->MakeNewDenseGenMatrix();
+   // Shift in place, unless V is also held by the backup of the internal
+   // data.  Since every entry is moved to a position with a smaller index,
+   // the entries can be moved in order of increasing index.
+   SmartPtr<DenseGenMatrix> new_V;
+   if( V->ReferenceCount() == 1 )
+   {
+      new_V = V;
+   }
+   else
+   {
+      new_V = V->MakeNewDenseGenMatrix();
+   }
 
-   Number* Vvalues = V->Values();
+   const Number* Vvalues = V->Values();
    Number* new_Vvalues = new_V->Values();
    for( Index j = 0; j < ndim - 1; j++ )
    {
@@ -1287,9 +1300,18 @@ void LimMemQuasiNewtonUpdater::ShiftSdotSMatrix(
    Index ndim = V->Dim();
    DBG_ASSERT(S.NCols() == ndim);
 
-   SmartPtr<DenseSymMatrix> new_V = V->MakeNewDenseSymMatrix();
+   // Shift in place, unless V is also held by the backup of the internal data
+   SmartPtr<DenseSymMatrix> new_V;
+   if( V->ReferenceCount() == 1 )
+   {
+      new_V = V;
+   }
+   else
+   {
+      new_V = V->MakeNewDenseSymMatrix();
+   }
 
-   Number* Vvalues = V->Values();
+   const Number* Vvalues = V->Values();
    Number* new_Vvalues = new_V->Values();
    for( Index j = 0; j < ndim - 1; j++ )
    {
@@ -1316,9 +1338,18 @@ void LimMemQuasiNewtonUpdater::ShiftSTDRSMatrix(
    Index ndim = V->Dim();
    DBG_ASSERT(S.NCols() == ndim);
 
-   SmartPtr<DenseSymMatrix> new_V = V->MakeNewDenseSymMatrix();
+   // Shift in place, unless V is also held by the backup of the internal data
+   SmartPtr<DenseSymMatrix> new_V;
+   if( V->ReferenceCount() == 1 )
+   {
+      new_V = V;
+   }
+   else
+   {
+      new_V = V->MakeNewDenseSymMatrix();
+   }
 
-   Number* Vvalues = V->Values();
+   const Number* Vvalues = V->Values();
    Number* new_Vvalues = new_V->Values();
    for( Index j = 0; j < ndim - 1; j++ )
    {
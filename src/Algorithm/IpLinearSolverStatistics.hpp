@@ -0,0 +1,241 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#ifndef __IPLINEARSOLVERSTATISTICS_HPP__
+#define __IPLINEARSOLVERSTATISTICS_HPP__
+
+#include "IpReferenced.hpp"
+#include "IpUtils.hpp"
+
+namespace Ipopt
+{
+/** This class collects statistics about the factorizations of the
+ *  linear systems that are solved during an optimization run.
+ *
+ *  The linear solver interfaces report each factorization by
+ *  RecordFactorization, the linear solver and the perturbation handler
+ *  report quality increases and inertia corrections. Quantities that a
+ *  linear solver does not provide are reported as -1.
+ *
+ *  Next to totals for the whole run, the number of factorizations,
+ *  quality increases, and inertia corrections are also counted for
+ *  the current iteration only.
+ */
+class IPOPTLIB_EXPORT LinearSolverStatistics: public ReferencedObject
+{
+public:
+   /**@name Constructors/Destructors */
+   //@{
+   /** Default constructor. */
+   LinearSolverStatistics()
+   {
+      Reset();
+   }
+
+   /** Destructor */
+   virtual ~LinearSolverStatistics()
+   { }
+   //@}
+
+   /** Reset all statistics. */
+   void Reset()
+   {
+      iteration_ = 0;
+      nonzeros_in_factor_ = -1;
+      flops_ = -1.;
+      memory_ = -1.;
+      delayed_pivots_ = -1;
+      peak_memory_ = -1.;
+      total_flops_ = 0.;
+      num_factorizations_ = 0;
+      num_quality_increases_ = 0;
+      num_inertia_corrections_ = 0;
+      iter_factorizations_ = 0;
+      iter_quality_increases_ = 0;
+      iter_inertia_corrections_ = 0;
+   }
+
+   /** Set the current iteration number.
+    *
+    *  The per-iteration counters are reset if the iteration changes.
+    */
+   void SetIteration(
+      Index iter
+   )
+   {
+      if( iter != iteration_ )
+      {
+         iteration_ = iter;
+         iter_factorizations_ = 0;
+         iter_quality_increases_ = 0;
+         iter_inertia_corrections_ = 0;
+      }
+   }
+
+   /**@name Methods for reporting events */
+   //@{
+   /** Report a (numerical) factorization.
+    *
+    *  @param nonzeros_in_factor  number of entries in the factors
+    *  @param flops               (estimated) number of floating point operations
+    *  @param memory              memory used by the factorization in bytes
+    *  @param delayed_pivots      number of delayed pivots
+    */
+   void RecordFactorization(
+      Index  nonzeros_in_factor,
+      Number flops,
+      Number memory,
+      Index  delayed_pivots
+   )
+   {
+      nonzeros_in_factor_ = nonzeros_in_factor;
+      flops_ = flops;
+      memory_ = memory;
+      delayed_pivots_ = delayed_pivots;
+      if( flops > 0. )
+      {
+         total_flops_ += flops;
+      }
+      peak_memory_ = Max(peak_memory_, memory);
+      ++num_factorizations_;
+      ++iter_factorizations_;
+   }
+
+   /** Report that the quality of the linear solver has been increased,
+    *  so that the system is factorized again.
+    */
+   void RecordQualityIncrease()
+   {
+      ++num_quality_increases_;
+      ++iter_quality_increases_;
+   }
+
+   /** Report that the system is perturbed to correct its inertia or
+    *  singularity, so that the system is factorized again.
+    */
+   void RecordInertiaCorrection()
+   {
+      ++num_inertia_corrections_;
+      ++iter_inertia_corrections_;
+   }
+   //@}
+
+   /**@name Statistics of the most recent factorization */
+   //@{
+   /** Number of entries in the factors. */
+   Index NonzerosInFactor() const
+   {
+      return nonzeros_in_factor_;
+   }
+
+   /** Number of floating point operations. */
+   Number Flops() const
+   {
+      return flops_;
+   }
+
+   /** Memory used by the factorization in bytes. */
+   Number Memory() const
+   {
+      return memory_;
+   }
+
+   /** Number of delayed pivots. */
+   Index DelayedPivots() const
+   {
+      return delayed_pivots_;
+   }
+   //@}
+
+   /**@name Statistics of the whole run */
+   //@{
+   /** Maximal memory used by a factorization in bytes. */
+   Number PeakMemory() const
+   {
+      return peak_memory_;
+   }
+
+   /** Number of floating point operations of all factorizations. */
+   Number TotalFlops() const
+   {
+      return total_flops_;
+   }
+
+   Index NumFactorizations() const
+   {
+      return num_factorizations_;
+   }
+
+   Index NumQualityIncreases() const
+   {
+      return num_quality_increases_;
+   }
+
+   Index NumInertiaCorrections() const
+   {
+      return num_inertia_corrections_;
+   }
+   //@}
+
+   /**@name Statistics of the current iteration */
+   //@{
+   Index IterFactorizations() const
+   {
+      return iter_factorizations_;
+   }
+
+   Index IterQualityIncreases() const
+   {
+      return iter_quality_increases_;
+   }
+
+   Index IterInertiaCorrections() const
+   {
+      return iter_inertia_corrections_;
+   }
+   //@}
+
+private:
+   /**@name Default Compiler Generated Methods
+    * (Hidden to avoid implicit creation/calling).
+    *
+    * These methods are not implemented and
+    * we do not want the compiler to implement
+    * them for us, so we declare them private
+    * and do not define them. This ensures that
+    * they will not be implicitly created/called.
+    */
+   //@{
+   /** Copy Constructor */
+   LinearSolverStatistics(
+      const LinearSolverStatistics&
+   );
+
+   /** Default Assignment Operator */
+   void operator=(
+      const LinearSolverStatistics&
+   );
+   //@}
+
+   Index iteration_;
+
+   Index nonzeros_in_factor_;
+   Number flops_;
+   Number memory_;
+   Index delayed_pivots_;
+
+   Number peak_memory_;
+   Number total_flops_;
+   Index num_factorizations_;
+   Index num_quality_increases_;
+   Index num_inertia_corrections_;
+
+   Index iter_factorizations_;
+   Index iter_quality_increases_;
+   Index iter_inertia_corrections_;
+};
+
+} // namespace Ipopt
+
+#endif
@@ -50,6 +50,8 @@ bool LowRankAugSystemSolver::InitializeImpl(
    J2_ = NULL;
    Vtilde1_ = NULL;
    Utilde2_ = NULL;
+   bV_ = NULL;
+   bU_ = NULL;
    Wdiag_ = NULL;
    compound_sol_vecspace_ = NULL;
 
@@ -205,21 +207,15 @@ ESymSolverStatus LowRankAugSystemSolver::Solve(
 
       if( IsValid(Utilde2_) )
       {
-         Index nU = Utilde2_->NCols();
-         SmartPtr<DenseVectorSpace> bUspace = new DenseVectorSpace(nU);
-         SmartPtr<DenseVector> bU = bUspace->MakeNewDenseVector();
-         Utilde2_->TransMultVector(1., *crhs, 0., *bU);
-         J2_->CholeskySolveVector(*bU);
-         Utilde2_->MultVector(1., *bU, 1., *csol);
+         Utilde2_->TransMultVector(1., *crhs, 0., *bU_);
+         J2_->CholeskySolveVector(*bU_);
+         Utilde2_->MultVector(1., *bU_, 1., *csol);
       }
       if( IsValid(Vtilde1_) )
       {
-         Index nV = Vtilde1_->NCols();
-         SmartPtr<DenseVectorSpace> bVspace = new DenseVectorSpace(nV);
-         SmartPtr<DenseVector> bV = bVspace->MakeNewDenseVector();
-         Vtilde1_->TransMultVector(1., *crhs, 0., *bV);
-         J1_->CholeskySolveVector(*bV);
-         Vtilde1_->MultVector(-1., *bV, 1., *csol);
+         Vtilde1_->TransMultVector(1., *crhs, 0., *bV_);
+         J1_->CholeskySolveVector(*bV_);
+         Vtilde1_->MultVector(-1., *bV_, 1., *csol);
       }
    }
 
@@ -292,21 +288,30 @@ ESymSolverStatus LowRankAugSystemSolver::UpdateFactorization(
       DBG_PRINT_VECTOR(2, "B0", *B0);
    }
 
+   // Solve the augmented system for the columns of V and U at once,
+   // so that the underlying linear solver can process all right hand
+   // sides in one block
+   SmartPtr<MultiVectorMatrix> V_x;
    SmartPtr<MultiVectorMatrix> Vtilde1_x;
-   if( IsValid(V) )
+   SmartPtr<MultiVectorMatrix> U_x;
+   SmartPtr<MultiVectorMatrix> Utilde1;
+   SmartPtr<MultiVectorMatrix> Utilde1_x;
+   if( IsValid(V) || IsValid(U) )
    {
-      SmartPtr<MultiVectorMatrix> V_x;
-      Index nV = V->NCols();
-      //DBG_PRINT((1, "delta_x  = %e\n", delta_x));
-      //DBG_PRINT_MATRIX(2, "V", *V);
       retval = SolveMultiVector(D_x, delta_x, D_s, delta_s, J_c, D_c, delta_c, J_d, D_d, delta_d, proto_rhs_x,
-                                proto_rhs_s, proto_rhs_c, proto_rhs_d, *V, P_LM, V_x, Vtilde1_, Vtilde1_x, check_NegEVals, numberOfNegEVals);
+                                proto_rhs_s, proto_rhs_c, proto_rhs_d, GetRawPtr(V), GetRawPtr(U), P_LM, V_x, Vtilde1_,
+                                Vtilde1_x, U_x, Utilde1, Utilde1_x, check_NegEVals, numberOfNegEVals);
       if( retval != SYMSOLVER_SUCCESS )
       {
          Jnlst().Printf(J_DETAILED, J_SOLVE_PD_SYSTEM,
-                        "LowRankAugSystemSolver: SolveMultiVector returned retval = %d for V.\n", retval);
+                        "LowRankAugSystemSolver: SolveMultiVector returned retval = %d for V and U.\n", retval);
          return retval;
       }
+   }
+
+   if( IsValid(V) )
+   {
+      Index nV = V->NCols();
       //DBG_PRINT_MATRIX(2, "Vtilde1_x", *Vtilde1_x);
 
       SmartPtr<DenseSymMatrixSpace> M1space = new DenseSymMatrixSpace(nV);
@@ -327,29 +332,20 @@ ESymSolverStatus LowRankAugSystemSolver::UpdateFactorization(
          num_neg_evals_++;
          return retval;
       }
+      SmartPtr<DenseVectorSpace> bVspace = new DenseVectorSpace(nV);
+      bV_ = bVspace->MakeNewDenseVector();
    }
    else
    {
       Vtilde1_ = NULL;
       J1_ = NULL;
+      bV_ = NULL;
    }
 
    if( IsValid(U) )
    {
       Index nU = U->NCols();
-      SmartPtr<MultiVectorMatrix> U_x;
-      SmartPtr<MultiVectorMatrix> Utilde1;
-      SmartPtr<MultiVectorMatrix> Utilde1_x;
       SmartPtr<MultiVectorMatrix> Utilde2_x;
-      retval = SolveMultiVector(D_x, delta_x, D_s, delta_s, J_c, D_c, delta_c, J_d, D_d, delta_d, proto_rhs_x,
-                                proto_rhs_s, proto_rhs_c, proto_rhs_d, *U, P_LM, U_x, Utilde1, Utilde1_x, check_NegEVals, numberOfNegEVals);
-      if( retval != SYMSOLVER_SUCCESS )
-      {
-         Jnlst().Printf(J_DETAILED, J_SOLVE_PD_SYSTEM,
-                        "LowRankAugSystemSolver: SolveMultiVector returned retval = %d for U.\n", retval);
-         return retval;
-      }
-
       if( IsNull(Vtilde1_) )
       {
          Utilde2_ = Utilde1;
@@ -389,11 +385,14 @@ ESymSolverStatus LowRankAugSystemSolver::UpdateFactorization(
          num_neg_evals_++;
          return retval;
       }
+      SmartPtr<DenseVectorSpace> bUspace = new DenseVectorSpace(nU);
+      bU_ = bUspace->MakeNewDenseVector();
    }
    else
    {
       J2_ = NULL;
       Utilde2_ = NULL;
+      bU_ = NULL;
    }
 
    return retval;
@@ -414,11 +413,15 @@ ESymSolverStatus LowRankAugSystemSolver::SolveMultiVector(
    const Vector&                 proto_rhs_s,
    const Vector&                 proto_rhs_c,
    const Vector&                 proto_rhs_d,
-   const MultiVectorMatrix&      V,
+   const MultiVectorMatrix*      V,
+   const MultiVectorMatrix*      U,
    const SmartPtr<const Matrix>& P_LM,
    SmartPtr<MultiVectorMatrix>&  V_x,
    SmartPtr<MultiVectorMatrix>&  Vtilde,
    SmartPtr<MultiVectorMatrix>&  Vtilde_x,
+   SmartPtr<MultiVectorMatrix>&  U_x,
+   SmartPtr<MultiVectorMatrix>&  Utilde,
+   SmartPtr<MultiVectorMatrix>&  Utilde_x,
    bool                          check_NegEVals,
    Index                         numberOfNegEVals
 )
@@ -428,42 +431,43 @@ ESymSolverStatus LowRankAugSystemSolver::SolveMultiVector(
 
    ESymSolverStatus retval;
 
-   Index nrhs = V.NCols();
+   Index nV = V ? V->NCols() : 0;
+   Index nU = U ? U->NCols() : 0;
+   Index nrhs = nV + nU;
    DBG_ASSERT(nrhs > 0);
 
-   SmartPtr<MultiVectorMatrixSpace> V_xspace = new MultiVectorMatrixSpace(nrhs, *proto_rhs_x.OwnerSpace());
-   V_x = V_xspace->MakeNewMultiVectorMatrix();
-
-   // Create the right hand sides
+   // Create the right hand sides.  The columns of V come first,
+   // followed by those of U.  Only the x-part is nonzero, so all
+   // right hand sides share the same zero vectors for the other parts.
    std::vector<SmartPtr<const Vector> > rhs_xV(nrhs);
    std::vector<SmartPtr<const Vector> > rhs_sV(nrhs);
    std::vector<SmartPtr<const Vector> > rhs_cV(nrhs);
    std::vector<SmartPtr<const Vector> > rhs_dV(nrhs);
 
+   SmartPtr<Vector> zero_s = proto_rhs_s.MakeNew();
+   zero_s->Set(0.);
+   SmartPtr<Vector> zero_c = proto_rhs_c.MakeNew();
+   zero_c->Set(0.);
+   SmartPtr<Vector> zero_d = proto_rhs_d.MakeNew();
+   zero_d->Set(0.);
+
    for( Index i = 0; i < nrhs; i++ )
    {
+      SmartPtr<const Vector> col = (i < nV) ? V->GetVector(i) : U->GetVector(i - nV);
       if( IsNull(P_LM) )
       {
-         rhs_xV[i] = V.GetVector(i);
+         rhs_xV[i] = col;
          DBG_ASSERT(rhs_xV[i]->Dim() == proto_rhs_x.Dim());
       }
       else
       {
          SmartPtr<Vector> fullx = proto_rhs_x.MakeNew();
-         P_LM->MultVector(1., *V.GetVector(i), 0., *fullx);
+         P_LM->MultVector(1., *col, 0., *fullx);
          rhs_xV[i] = ConstPtr(fullx);
       }
-      V_x->SetVector(i, *rhs_xV[i]);
-      SmartPtr<Vector> tmp;
-      tmp = proto_rhs_s.MakeNew();
-      tmp->Set(0.);
-      rhs_sV[i] = ConstPtr(tmp);
-      tmp = proto_rhs_c.MakeNew();
-      tmp->Set(0.);
-      rhs_cV[i] = ConstPtr(tmp);
-      tmp = proto_rhs_d.MakeNew();
-      tmp->Set(0.);
-      rhs_dV[i] = ConstPtr(tmp);
+      rhs_sV[i] = ConstPtr(zero_s);
+      rhs_cV[i] = ConstPtr(zero_c);
+      rhs_dV[i] = ConstPtr(zero_d);
    }
 
    // now get space for the solution
@@ -479,7 +483,8 @@ ESymSolverStatus LowRankAugSystemSolver::SolveMultiVector(
       sol_dV[i] = proto_rhs_d.MakeNew();
    }
 
-   // Call the actual augmented system solver to obtain Vtilde
+   // Call the actual augmented system solver once for all right hand
+   // sides to obtain Vtilde and Utilde
    retval = aug_system_solver_->MultiSolve(GetRawPtr(Wdiag_), 1.0, D_x, delta_x, D_s, delta_s, &J_c, D_c, delta_c, &J_d,
                                            D_d, delta_d, rhs_xV, rhs_sV, rhs_cV, rhs_dV, sol_xV, sol_sV, sol_cV, sol_dV, check_NegEVals, numberOfNegEVals);
 
@@ -492,7 +497,7 @@ ESymSolverStatus LowRankAugSystemSolver::SolveMultiVector(
       return retval;
    }
 
-   // Pack the results into Vtilde
+   // Pack the results into Vtilde and Utilde
    if( IsNull(compound_sol_vecspace_) )
    {
       Index dimx = proto_rhs_x.Dim();
@@ -507,18 +512,49 @@ ESymSolverStatus LowRankAugSystemSolver::SolveMultiVector(
       vecspace->SetCompSpace(3, *proto_rhs_d.OwnerSpace());
       compound_sol_vecspace_ = ConstPtr(vecspace);
    }
-   SmartPtr<MultiVectorMatrixSpace> V1space = new MultiVectorMatrixSpace(nrhs, *compound_sol_vecspace_);
-   Vtilde = V1space->MakeNewMultiVectorMatrix();
-   Vtilde_x = V_xspace->MakeNewMultiVectorMatrix();
+
+   V_x = NULL;
+   Vtilde = NULL;
+   Vtilde_x = NULL;
+   if( nV > 0 )
+   {
+      SmartPtr<MultiVectorMatrixSpace> V_xspace = new MultiVectorMatrixSpace(nV, *proto_rhs_x.OwnerSpace());
+      SmartPtr<MultiVectorMatrixSpace> V1space = new MultiVectorMatrixSpace(nV, *compound_sol_vecspace_);
+      V_x = V_xspace->MakeNewMultiVectorMatrix();
+      Vtilde = V1space->MakeNewMultiVectorMatrix();
+      Vtilde_x = V_xspace->MakeNewMultiVectorMatrix();
+   }
+   U_x = NULL;
+   Utilde = NULL;
+   Utilde_x = NULL;
+   if( nU > 0 )
+   {
+      SmartPtr<MultiVectorMatrixSpace> U_xspace = new MultiVectorMatrixSpace(nU, *proto_rhs_x.OwnerSpace());
+      SmartPtr<MultiVectorMatrixSpace> U1space = new MultiVectorMatrixSpace(nU, *compound_sol_vecspace_);
+      U_x = U_xspace->MakeNewMultiVectorMatrix();
+      Utilde = U1space->MakeNewMultiVectorMatrix();
+      Utilde_x = U_xspace->MakeNewMultiVectorMatrix();
+   }
+
    for( Index i = 0; i < nrhs; i++ )
    {
-      Vtilde_x->SetVector(i, *sol_xV[i]);
       SmartPtr<CompoundVector> cvec = compound_sol_vecspace_->MakeNewCompoundVector(false);
       cvec->SetCompNonConst(0, *sol_xV[i]);
       cvec->SetCompNonConst(1, *sol_sV[i]);
       cvec->SetCompNonConst(2, *sol_cV[i]);
       cvec->SetCompNonConst(3, *sol_dV[i]);
-      Vtilde->SetVectorNonConst(i, *cvec);
+      if( i < nV )
+      {
+         V_x->SetVector(i, *rhs_xV[i]);
+         Vtilde_x->SetVector(i, *sol_xV[i]);
+         Vtilde->SetVectorNonConst(i, *cvec);
+      }
+      else
+      {
+         U_x->SetVector(i - nV, *rhs_xV[i]);
+         Utilde_x->SetVector(i - nV, *sol_xV[i]);
+         Utilde->SetVectorNonConst(i - nV, *cvec);
+      }
    }
 
    return retval;
@@ -190,6 +190,11 @@ private:
    SmartPtr<MultiVectorMatrix> Vtilde1_;
    SmartPtr<MultiVectorMatrix> Utilde2_;
 
+   /** Work vectors for the right hand sides of the small systems
+    *  with J1_ and J2_ in the Sherman-Morrison correction. */
+   SmartPtr<DenseVector> bV_;
+   SmartPtr<DenseVector> bU_;
+
    /** Hessian Matrix passed to the augmented system solver solving
     *  the matrix without the low-rank update. */
    SmartPtr<DiagMatrix> Wdiag_;
@@ -240,8 +245,11 @@ private:
     *  update for multiple right hand sides that are provided as
     *  MultiVectorMatrix.
     *
-    *  The result is returned as a MultiVectorMatrix in Vtilde1.
-    *  V_x and Vtilde1_x are V and Vtilde1 in the x-space.
+    *  The columns of V and U (each of which may be NULL) are solved
+    *  together in a single call of the underlying augmented system
+    *  solver. The results are returned as MultiVectorMatrix in Vtilde1
+    *  and Utilde1.  V_x, Vtilde1_x, U_x, and Utilde1_x are V, Vtilde1,
+    *  U, and Utilde1 in the x-space.
     */
    ESymSolverStatus SolveMultiVector(
       const Vector*                 D_x,
@@ -258,11 +266,15 @@ private:
       const Vector&                 proto_rhs_s,
       const Vector&                 proto_rhs_c,
       const Vector&                 proto_rhs_d,
-      const MultiVectorMatrix&      V,
+      const MultiVectorMatrix*      V,
+      const MultiVectorMatrix*      U,
       const SmartPtr<const Matrix>& P_LM,
       SmartPtr<MultiVectorMatrix>&  V_x,
       SmartPtr<MultiVectorMatrix>&  Vtilde1,
       SmartPtr<MultiVectorMatrix>&  Vtilde1_x,
+      SmartPtr<MultiVectorMatrix>&  U_x,
+      SmartPtr<MultiVectorMatrix>&  Utilde1,
+      SmartPtr<MultiVectorMatrix>&  Utilde1_x,
       bool                          check_NegEVals,
       Index                         numberOfNegEVals
    );
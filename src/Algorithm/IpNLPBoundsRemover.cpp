@@ -278,6 +278,87 @@ bool NLPBoundsRemover::Eval_h(
    return retval;
 }
 
+bool NLPBoundsRemover::Eval_all(
+   const Vector& x,
+   Number*       f,
+   Vector*       g_f,
+   Vector*       c,
+   Vector*       d,
+   Matrix*       jac_c,
+   Matrix*       jac_d
+)
+{
+   CompoundVector* comp_d = NULL;
+   SmartPtr<Vector> d_orig;
+   if( d != NULL )
+   {
+      comp_d = static_cast<CompoundVector*>(d);
+      DBG_ASSERT(dynamic_cast<CompoundVector*>(d));
+      d_orig = comp_d->GetCompNonConst(0);
+   }
+   CompoundMatrix* comp_jac_d = NULL;
+   SmartPtr<Matrix> jac_d_orig;
+   if( jac_d != NULL )
+   {
+      comp_jac_d = static_cast<CompoundMatrix*>(jac_d);
+      DBG_ASSERT(dynamic_cast<CompoundMatrix*>(jac_d));
+      SmartPtr<const MatrixSpace> jac_d_space = comp_jac_d->OwnerSpace();
+      const CompoundMatrixSpace* comp_jac_d_space = static_cast<const CompoundMatrixSpace*>(GetRawPtr(jac_d_space));
+      DBG_ASSERT(dynamic_cast<const CompoundMatrixSpace*>(GetRawPtr(jac_d_space)));
+      jac_d_orig = comp_jac_d_space->GetCompSpace(0, 0)->MakeNew();
+   }
+
+   bool retval = nlp_->Eval_all(x, f, g_f, c, GetRawPtr(d_orig), jac_c, GetRawPtr(jac_d_orig));
+   if( retval && comp_d != NULL )
+   {
+      SmartPtr<Vector> x_L = comp_d->GetCompNonConst(1);
+      SmartPtr<Vector> x_U = comp_d->GetCompNonConst(2);
+      Px_l_orig_->TransMultVector(1., x, 0., *x_L);
+      Px_u_orig_->TransMultVector(1., x, 0., *x_U);
+   }
+   if( retval && comp_jac_d != NULL )
+   {
+      comp_jac_d->SetComp(0, 0, *jac_d_orig);
+   }
+   return retval;
+}
+
+bool NLPBoundsRemover::Eval_f_c_d_at_points(
+   Index                npoints,
+   const Vector* const* x,
+   Number*              f,
+   Vector* const*       c,
+   Vector* const*       d,
+   bool*                success
+)
+{
+   std::vector<Vector*> d_orig(npoints);
+   for( Index i = 0; i < npoints; i++ )
+   {
+      CompoundVector* comp_d = static_cast<CompoundVector*>(d[i]);
+      DBG_ASSERT(dynamic_cast<CompoundVector*>(d[i]));
+      d_orig[i] = GetRawPtr(comp_d->GetCompNonConst(0));
+   }
+
+   if( npoints == 0 || !nlp_->Eval_f_c_d_at_points(npoints, x, f, c, &d_orig[0], success) )
+   {
+      return false;
+   }
+
+   for( Index i = 0; i < npoints; i++ )
+   {
+      if( success[i] )
+      {
+         CompoundVector* comp_d = static_cast<CompoundVector*>(d[i]);
+         SmartPtr<Vector> x_L = comp_d->GetCompNonConst(1);
+         SmartPtr<Vector> x_U = comp_d->GetCompNonConst(2);
+         Px_l_orig_->TransMultVector(1., *x[i], 0., *x_L);
+         Px_u_orig_->TransMultVector(1., *x[i], 0., *x_U);
+      }
+   }
+   return true;
+}
+
 void NLPBoundsRemover::FinalizeSolution(
    SolverReturn               status,
    const Vector&              x,
@@ -165,6 +165,25 @@ public:
       const Vector& yd,
       SymMatrix&    h
    );
+
+   virtual bool Eval_all(
+      const Vector& x,
+      Number*       f,
+      Vector*       g_f,
+      Vector*       c,
+      Vector*       d,
+      Matrix*       jac_c,
+      Matrix*       jac_d
+   );
+
+   virtual bool Eval_f_c_d_at_points(
+      Index                npoints,
+      const Vector* const* x,
+      Number*              f,
+      Vector* const*       c,
+      Vector* const*       d,
+      bool*                success
+   );
    //@}
 
    /** @name NLP solution routines. */
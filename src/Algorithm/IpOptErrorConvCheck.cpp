@@ -274,7 +274,7 @@ bool OptimalityErrorConvergenceCheck::CurrentIsAcceptable()
    {
       // DELETEME
       Jnlst().Printf(J_MOREDETAILED, J_MAIN,
-                     "obj val update iter = %d\n", IpData().iter_count());
+                     "obj val update iter = %" IPOPT_INDEX_FORMAT "\n", IpData().iter_count());
       last_obj_val_ = curr_obj_val_;
       curr_obj_val_ = IpCq().curr_f();
       last_obj_val_iter_ = IpData().iter_count();
@@ -317,7 +317,7 @@ bool OptimalityErrorConvergenceCheck::CurrentIsAcceptable()
                      fabs(curr_obj_val_ - last_obj_val_) / Max(1., fabs(curr_obj_val_)), acceptable_obj_change_tol_);
       // DELETEME
       Jnlst().Printf(J_MOREDETAILED, J_MAIN,
-                     "test iter = %d\n", IpData().iter_count());
+                     "test iter = %" IPOPT_INDEX_FORMAT "\n", IpData().iter_count());
    }
 
    return (overall_error <= acceptable_tol_ && dual_inf <= acceptable_dual_inf_tol_
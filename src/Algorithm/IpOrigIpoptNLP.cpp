@@ -35,7 +35,9 @@ OrigIpoptNLP::OrigIpoptNLP(
      jac_d_cache_(1),
      h_cache_(1),
      unscaled_x_cache_(1),
-     initialized_(false)
+     initialized_(false),
+     try_eval_all_(true),
+     eval_all_succeeded_(false)
 {
 }
 
@@ -113,13 +115,16 @@ void OrigIpoptNLP::RegisterOptions(
       "Activating this option will cause Ipopt to ask for the Hessian of the Lagrangian function "
       "only once from the NLP and reuse this information later.");
    roptions->SetRegisteringCategory("Hessian Approximation");
-   roptions->AddStringOption2(
+   roptions->AddStringOption3(
       "hessian_approximation",
       "Indicates what Hessian information is to be used.",
       "exact",
       "exact", "Use second derivatives provided by the NLP.",
       "limited-memory", "Perform a limited-memory quasi-Newton approximation",
-      "This determines which kind of information for the Hessian of the Lagrangian function is used by the algorithm.");
+      "finite-difference-values", "Use the Hessian structure provided by the NLP, values by finite differences of the gradient of the Lagrangian",
+      "This determines which kind of information for the Hessian of the Lagrangian function is used by the algorithm. "
+      "The finite-difference approximation requires first derivatives from the NLP and perturbs "
+      "several variables at once, as determined by a star coloring of the Hessian structure.");
    roptions->AddStringOption2(
       "hessian_approximation_space",
       "Indicates in which subspace the Hessian information is to be approximated.",
@@ -147,6 +152,8 @@ bool OrigIpoptNLP::Initialize(
    options.GetBoolValue("jac_c_constant", jac_c_constant_, prefix);
    options.GetBoolValue("jac_d_constant", jac_d_constant_, prefix);
    options.GetBoolValue("hessian_constant", hessian_constant_, prefix);
+   Index parallel_trial_points;
+   options.GetIntegerValue("parallel_trial_points", parallel_trial_points, prefix);
 
    // Reset the function evaluation counters (for warm start)
    f_evals_ = 0;
@@ -157,6 +164,9 @@ bool OrigIpoptNLP::Initialize(
    jac_d_evals_ = 0;
    h_evals_ = 0;
 
+   try_eval_all_ = true;
+   eval_all_succeeded_ = false;
+
    if( !warm_start_same_structure_ )
    {
       // Reset all caches.
@@ -178,6 +188,15 @@ bool OrigIpoptNLP::Initialize(
       }
    }
 
+   // The line search may evaluate the functions at several trial points
+   // at once, so keep the values for all of them
+   if( parallel_trial_points > 1 )
+   {
+      f_cache_.Clear(parallel_trial_points);
+      c_cache_.Clear(parallel_trial_points);
+      d_cache_.Clear(parallel_trial_points);
+   }
+
    // Reset the cache entries belonging to a dummy dependency.  This
    // is required for repeated solve, since the cache is not updated
    // if a dimension is zero.  It is also required if we choose
@@ -258,7 +277,7 @@ bool OrigIpoptNLP::InitializeStructures(
             h_space_ = new LowRankUpdateSymMatrixSpace(x_space_->Dim(), ConstPtr(P_approx), ConstPtr(approx_vecspace),
                   true);
             jnlst_->Printf(J_DETAILED, J_INITIALIZATION,
-                           "Hessian approximation will be done in smaller space of dimension %d (instead of %d)\n\n",
+                           "Hessian approximation will be done in smaller space of dimension %" IPOPT_INDEX_FORMAT " (instead of %" IPOPT_INDEX_FORMAT ")\n\n",
                            P_approx->NCols(), P_approx->NRows());
          }
          else
@@ -266,7 +285,7 @@ bool OrigIpoptNLP::InitializeStructures(
             DBG_ASSERT(IsNull(P_approx));
             h_space_ = new LowRankUpdateSymMatrixSpace(x_space_->Dim(), ConstPtr(P_approx), ConstPtr(x_space_), true);
             jnlst_->Printf(J_DETAILED, J_INITIALIZATION,
-                           "Hessian approximation will be done in the space of all %d x variables.\n\n", x_space_->Dim());
+                           "Hessian approximation will be done in the space of all %" IPOPT_INDEX_FORMAT " x variables.\n\n", x_space_->Dim());
          }
       }
 
@@ -292,7 +311,7 @@ bool OrigIpoptNLP::InitializeStructures(
       if( x_space_->Dim() < c_space_->Dim() )
       {
          char msg[128];
-         Snprintf(msg, 127, "Too few degrees of freedom: %d equality constriants but only %d variables",
+         Snprintf(msg, 127, "Too few degrees of freedom: %" IPOPT_INDEX_FORMAT " equality constriants but only %" IPOPT_INDEX_FORMAT " variables",
                   c_space_->Dim(), x_space_->Dim());
          THROW_EXCEPTION(TOO_FEW_DOF, msg);
       }
@@ -810,6 +829,178 @@ SmartPtr<const SymMatrix> OrigIpoptNLP::h(
    return NULL;
 }
 
+void OrigIpoptNLP::PrepareEvaluation(
+   const Vector& x,
+   int           requests
+)
+{
+   DBG_START_METH("OrigIpoptNLP::PrepareEvaluation", dbg_verbosity);
+
+   if( !try_eval_all_ )
+   {
+      // the NLP does not implement Eval_all
+      return;
+   }
+
+   // Determine which of the requested quantities are not cached yet
+   Number dummy_f;
+   SmartPtr<const Vector> dummy_vec;
+   SmartPtr<const Matrix> dummy_mat;
+   const Vector* jac_c_dep = jac_c_constant_ ? NULL : &x;
+   const Vector* jac_d_dep = jac_d_constant_ ? NULL : &x;
+   bool need_f = (requests & EVAL_F) && !f_cache_.GetCachedResult1Dep(dummy_f, &x);
+   bool need_grad_f = (requests & EVAL_GRAD_F) && !grad_f_cache_.GetCachedResult1Dep(dummy_vec, &x);
+   bool need_c = (requests & EVAL_C) && c_space_->Dim() > 0 && !c_cache_.GetCachedResult1Dep(dummy_vec, x);
+   bool need_d = (requests & EVAL_D) && d_space_->Dim() > 0 && !d_cache_.GetCachedResult1Dep(dummy_vec, x);
+   bool need_jac_c = (requests & EVAL_JAC_C) && c_space_->Dim() > 0 && !jac_c_cache_.GetCachedResult1Dep(dummy_mat, jac_c_dep);
+   bool need_jac_d = (requests & EVAL_JAC_D) && d_space_->Dim() > 0 && !jac_d_cache_.GetCachedResult1Dep(dummy_mat, jac_d_dep);
+
+   Index nrequests = (need_f ? 1 : 0) + (need_grad_f ? 1 : 0) + (need_c ? 1 : 0) + (need_d ? 1 : 0)
+                     + (need_jac_c ? 1 : 0) + (need_jac_d ? 1 : 0);
+   if( nrequests < 2 )
+   {
+      // nothing to be gained from a batched evaluation
+      return;
+   }
+
+   Number unscaled_f = 0.;
+   SmartPtr<Vector> unscaled_grad_f = need_grad_f ? x_space_->MakeNew() : NULL;
+   SmartPtr<Vector> unscaled_c = need_c ? c_space_->MakeNew() : NULL;
+   SmartPtr<Vector> unscaled_d = need_d ? d_space_->MakeNew() : NULL;
+   SmartPtr<Matrix> unscaled_jac_c = need_jac_c ? jac_c_space_->MakeNew() : NULL;
+   SmartPtr<Matrix> unscaled_jac_d = need_jac_d ? jac_d_space_->MakeNew() : NULL;
+
+   SmartPtr<const Vector> unscaled_x = get_unscaled_x(x);
+   batch_eval_time_.Start();
+   bool success = nlp_->Eval_all(*unscaled_x, need_f ? &unscaled_f : NULL, GetRawPtr(unscaled_grad_f),
+                                 GetRawPtr(unscaled_c), GetRawPtr(unscaled_d), GetRawPtr(unscaled_jac_c), GetRawPtr(unscaled_jac_d));
+   batch_eval_time_.End();
+   DBG_PRINT((1, "success = %d\n", success));
+   if( !success )
+   {
+      // If the first call fails, the NLP does not implement Eval_all, so
+      // do not ask again.  Later failures are evaluation errors at x.
+      if( !eval_all_succeeded_ )
+      {
+         try_eval_all_ = false;
+      }
+      return;
+   }
+   eval_all_succeeded_ = true;
+
+   // Store the results in the caches.  Invalid numbers are not stored,
+   // so that the accessor methods evaluate and report them.
+   if( need_f && IsFiniteNumber(unscaled_f) )
+   {
+      f_evals_++;
+      f_cache_.AddCachedResult1Dep(NLP_scaling()->apply_obj_scaling(unscaled_f), &x);
+   }
+   if( need_grad_f && IsFiniteNumber(unscaled_grad_f->Nrm2()) )
+   {
+      grad_f_evals_++;
+      grad_f_cache_.AddCachedResult1Dep(NLP_scaling()->apply_grad_obj_scaling(ConstPtr(unscaled_grad_f)), &x);
+   }
+   if( need_c && IsFiniteNumber(unscaled_c->Nrm2()) )
+   {
+      c_evals_++;
+      c_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_c(ConstPtr(unscaled_c)), x);
+   }
+   if( need_d && IsFiniteNumber(unscaled_d->Nrm2()) )
+   {
+      d_evals_++;
+      d_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_d(ConstPtr(unscaled_d)), x);
+   }
+   if( need_jac_c && (!check_derivatives_for_naninf_ || unscaled_jac_c->HasValidNumbers()) )
+   {
+      jac_c_evals_++;
+      jac_c_cache_.AddCachedResult1Dep(NLP_scaling()->apply_jac_c_scaling(ConstPtr(unscaled_jac_c)), jac_c_dep);
+   }
+   if( need_jac_d && (!check_derivatives_for_naninf_ || unscaled_jac_d->HasValidNumbers()) )
+   {
+      jac_d_evals_++;
+      jac_d_cache_.AddCachedResult1Dep(NLP_scaling()->apply_jac_d_scaling(ConstPtr(unscaled_jac_d)), jac_d_dep);
+   }
+}
+
+void OrigIpoptNLP::PrepareEvaluationAtPoints(
+   const std::vector<SmartPtr<const Vector> >& x
+)
+{
+   DBG_START_METH("OrigIpoptNLP::PrepareEvaluationAtPoints", dbg_verbosity);
+
+   // Collect the points at which not all function values are cached yet
+   Number dummy_f;
+   SmartPtr<const Vector> dummy_vec;
+   std::vector<const Vector*> points;
+   for( size_t i = 0; i < x.size(); i++ )
+   {
+      if( !f_cache_.GetCachedResult1Dep(dummy_f, GetRawPtr(x[i]))
+          || (c_space_->Dim() > 0 && !c_cache_.GetCachedResult1Dep(dummy_vec, *x[i]))
+          || (d_space_->Dim() > 0 && !d_cache_.GetCachedResult1Dep(dummy_vec, *x[i])) )
+      {
+         points.push_back(GetRawPtr(x[i]));
+      }
+   }
+   Index npoints = (Index) points.size();
+   if( npoints < 2 )
+   {
+      // nothing to be gained from evaluating the points at once
+      return;
+   }
+
+   std::vector<SmartPtr<const Vector> > unscaled_x(npoints);
+   std::vector<const Vector*> unscaled_x_ptr(npoints);
+   std::vector<SmartPtr<Vector> > unscaled_c(npoints);
+   std::vector<Vector*> unscaled_c_ptr(npoints);
+   std::vector<SmartPtr<Vector> > unscaled_d(npoints);
+   std::vector<Vector*> unscaled_d_ptr(npoints);
+   std::vector<Number> unscaled_f(npoints, 0.);
+   bool* success = new bool[npoints];
+   for( Index i = 0; i < npoints; i++ )
+   {
+      unscaled_x[i] = get_unscaled_x(*points[i]);
+      unscaled_x_ptr[i] = GetRawPtr(unscaled_x[i]);
+      unscaled_c[i] = c_space_->MakeNew();
+      unscaled_c_ptr[i] = GetRawPtr(unscaled_c[i]);
+      unscaled_d[i] = d_space_->MakeNew();
+      unscaled_d_ptr[i] = GetRawPtr(unscaled_d[i]);
+   }
+
+   batch_eval_time_.Start();
+   bool evaluated = nlp_->Eval_f_c_d_at_points(npoints, &unscaled_x_ptr[0], &unscaled_f[0], &unscaled_c_ptr[0],
+                    &unscaled_d_ptr[0], success);
+   batch_eval_time_.End();
+   DBG_PRINT((1, "evaluated = %d\n", evaluated));
+
+   // Store the results in the caches.  Points with failed evaluations or
+   // invalid numbers are not stored, so that the accessor methods evaluate
+   // and report them.
+   for( Index i = 0; evaluated && i < npoints; i++ )
+   {
+      if( !success[i] )
+      {
+         continue;
+      }
+      const Vector& xi = *points[i];
+      if( IsFiniteNumber(unscaled_f[i]) )
+      {
+         f_evals_++;
+         f_cache_.AddCachedResult1Dep(NLP_scaling()->apply_obj_scaling(unscaled_f[i]), &xi);
+      }
+      if( c_space_->Dim() > 0 && IsFiniteNumber(unscaled_c[i]->Nrm2()) )
+      {
+         c_evals_++;
+         c_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_c(ConstPtr(unscaled_c[i])), xi);
+      }
+      if( d_space_->Dim() > 0 && IsFiniteNumber(unscaled_d[i]->Nrm2()) )
+      {
+         d_evals_++;
+         d_cache_.AddCachedResult1Dep(NLP_scaling()->apply_vector_scaling_d(ConstPtr(unscaled_d[i])), xi);
+      }
+   }
+   delete[] success;
+}
+
 void OrigIpoptNLP::GetSpaces(
    SmartPtr<const VectorSpace>&    x_space,
    SmartPtr<const VectorSpace>&    c_space,
@@ -1009,27 +1200,44 @@ void OrigIpoptNLP::PrintTimingStatistics(
                 " Inequality constraint Jacobian.....: %10.3f (sys: %10.3f wall: %10.3f)\n", jac_d_eval_time_.TotalCpuTime(), jac_d_eval_time_.TotalSysTime(), jac_d_eval_time_.TotalWallclockTime());
    jnlst.Printf(level, category,
                 " Lagrangian Hessian.................: %10.3f (sys: %10.3f wall: %10.3f)\n", h_eval_time_.TotalCpuTime(), h_eval_time_.TotalSysTime(), h_eval_time_.TotalWallclockTime());
+   jnlst.Printf(level, category,
+                " Batched evaluations................: %10.3f (sys: %10.3f wall: %10.3f)\n", batch_eval_time_.TotalCpuTime(), batch_eval_time_.TotalSysTime(), batch_eval_time_.TotalWallclockTime());
 }
 
 Number OrigIpoptNLP::TotalFunctionEvaluationCpuTime() const
 {
    return f_eval_time_.TotalCpuTime() + grad_f_eval_time_.TotalCpuTime() + c_eval_time_.TotalCpuTime()
           + d_eval_time_.TotalCpuTime() + jac_c_eval_time_.TotalCpuTime() + jac_d_eval_time_.TotalCpuTime()
-          + h_eval_time_.TotalCpuTime();
+          + h_eval_time_.TotalCpuTime() + batch_eval_time_.TotalCpuTime();
 }
 
 Number OrigIpoptNLP::TotalFunctionEvaluationSysTime() const
 {
    return f_eval_time_.TotalSysTime() + grad_f_eval_time_.TotalSysTime() + c_eval_time_.TotalSysTime()
           + d_eval_time_.TotalSysTime() + jac_c_eval_time_.TotalSysTime() + jac_d_eval_time_.TotalSysTime()
-          + h_eval_time_.TotalSysTime();
+          + h_eval_time_.TotalSysTime() + batch_eval_time_.TotalSysTime();
 }
 
 Number OrigIpoptNLP::TotalFunctionEvaluationWallclockTime() const
 {
    return f_eval_time_.TotalWallclockTime() + grad_f_eval_time_.TotalWallclockTime() + c_eval_time_.TotalWallclockTime()
           + d_eval_time_.TotalWallclockTime() + jac_c_eval_time_.TotalWallclockTime()
-          + jac_d_eval_time_.TotalWallclockTime() + h_eval_time_.TotalWallclockTime();
+          + jac_d_eval_time_.TotalWallclockTime() + h_eval_time_.TotalWallclockTime()
+          + batch_eval_time_.TotalWallclockTime();
+}
+
+void OrigIpoptNLP::SetTimedTaskRecorder(
+   TimedTaskRecorder* recorder
+)
+{
+   f_eval_time_.SetRecorder("ObjectiveFunction", recorder);
+   grad_f_eval_time_.SetRecorder("ObjectiveFunctionGradient", recorder);
+   c_eval_time_.SetRecorder("EqualityConstraints", recorder);
+   d_eval_time_.SetRecorder("InequalityConstraints", recorder);
+   jac_c_eval_time_.SetRecorder("EqualityConstraintJacobian", recorder);
+   jac_d_eval_time_.SetRecorder("InequalityConstraintJacobian", recorder);
+   h_eval_time_.SetRecorder("LagrangianHessian", recorder);
+   batch_eval_time_.SetRecorder("BatchedEvaluation", recorder);
 }
 
 void OrigIpoptNLP::ResetTimes()
@@ -1041,6 +1249,7 @@ void OrigIpoptNLP::ResetTimes()
    jac_c_eval_time_.Reset();
    jac_d_eval_time_.Reset();
    h_eval_time_.Reset();
+   batch_eval_time_.Reset();
 }
 
 SmartPtr<const Vector> OrigIpoptNLP::get_unscaled_x(
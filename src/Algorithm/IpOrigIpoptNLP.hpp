@@ -18,7 +18,8 @@ namespace Ipopt
 enum HessianApproximationType
 {
    EXACT = 0,
-   LIMITED_MEMORY
+   LIMITED_MEMORY,
+   FINDIFF_VALUES
 };
 
 /** enumeration for the Hessian approximation space. */
@@ -139,6 +140,29 @@ public:
       const Vector& yd
    );
 
+   /** Evaluates the requested quantities that are not cached yet by one
+    *  call of NLP::Eval_all if more than one of them is missing.
+    *
+    *  The results are stored in the caches of the accessor methods.  If
+    *  the NLP does not evaluate the quantities, nothing is stored and the
+    *  accessor methods evaluate them as usual.
+    */
+   virtual void PrepareEvaluation(
+      const Vector& x,
+      int           requests
+   );
+
+   /** Evaluates the objective and constraint functions at those of the
+    *  points that are not cached yet by one call of
+    *  NLP::Eval_f_c_d_at_points if there are at least two of them.
+    *
+    *  The results are stored in the caches of the accessor methods, which
+    *  have room for the values at parallel_trial_points points.
+    */
+   virtual void PrepareEvaluationAtPoints(
+      const std::vector<SmartPtr<const Vector> >& x
+   );
+
    /** Hessian of the Lagrangian (depending in mu) - incorrect
     *  version for OrigIpoptNLP
     */
@@ -324,6 +348,13 @@ public:
    /** Reset the timing statistics */
    void ResetTimes();
 
+   /** Set the object that records the individual function evaluations
+    *  (NULL for none).
+    */
+   void SetTimedTaskRecorder(
+      TimedTaskRecorder* recorder
+   );
+
    void PrintTimingStatistics(
       Journalist&      jnlst,
       EJournalLevel    level,
@@ -358,6 +389,10 @@ public:
    {
       return h_eval_time_;
    }
+   const TimedTask& batch_eval_time() const
+   {
+      return batch_eval_time_;
+   }
 
    Number TotalFunctionEvaluationCpuTime() const;
    Number TotalFunctionEvaluationSysTime() const;
@@ -555,6 +590,12 @@ private:
    /** Flag indicating if initialization method has been called */
    bool initialized_;
 
+   /** Flag indicating whether PrepareEvaluation should call NLP::Eval_all */
+   bool try_eval_all_;
+
+   /** Flag indicating whether NLP::Eval_all has succeeded before */
+   bool eval_all_succeeded_;
+
    /**@name Timing statistics for the function evaluations. */
    //@{
    TimedTask f_eval_time_;
@@ -564,6 +605,8 @@ private:
    TimedTask d_eval_time_;
    TimedTask jac_d_eval_time_;
    TimedTask h_eval_time_;
+   /** Time spent in NLP::Eval_all and NLP::Eval_f_c_d_at_points */
+   TimedTask batch_eval_time_;
    //@}
 };
 
@@ -84,7 +84,7 @@ void OrigIterationOutput::WriteOutput()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Summary of Iteration: %d:", IpData().iter_count());
+                  "*** Summary of Iteration: %" IPOPT_INDEX_FORMAT ":", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
    if( IpData().info_iters_since_header() >= 10 && !IpData().info_skip_output() )
@@ -152,7 +152,7 @@ void OrigIterationOutput::WriteOutput()
            || last_output < 0.0) )
    {
       Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
-                     "%4d%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3d", iter, info_iter, unscaled_f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr, alpha_dual, alpha_primal, alpha_primal_char, ls_count);
+                     "%4" IPOPT_INDEX_FORMAT "%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3" IPOPT_INDEX_FORMAT, iter, info_iter, unscaled_f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr, alpha_dual, alpha_primal, alpha_primal_char, ls_count);
       if( print_info_string_ )
       {
          Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
@@ -179,7 +179,7 @@ void OrigIterationOutput::WriteOutput()
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n**************************************************\n");
       Jnlst().Printf(J_DETAILED, J_MAIN,
-                     "*** Beginning Iteration %d from the following point:", IpData().iter_count());
+                     "*** Beginning Iteration %" IPOPT_INDEX_FORMAT " from the following point:", IpData().iter_count());
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n**************************************************\n\n");
 
@@ -262,7 +262,7 @@ void OrigIterationOutput::WriteOutput()
    if( Jnlst().ProduceOutput(J_DETAILED, J_MAIN) )
    {
       Jnlst().Printf(J_DETAILED, J_MAIN,
-                     "\n\n***Current NLP Values for Iteration %d:\n", IpData().iter_count());
+                     "\n\n***Current NLP Values for Iteration %" IPOPT_INDEX_FORMAT ":\n", IpData().iter_count());
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n                                   (scaled)                 (unscaled)\n");
       Jnlst().Printf(J_DETAILED, J_MAIN,
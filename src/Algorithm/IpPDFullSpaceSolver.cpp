@@ -372,6 +372,97 @@ bool PDFullSpaceSolver::Solve(
    return true;
 }
 
+bool PDFullSpaceSolver::MultiSolve(
+   Number                                              alpha,
+   Number                                              beta,
+   const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+   std::vector<SmartPtr<IteratesVector> >&             resV,
+   bool                                                allow_inexact
+)
+{
+   DBG_START_METH("PDFullSpaceSolver::MultiSolve", dbg_verbosity);
+
+   const Index nrhs = (Index) rhsV.size();
+   DBG_ASSERT(nrhs == (Index) resV.size());
+   if( nrhs <= 1 || !allow_inexact )
+   {
+      // Iterative refinement and its remedies (increasing the quality of
+      // the linear solver or pretending that the system is singular) may
+      // modify the system, so that exact solutions are computed by Solve
+      // one right hand side after the other
+      return PDSystemSolver::MultiSolve(alpha, beta, rhsV, resV, allow_inexact);
+   }
+
+   IpData().TimingStats().PDSystemSolverTotal().Start();
+
+   // if beta is nonzero, keep a copy of the incoming values in res_ */
+   std::vector<SmartPtr<IteratesVector> > copy_resV(nrhs);
+   if( beta != 0. )
+   {
+      for( Index i = 0; i < nrhs; i++ )
+      {
+         copy_resV[i] = resV[i]->MakeNewIteratesVectorCopy();
+      }
+   }
+
+   // Receive data about matrix
+   SmartPtr<const SymMatrix> W = IpData().W();
+   SmartPtr<const Matrix> J_c = IpCq().curr_jac_c();
+   SmartPtr<const Matrix> J_d = IpCq().curr_jac_d();
+   SmartPtr<const Matrix> Px_L = IpNLP().Px_L();
+   SmartPtr<const Matrix> Px_U = IpNLP().Px_U();
+   SmartPtr<const Matrix> Pd_L = IpNLP().Pd_L();
+   SmartPtr<const Matrix> Pd_U = IpNLP().Pd_U();
+   SmartPtr<const Vector> z_L = IpData().curr()->z_L();
+   SmartPtr<const Vector> z_U = IpData().curr()->z_U();
+   SmartPtr<const Vector> v_L = IpData().curr()->v_L();
+   SmartPtr<const Vector> v_U = IpData().curr()->v_U();
+   SmartPtr<const Vector> slack_x_L = IpCq().curr_slack_x_L();
+   SmartPtr<const Vector> slack_x_U = IpCq().curr_slack_x_U();
+   SmartPtr<const Vector> slack_s_L = IpCq().curr_slack_s_L();
+   SmartPtr<const Vector> slack_s_U = IpCq().curr_slack_s_U();
+   SmartPtr<const Vector> sigma_x = IpCq().curr_sigma_x();
+   SmartPtr<const Vector> sigma_s = IpCq().curr_sigma_s();
+
+   // Solve for all right hand sides at once, this also takes care of the
+   // modifications of the matrix if it has not been factorized yet
+   bool solve_retval = SolveOnce(false, false, *W, *J_c, *J_d, *Px_L, *Px_U, *Pd_L, *Pd_U, *z_L, *z_U, *v_L, *v_U,
+                                 *slack_x_L, *slack_x_U, *slack_s_L, *slack_s_U, *sigma_x, *sigma_s, 1., 0., rhsV, resV);
+   if( !solve_retval )
+   {
+      IpData().TimingStats().PDSystemSolverTotal().End();
+      return false;
+   }
+
+   // no safety checks required
+   if( Jnlst().ProduceOutput(J_MOREDETAILED, J_LINEAR_ALGEBRA) )
+   {
+      for( Index i = 0; i < nrhs; i++ )
+      {
+         SmartPtr<IteratesVector> resid = resV[i]->MakeNewIteratesVector(true);
+         ComputeResiduals(*W, *J_c, *J_d, *Px_L, *Px_U, *Pd_L, *Pd_U, *z_L, *z_U, *v_L, *v_U, *slack_x_L, *slack_x_U,
+                          *slack_s_L, *slack_s_U, *sigma_x, *sigma_s, alpha, beta, *rhsV[i], *resV[i], *resid);
+      }
+   }
+
+   IpData().TimingStats().PDSystemSolverTotal().End();
+
+   // Finally let's assemble the res result vectors
+   for( Index i = 0; i < nrhs; i++ )
+   {
+      if( alpha != 0. )
+      {
+         resV[i]->Scal(alpha);
+      }
+      if( beta != 0. )
+      {
+         resV[i]->Axpy(beta, *copy_resV[i]);
+      }
+   }
+
+   return true;
+}
+
 bool PDFullSpaceSolver::SolveOnce(
    bool                  resolve_with_better_quality,
    bool                  pretend_singular,
@@ -397,6 +488,40 @@ bool PDFullSpaceSolver::SolveOnce(
    const IteratesVector& rhs,
    IteratesVector&       res
 )
+{
+   std::vector<SmartPtr<const IteratesVector> > rhsV(1);
+   rhsV[0] = &rhs;
+   std::vector<SmartPtr<IteratesVector> > resV(1);
+   resV[0] = &res;
+   return SolveOnce(resolve_with_better_quality, pretend_singular, W, J_c, J_d, Px_L, Px_U, Pd_L, Pd_U, z_L, z_U, v_L,
+                    v_U, slack_x_L, slack_x_U, slack_s_L, slack_s_U, sigma_x, sigma_s, alpha, beta, rhsV, resV);
+}
+
+bool PDFullSpaceSolver::SolveOnce(
+   bool                                                resolve_with_better_quality,
+   bool                                                pretend_singular,
+   const SymMatrix&                                    W,
+   const Matrix&                                       J_c,
+   const Matrix&                                       J_d,
+   const Matrix&                                       Px_L,
+   const Matrix&                                       Px_U,
+   const Matrix&                                       Pd_L,
+   const Matrix&                                       Pd_U,
+   const Vector&                                       z_L,
+   const Vector&                                       z_U,
+   const Vector&                                       v_L,
+   const Vector&                                       v_U,
+   const Vector&                                       slack_x_L,
+   const Vector&                                       slack_x_U,
+   const Vector&                                       slack_s_L,
+   const Vector&                                       slack_s_U,
+   const Vector&                                       sigma_x,
+   const Vector&                                       sigma_s,
+   Number                                              alpha,
+   Number                                              beta,
+   const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+   std::vector<SmartPtr<IteratesVector> >&             resV
+)
 {
    // TO DO LIST:
    //
@@ -412,17 +537,45 @@ bool PDFullSpaceSolver::SolveOnce(
 
    IpData().TimingStats().PDSystemSolverSolveOnce().Start();
 
-   // Compute the right hand side for the augmented system formulation
-   SmartPtr<Vector> augRhs_x = rhs.x()->MakeNewCopy();
-   Px_L.AddMSinvZ(1.0, slack_x_L, *rhs.z_L(), *augRhs_x);
-   Px_U.AddMSinvZ(-1.0, slack_x_U, *rhs.z_U(), *augRhs_x);
-
-   SmartPtr<Vector> augRhs_s = rhs.s()->MakeNewCopy();
-   Pd_L.AddMSinvZ(1.0, slack_s_L, *rhs.v_L(), *augRhs_s);
-   Pd_U.AddMSinvZ(-1.0, slack_s_U, *rhs.v_U(), *augRhs_s);
-
-   // Get space into which we can put the solution of the augmented system
-   SmartPtr<IteratesVector> sol = res.MakeNewIteratesVector(true);
+   const Index nrhs = (Index) rhsV.size();
+   DBG_ASSERT(nrhs > 0 && nrhs == (Index) resV.size());
+   const IteratesVector& rhs = *rhsV[0];
+
+   // Compute the right hand sides for the augmented system formulation
+   // and get space into which we can put the solutions of the augmented
+   // system
+   std::vector<SmartPtr<const Vector> > augRhs_xV(nrhs);
+   std::vector<SmartPtr<const Vector> > augRhs_sV(nrhs);
+   std::vector<SmartPtr<const Vector> > rhs_cV(nrhs);
+   std::vector<SmartPtr<const Vector> > rhs_dV(nrhs);
+   std::vector<SmartPtr<IteratesVector> > solV(nrhs);
+   std::vector<SmartPtr<Vector> > sol_xV(nrhs);
+   std::vector<SmartPtr<Vector> > sol_sV(nrhs);
+   std::vector<SmartPtr<Vector> > sol_cV(nrhs);
+   std::vector<SmartPtr<Vector> > sol_dV(nrhs);
+   for( Index i = 0; i < nrhs; i++ )
+   {
+      SmartPtr<Vector> augRhs_x = rhsV[i]->x()->MakeNewCopy();
+      Px_L.AddMSinvZ(1.0, slack_x_L, *rhsV[i]->z_L(), *augRhs_x);
+      Px_U.AddMSinvZ(-1.0, slack_x_U, *rhsV[i]->z_U(), *augRhs_x);
+      augRhs_xV[i] = ConstPtr(augRhs_x);
+
+      SmartPtr<Vector> augRhs_s = rhsV[i]->s()->MakeNewCopy();
+      Pd_L.AddMSinvZ(1.0, slack_s_L, *rhsV[i]->v_L(), *augRhs_s);
+      Pd_U.AddMSinvZ(-1.0, slack_s_U, *rhsV[i]->v_U(), *augRhs_s);
+      augRhs_sV[i] = ConstPtr(augRhs_s);
+
+      rhs_cV[i] = rhsV[i]->y_c();
+      rhs_dV[i] = rhsV[i]->y_d();
+
+      solV[i] = resV[i]->MakeNewIteratesVector(true);
+      sol_xV[i] = solV[i]->x_NonConst();
+      sol_sV[i] = solV[i]->s_NonConst();
+      sol_cV[i] = solV[i]->y_c_NonConst();
+      sol_dV[i] = solV[i]->y_d_NonConst();
+   }
+   // The inertia heuristic looks at the solution for the first right hand side
+   SmartPtr<const IteratesVector> sol = ConstPtr(solV[0]);
 
    // Now check whether any data has changed
    std::vector<const TaggedObject*> deps(13);
@@ -470,9 +623,8 @@ bool PDFullSpaceSolver::SolveOnce(
       // method has already asked the augSysSolver to increase the
       // quality at the end solve, and we are now getting the solution
       // with that better quality
-      retval = augSysSolver_->Solve(&W, 1.0, &sigma_x, delta_x, &sigma_s, delta_s, &J_c, NULL, delta_c, &J_d, NULL,
-                                    delta_d, *augRhs_x, *augRhs_s, *rhs.y_c(), *rhs.y_d(), *sol->x_NonConst(), *sol->s_NonConst(),
-                                    *sol->y_c_NonConst(), *sol->y_d_NonConst(), false, 0);
+      retval = augSysSolver_->MultiSolve(&W, 1.0, &sigma_x, delta_x, &sigma_s, delta_s, &J_c, NULL, delta_c, &J_d, NULL,
+                                         delta_d, augRhs_xV, augRhs_sV, rhs_cV, rhs_dV, sol_xV, sol_sV, sol_cV, sol_dV, false, 0);
       if( retval != SYMSOLVER_SUCCESS )
       {
          IpData().TimingStats().PDSystemSolverSolveOnce().End();
@@ -516,9 +668,9 @@ bool PDFullSpaceSolver::SolveOnce(
             {
                check_inertia = false;
             }
-            retval = augSysSolver_->Solve(&W, 1.0, &sigma_x, delta_x, &sigma_s, delta_s, &J_c, NULL, delta_c, &J_d,
-                                          NULL, delta_d, *augRhs_x, *augRhs_s, *rhs.y_c(), *rhs.y_d(), *sol->x_NonConst(), *sol->s_NonConst(),
-                                          *sol->y_c_NonConst(), *sol->y_d_NonConst(), check_inertia, numberOfEVals);
+            retval = augSysSolver_->MultiSolve(&W, 1.0, &sigma_x, delta_x, &sigma_s, delta_s, &J_c, NULL, delta_c, &J_d,
+                                               NULL, delta_d, augRhs_xV, augRhs_sV, rhs_cV, rhs_dV, sol_xV, sol_sV, sol_cV, sol_dV,
+                                               check_inertia, numberOfEVals);
          }
          if( retval == SYMSOLVER_FATAL_ERROR )
          {
@@ -641,7 +793,7 @@ bool PDFullSpaceSolver::SolveOnce(
 
       // Some output
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                     "Number of trial factorizations performed: %d\n", count);
+                     "Number of trial factorizations performed: %" IPOPT_INDEX_FORMAT "\n", count);
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
                      "Perturbation parameters: delta_x=%e delta_s=%e\n                         delta_c=%e delta_d=%e\n", delta_x,
                      delta_s, delta_c, delta_d);
@@ -649,14 +801,19 @@ bool PDFullSpaceSolver::SolveOnce(
       IpData().setPDPert(delta_x, delta_s, delta_c, delta_d);
    }
 
-   // Compute the remaining sol Vectors
-   Px_L.SinvBlrmZMTdBr(-1., slack_x_L, *rhs.z_L(), z_L, *sol->x(), *sol->z_L_NonConst());
-   Px_U.SinvBlrmZMTdBr(1., slack_x_U, *rhs.z_U(), z_U, *sol->x(), *sol->z_U_NonConst());
-   Pd_L.SinvBlrmZMTdBr(-1., slack_s_L, *rhs.v_L(), v_L, *sol->s(), *sol->v_L_NonConst());
-   Pd_U.SinvBlrmZMTdBr(1., slack_s_U, *rhs.v_U(), v_U, *sol->s(), *sol->v_U_NonConst());
-
-   // Finally let's assemble the res result vectors
-   res.AddOneVector(alpha, *sol, beta);
+   for( Index i = 0; i < nrhs; i++ )
+   {
+      // Compute the remaining sol Vectors
+      const IteratesVector& rhs_i = *rhsV[i];
+      IteratesVector& sol_i = *solV[i];
+      Px_L.SinvBlrmZMTdBr(-1., slack_x_L, *rhs_i.z_L(), z_L, *sol_i.x(), *sol_i.z_L_NonConst());
+      Px_U.SinvBlrmZMTdBr(1., slack_x_U, *rhs_i.z_U(), z_U, *sol_i.x(), *sol_i.z_U_NonConst());
+      Pd_L.SinvBlrmZMTdBr(-1., slack_s_L, *rhs_i.v_L(), v_L, *sol_i.s(), *sol_i.v_L_NonConst());
+      Pd_U.SinvBlrmZMTdBr(1., slack_s_U, *rhs_i.v_U(), v_U, *sol_i.s(), *sol_i.v_U_NonConst());
+
+      // Finally let's assemble the res result vectors
+      resV[i]->AddOneVector(alpha, sol_i, beta);
+   }
 
    IpData().TimingStats().PDSystemSolverSolveOnce().End();
 
@@ -61,6 +61,20 @@ public:
       bool                  improve_solution = false
    );
 
+   /** Solve the primal dual system for several right hand sides.
+    *
+    *  If allow_inexact is true, all right hand sides are passed to one
+    *  backsolve of the augmented system solver.  Otherwise, each right
+    *  hand side is solved by Solve, including iterative refinement.
+    */
+   virtual bool MultiSolve(
+      Number                                              alpha,
+      Number                                              beta,
+      const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+      std::vector<SmartPtr<IteratesVector> >&             resV,
+      bool                                                allow_inexact = false
+   );
+
    /** Methods for IpoptType */
    //@{
    static void RegisterOptions(
@@ -172,6 +186,35 @@ private:
       IteratesVector&       res
    );
 
+   /** Like SolveOnce, but for several right hand sides, which are
+    *  passed together to the augmented system solver.
+    */
+   bool SolveOnce(
+      bool                                                resolve_unmodified,
+      bool                                                pretend_singular,
+      const SymMatrix&                                    W,
+      const Matrix&                                       J_c,
+      const Matrix&                                       J_d,
+      const Matrix&                                       Px_L,
+      const Matrix&                                       Px_U,
+      const Matrix&                                       Pd_L,
+      const Matrix&                                       Pd_U,
+      const Vector&                                       z_L,
+      const Vector&                                       z_U,
+      const Vector&                                       v_L,
+      const Vector&                                       v_U,
+      const Vector&                                       slack_x_L,
+      const Vector&                                       slack_x_U,
+      const Vector&                                       slack_s_L,
+      const Vector&                                       slack_s_U,
+      const Vector&                                       sigma_x,
+      const Vector&                                       sigma_s,
+      Number                                              alpha,
+      Number                                              beta,
+      const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+      std::vector<SmartPtr<IteratesVector> >&             resV
+   );
+
    /** Internal function for computing the residual (resid) given the
     * right hand side (rhs) and the solution of the system (res).
     */
@@ -254,6 +254,8 @@ bool PDPerturbationHandler::PerturbForSingularity(
    DBG_START_METH("PDPerturbationHandler::PerturbForSingularity",
                   dbg_verbosity);
 
+   IpData().LinearSolverStats().RecordInertiaCorrection();
+
    bool retval;
 
    // Check for structural degeneracy
@@ -428,6 +430,8 @@ bool PDPerturbationHandler::PerturbForWrongInertia(
    DBG_START_METH("PDPerturbationHandler::PerturbForWrongInertia",
                   dbg_verbosity);
 
+   IpData().LinearSolverStats().RecordInertiaCorrection();
+
    // Check if we can conclude that components of the system are
    // structurally degenerate (we only get here if the most recent
    // perturbation for a test did not result in a singular system)
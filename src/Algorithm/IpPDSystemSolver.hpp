@@ -114,6 +114,33 @@ public:
       bool                  improve_solution = false
    ) = 0;
 
+   /** Solve the primal dual system for several right hand sides.
+    *
+    *  The meaning of alpha, beta, and allow_inexact is as in Solve.
+    *  The default implementation solves for one right hand side after
+    *  the other.
+    *
+    *  @return false, if a solution could not be computed for one of
+    *  the right hand sides
+    */
+   virtual bool MultiSolve(
+      Number                                              alpha,
+      Number                                              beta,
+      const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+      std::vector<SmartPtr<IteratesVector> >&             resV,
+      bool                                                allow_inexact = false
+   )
+   {
+      for( size_t i = 0; i < rhsV.size(); i++ )
+      {
+         if( !Solve(alpha, beta, *rhsV[i], *resV[i], allow_inexact) )
+         {
+            return false;
+         }
+      }
+      return true;
+   }
+
 private:
    /**@name Default Compiler Generated Methods
     * (Hidden to avoid implicit creation/calling).
@@ -175,13 +175,13 @@ bool QualityFunctionMuOracle::CalculateMu(
    tmp_v_L_ = IpNLP().d_L()->MakeNew();
    tmp_v_U_ = IpNLP().d_U()->MakeNew();
 
-   /////////////////////////////////////
-   // Compute the affine scaling step //
-   /////////////////////////////////////
+   ///////////////////////////////////////////////////////
+   // Compute the affine scaling and the centering step //
+   ///////////////////////////////////////////////////////
 
    Jnlst().Printf(J_DETAILED, J_BARRIER_UPDATE,
-                  "Solving the Primal Dual System for the affine step\n");
-   // First get the right hand side
+                  "Solving the Primal Dual System for the affine step and the centering step\n");
+   // First get the right hand side for the affine step
    SmartPtr<IteratesVector> rhs_aff = IpData().curr()->MakeNewIteratesVector(false);
    rhs_aff->Set_x(*IpCq().curr_grad_lag_x());
    rhs_aff->Set_s(*IpCq().curr_grad_lag_s());
@@ -195,29 +195,9 @@ bool QualityFunctionMuOracle::CalculateMu(
    // Get space for the affine scaling step
    SmartPtr<IteratesVector> step_aff = IpData().curr()->MakeNewIteratesVector(true);
 
-   // Now solve the primal-dual system to get the step.  We allow a
-   // somewhat inexact solution, iterative refinement will be done
-   // after mu is known
-   bool allow_inexact = true;
-   bool retval = pd_solver_->Solve(-1.0, 0.0, *rhs_aff, *step_aff, allow_inexact);
-   if( !retval )
-   {
-      Jnlst().Printf(J_DETAILED, J_BARRIER_UPDATE,
-                     "The linear system could not be solved for the affine step!\n");
-      return false;
-   }
-
-   DBG_PRINT_VECTOR(2, "step_aff", *step_aff);
-
-   /////////////////////////////////////
-   // Compute the pure centering step //
-   /////////////////////////////////////
-
+   // Now the right hand side for the pure centering step
    Number avrg_compl = IpCq().curr_avrg_compl();
 
-   Jnlst().Printf(J_DETAILED, J_BARRIER_UPDATE,
-                  "Solving the Primal Dual System for the centering step\n");
-   // First get the right hand side
    SmartPtr<IteratesVector> rhs_cen = IpData().curr()->MakeNewIteratesVector(true);
    rhs_cen->x_NonConst()->AddOneVector(-avrg_compl, *IpCq().grad_kappa_times_damping_x(), 0.);
    rhs_cen->s_NonConst()->AddOneVector(-avrg_compl, *IpCq().grad_kappa_times_damping_s(), 0.);
@@ -232,16 +212,27 @@ bool QualityFunctionMuOracle::CalculateMu(
    // Get space for the centering step
    SmartPtr<IteratesVector> step_cen = IpData().curr()->MakeNewIteratesVector(true);
 
-   // Now solve the primal-dual system to get the step
-   allow_inexact = true;
-   retval = pd_solver_->Solve(1.0, 0.0, *rhs_cen, *step_cen, allow_inexact);
+   // Now solve the primal-dual system for both right hand sides at once
+   // to get the steps.  We allow a somewhat inexact solution, iterative
+   // refinement will be done after mu is known.  The affine step is
+   // the negative of the solution for rhs_aff.
+   std::vector<SmartPtr<const IteratesVector> > rhsV(2);
+   rhsV[0] = ConstPtr(rhs_aff);
+   rhsV[1] = ConstPtr(rhs_cen);
+   std::vector<SmartPtr<IteratesVector> > stepV(2);
+   stepV[0] = step_aff;
+   stepV[1] = step_cen;
+   bool allow_inexact = true;
+   bool retval = pd_solver_->MultiSolve(1.0, 0.0, rhsV, stepV, allow_inexact);
    if( !retval )
    {
       Jnlst().Printf(J_DETAILED, J_BARRIER_UPDATE,
-                     "The linear system could not be solved for the centering step!\n");
+                     "The linear system could not be solved for the affine and the centering step!\n");
       return false;
    }
+   step_aff->Scal(-1.);
 
+   DBG_PRINT_VECTOR(2, "step_aff", *step_aff);
    DBG_PRINT_VECTOR(2, "step_cen", *step_cen);
 
    // Start the timing for the quality function search here
@@ -380,7 +371,7 @@ bool QualityFunctionMuOracle::CalculateMu(
    //#define tracequalityfunction
 #ifdef tracequalityfunction
    char fname[100];
-   Snprintf(fname, 100, "qf_values_%d.dat", IpData().iter_count());
+   Snprintf(fname, 100, "qf_values_%" IPOPT_INDEX_FORMAT ".dat", IpData().iter_count());
    FILE* fid = fopen(fname, "w");
 
    Number sigma_1 = sigma_max_;
@@ -466,7 +457,7 @@ bool QualityFunctionMuOracle::CalculateMu(
    char ssigma[40];
    Snprintf(ssigma, 39, " sigma=%8.2e", sigma);
    IpData().Append_info_string(ssigma);
-   Snprintf(ssigma, 39, " qf=%d", count_qf_evals_);
+   Snprintf(ssigma, 39, " qf=%" IPOPT_INDEX_FORMAT, count_qf_evals_);
    IpData().Append_info_string(ssigma);
    /*
     Snprintf(ssigma, 39, " xi=%8.2e ", IpCq().curr_centrality_measure());
@@ -72,7 +72,7 @@ void RestoIterationOutput::WriteOutput()
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n\n**************************************************\n");
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "*** Summary of Iteration %d for original NLP:", IpData().iter_count());
+                  "*** Summary of Iteration %" IPOPT_INDEX_FORMAT " for original NLP:", IpData().iter_count());
    Jnlst().Printf(J_DETAILED, J_MAIN,
                   "\n**************************************************\n\n");
    if( IpData().info_iters_since_header() >= 10 && !IsValid(resto_orig_iteration_output_) )
@@ -155,7 +155,7 @@ void RestoIterationOutput::WriteOutput()
             WallclockTime()) - print_frequency_time_ || last_output < 0.0) )
    {
       Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
-                     "%4d%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3d", iter, info_iter, f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr, alpha_dual, alpha_primal, alpha_primal_char, ls_count);
+                     "%4" IPOPT_INDEX_FORMAT "%c%14.7e %7.2e %7.2e %5.1f %7.2e %5s %7.2e %7.2e%c%3" IPOPT_INDEX_FORMAT, iter, info_iter, f, inf_pr, inf_du, log10(mu), dnrm, regu_x_ptr, alpha_dual, alpha_primal, alpha_primal_char, ls_count);
       if( print_info_string_ )
       {
          Jnlst().Printf(J_ITERSUMMARY, J_MAIN,
@@ -182,7 +182,7 @@ void RestoIterationOutput::WriteOutput()
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n**************************************************\n");
       Jnlst().Printf(J_DETAILED, J_MAIN,
-                     "*** Beginning Iteration %d from the following point:", IpData().iter_count());
+                     "*** Beginning Iteration %" IPOPT_INDEX_FORMAT " from the following point:", IpData().iter_count());
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n**************************************************\n\n");
 
@@ -266,7 +266,7 @@ void RestoIterationOutput::WriteOutput()
    if( Jnlst().ProduceOutput(J_DETAILED, J_MAIN) )
    {
       Jnlst().Printf(J_DETAILED, J_MAIN,
-                     "\n\n***Current NLP Values for Iteration (Restoration phase problem) %d:\n", IpData().iter_count());
+                     "\n\n***Current NLP Values for Iteration (Restoration phase problem) %" IPOPT_INDEX_FORMAT ":\n", IpData().iter_count());
       Jnlst().Printf(J_DETAILED, J_MAIN,
                      "\n                                   (scaled)                 (unscaled)\n");
       Jnlst().Printf(J_DETAILED, J_MAIN,
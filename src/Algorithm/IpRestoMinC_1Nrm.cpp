@@ -110,13 +110,14 @@ bool MinC_1NrmRestorationPhase::PerformRestoration()
    // Increase counter for restoration phase calls
    count_restorations_++;
    Jnlst().Printf(J_DETAILED, J_MAIN,
-                  "Starting Restoration Phase for the %d. time\n", count_restorations_);
+                  "Starting Restoration Phase for the %" IPOPT_INDEX_FORMAT ". time\n", count_restorations_);
 
    DBG_ASSERT(IpCq().curr_constraint_violation() > 0.);
 
    // ToDo set those up during initialize?
    // Create the restoration phase NLP etc objects
    SmartPtr<IpoptData> resto_ip_data = new IpoptData(NULL, IpData().cpu_time_start());
+   resto_ip_data->SetLinearSolverStats(&IpData().LinearSolverStats());
    SmartPtr<IpoptNLP> resto_ip_nlp = new RestoIpoptNLP(IpNLP(), IpData(), IpCq());
    SmartPtr<IpoptCalculatedQuantities> resto_ip_cq = new IpoptCalculatedQuantities(resto_ip_nlp, resto_ip_data);
 
@@ -229,7 +230,7 @@ bool MinC_1NrmRestorationPhase::PerformRestoration()
          Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
                         "Optimal Objective Value = %.16E\n", resto_ip_cq->curr_f());
          Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
-                        "Number of Iterations = %d\n", resto_ip_data->iter_count());
+                        "Number of Iterations = %" IPOPT_INDEX_FORMAT "\n", resto_ip_data->iter_count());
       }
       if( Jnlst().ProduceOutput(J_VECTOR, J_LINE_SEARCH) )
       {
@@ -166,7 +166,7 @@ ESymSolverStatus StdAugSystemSolver::MultiSolve(
       augrhs->SetComp(2, *rhs_cV[i]);
       augrhs->SetComp(3, *rhs_dV[i]);
       char buffer[16];
-      Snprintf(buffer, 15, "RHS[%2d]", i);
+      Snprintf(buffer, 15, "RHS[%2" IPOPT_INDEX_FORMAT "]", i);
       augrhs->Print(Jnlst(), J_MOREVECTOR, J_LINEAR_ALGEBRA, buffer);
       augmented_rhsV[i] = GetRawPtr(augrhs);
    }
@@ -187,7 +187,7 @@ ESymSolverStatus StdAugSystemSolver::MultiSolve(
       for( Index dbg_i = 0; dbg_i < dbg_nz; dbg_i++ )
       {
          Jnlst().Printf(J_MOREMATRIX, J_LINEAR_ALGEBRA,
-                        "(%d) KKT[%d][%d] = %23.15e\n", dbg_i, dbg_iRows[dbg_i], dbg_jCols[dbg_i], dbg_values[dbg_i]);
+                        "(%" IPOPT_INDEX_FORMAT ") KKT[%" IPOPT_INDEX_FORMAT "][%" IPOPT_INDEX_FORMAT "] = %23.15e\n", dbg_i, dbg_iRows[dbg_i], dbg_jCols[dbg_i], dbg_values[dbg_i]);
       }
       delete[] dbg_iRows;
       dbg_iRows = NULL;
@@ -219,7 +219,7 @@ ESymSolverStatus StdAugSystemSolver::MultiSolve(
       for( Index i = 0; i < nrhs; i++ )
       {
          char buffer[16];
-         Snprintf(buffer, 15, "SOL[%2d]", i);
+         Snprintf(buffer, 15, "SOL[%2" IPOPT_INDEX_FORMAT "]", i);
          augmented_solV[i]->Print(Jnlst(), J_MOREVECTOR, J_LINEAR_ALGEBRA, buffer);
       }
    }
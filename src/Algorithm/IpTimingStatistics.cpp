@@ -6,9 +6,45 @@
 
 #include "IpTimingStatistics.hpp"
 
+#include <cstdio>
+
 namespace Ipopt
 {
 
+TimingStatistics::TimingStatistics()
+   : trace_enabled_(false),
+     iteration_(0)
+{
+   OverallAlgorithm_.SetRecorder("OverallAlgorithm", this);
+   PrintProblemStatistics_.SetRecorder("PrintProblemStatistics", this);
+   InitializeIterates_.SetRecorder("InitializeIterates", this);
+   UpdateHessian_.SetRecorder("UpdateHessian", this);
+   OutputIteration_.SetRecorder("OutputIteration", this);
+   UpdateBarrierParameter_.SetRecorder("UpdateBarrierParameter", this);
+   ComputeSearchDirection_.SetRecorder("ComputeSearchDirection", this);
+   ComputeAcceptableTrialPoint_.SetRecorder("ComputeAcceptableTrialPoint", this);
+   AcceptTrialPoint_.SetRecorder("AcceptTrialPoint", this);
+   CheckConvergence_.SetRecorder("CheckConvergence", this);
+   PDSystemSolverTotal_.SetRecorder("PDSystemSolverTotal", this);
+   PDSystemSolverSolveOnce_.SetRecorder("PDSystemSolverSolveOnce", this);
+   ComputeResiduals_.SetRecorder("ComputeResiduals", this);
+   StdAugSystemSolverMultiSolve_.SetRecorder("StdAugSystemSolverMultiSolve", this);
+   LinearSystemScaling_.SetRecorder("LinearSystemScaling", this);
+   LinearSystemSymbolicFactorization_.SetRecorder("LinearSystemSymbolicFactorization", this);
+   LinearSystemFactorization_.SetRecorder("LinearSystemFactorization", this);
+   LinearSystemBackSolve_.SetRecorder("LinearSystemBackSolve", this);
+   LinearSystemStructureConverter_.SetRecorder("LinearSystemStructureConverter", this);
+   LinearSystemStructureConverterInit_.SetRecorder("LinearSystemStructureConverterInit", this);
+   QualityFunctionSearch_.SetRecorder("QualityFunctionSearch", this);
+   TryCorrector_.SetRecorder("TryCorrector", this);
+   Task1_.SetRecorder("Task1", this);
+   Task2_.SetRecorder("Task2", this);
+   Task3_.SetRecorder("Task3", this);
+   Task4_.SetRecorder("Task4", this);
+   Task5_.SetRecorder("Task5", this);
+   Task6_.SetRecorder("Task6", this);
+}
+
 void TimingStatistics::ResetTimes()
 {
    OverallAlgorithm_.Reset();
@@ -39,6 +75,129 @@ void TimingStatistics::ResetTimes()
    Task4_.Reset();
    Task5_.Reset();
    Task6_.Reset();
+
+   iteration_ = 0;
+   depth_.clear();
+   spans_.clear();
+}
+
+void TimingStatistics::TaskStarted(
+   const TimedTask& /*task*/
+)
+{
+   if( !trace_enabled_ )
+   {
+      return;
+   }
+
+   size_t thread = (size_t) IpGetThreadNum();
+#ifdef _OPENMP
+   #pragma omp critical(IpoptTimingStatistics)
+#endif
+   {
+      if( depth_.size() <= thread )
+      {
+         depth_.resize(thread + 1, 0);
+      }
+      ++depth_[thread];
+   }
+}
+
+void TimingStatistics::TaskEnded(
+   const TimedTask& task,
+   Number           start_walltime,
+   Number           cputime,
+   Number           walltime
+)
+{
+   if( !trace_enabled_ )
+   {
+      return;
+   }
+
+   Span span;
+   span.task = &task;
+   span.iteration = iteration_;
+   span.thread = IpGetThreadNum();
+   span.start_walltime = start_walltime;
+   span.cputime = cputime;
+   span.walltime = walltime;
+
+   size_t thread = (size_t) span.thread;
+#ifdef _OPENMP
+   #pragma omp critical(IpoptTimingStatistics)
+#endif
+   {
+      // a task that was started before the trace was enabled has depth 0
+      span.depth = 0;
+      if( thread < depth_.size() && depth_[thread] > 0 )
+      {
+         span.depth = --depth_[thread];
+      }
+      spans_.push_back(span);
+   }
+}
+
+/** Write a string as JSON string literal. */
+static void WriteJsonString(
+   FILE*              fp,
+   const std::string& str
+)
+{
+   fputc('"', fp);
+   for( std::string::const_iterator c = str.begin(); c != str.end(); ++c )
+   {
+      if( *c == '"' || *c == '\\' )
+      {
+         fputc('\\', fp);
+      }
+      fputc(*c, fp);
+   }
+   fputc('"', fp);
+}
+
+bool TimingStatistics::WriteTrace(
+   const std::string& filename,
+   bool               chrome_format
+) const
+{
+   FILE* fp = fopen(filename.c_str(), "w");
+   if( fp == NULL )
+   {
+      return false;
+   }
+
+   // report start times relative to the earliest recorded execution
+   Number t0 = 0.;
+   for( std::vector<Span>::const_iterator it = spans_.begin(); it != spans_.end(); ++it )
+   {
+      if( it == spans_.begin() || it->start_walltime < t0 )
+      {
+         t0 = it->start_walltime;
+      }
+   }
+
+   fprintf(fp, chrome_format ? "{\"traceEvents\":[" : "{\"spans\":[");
+   for( std::vector<Span>::const_iterator it = spans_.begin(); it != spans_.end(); ++it )
+   {
+      fprintf(fp, it == spans_.begin() ? "\n" : ",\n");
+      fprintf(fp, "{\"name\":");
+      WriteJsonString(fp, it->task->Name());
+      if( chrome_format )
+      {
+         // Chrome trace event format expects times in microseconds
+         fprintf(fp, ",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"iteration\":%d,\"depth\":%d,\"cpu\":%.9g}}",
+                 it->thread, 1e6 * (it->start_walltime - t0), 1e6 * it->walltime, (int) it->iteration, (int) it->depth, it->cputime);
+      }
+      else
+      {
+         fprintf(fp, ",\"iteration\":%d,\"depth\":%d,\"thread\":%d,\"start\":%.9g,\"wall\":%.9g,\"cpu\":%.9g}",
+                 (int) it->iteration, (int) it->depth, it->thread, it->start_walltime - t0, it->walltime, it->cputime);
+      }
+   }
+   fprintf(fp, "\n]}\n");
+
+   return fclose(fp) == 0;
 }
 
 void TimingStatistics::PrintAllTimingStatistics(
@@ -11,25 +11,35 @@
 #include "IpJournalist.hpp"
 #include "IpTimedTask.hpp"
 
+#include <string>
+#include <vector>
+
 namespace Ipopt
 {
 /** This class collects all timing statistics for Ipopt.
+ *
+ *  In addition to the accumulated times of each task, it can record
+ *  every individual execution of a task (with iteration number,
+ *  nesting depth, and thread) and write these to a file in JSON or
+ *  Chrome trace event format.
  */
-class IPOPTLIB_EXPORT TimingStatistics: public ReferencedObject
+class IPOPTLIB_EXPORT TimingStatistics: public ReferencedObject, public TimedTaskRecorder
 {
 public:
    /**@name Constructors/Destructors */
    //@{
    /** Default constructor. */
-   TimingStatistics()
-   { }
+   TimingStatistics();
 
    /** Destructor */
    virtual ~TimingStatistics()
    { }
    //@}
 
-   /** Method for resetting all times. */
+   /** Method for resetting all times.
+    *
+    *  This also discards all recorded task executions.
+    */
    void ResetTimes();
 
    /** Method for printing all timing information */
@@ -39,6 +49,48 @@ public:
       EJournalCategory category
    ) const;
 
+   /**@name Methods for tracing individual task executions */
+   //@{
+   /** Enable or disable the recording of task executions. */
+   void EnableTrace(
+      bool enable
+   )
+   {
+      trace_enabled_ = enable;
+   }
+
+   /** Set the iteration number that is attached to recorded executions. */
+   void SetIteration(
+      Index iter
+   )
+   {
+      iteration_ = iter;
+   }
+
+   /** Write recorded task executions to a file.
+    *
+    *  If chrome_format is true, the file is written in the Chrome trace
+    *  event format (as understood by chrome://tracing or Perfetto),
+    *  otherwise as a JSON object with a list of spans.
+    *  Returns false if the file could not be opened.
+    */
+   bool WriteTrace(
+      const std::string& filename,
+      bool               chrome_format
+   ) const;
+
+   virtual void TaskStarted(
+      const TimedTask& task
+   );
+
+   virtual void TaskEnded(
+      const TimedTask& task,
+      Number           start_walltime,
+      Number           cputime,
+      Number           walltime
+   );
+   //@}
+
    /**@name Accessor methods to all timed tasks. */
    //@{
    TimedTask& OverallAlgorithm()
@@ -237,6 +289,28 @@ private:
    TimedTask Task5_;
    TimedTask Task6_;
    //@}
+
+   /** Record of one execution of a task. */
+   struct Span
+   {
+      const TimedTask* task;
+      Index iteration;
+      Index depth;
+      int thread;
+      Number start_walltime;
+      Number cputime;
+      Number walltime;
+   };
+
+   /**@name Data for tracing */
+   //@{
+   bool trace_enabled_;
+   Index iteration_;
+   /** Current nesting depth of tasks per thread. */
+   std::vector<Index> depth_;
+   /** Recorded task executions. */
+   std::vector<Span> spans_;
+   //@}
 };
 
 } // namespace Ipopt
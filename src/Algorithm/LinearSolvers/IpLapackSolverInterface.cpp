@@ -0,0 +1,372 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#include "IpoptConfig.h"
+#include "IpLapackSolverInterface.hpp"
+#include "IpLapack.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Ipopt
+{
+#if IPOPT_VERBOSITY > 0
+static const Index dbg_verbosity = 0;
+#endif
+
+/** Assemble the lower triangle of the matrix given by the triplets
+ *  airn, ajcn, a into the dense array fact; the entries may be in either
+ *  triangle and may occur more than once.
+ */
+template<class Real>
+static void AssembleLower(
+   Index              n,
+   Index              nonzeros,
+   const Index*       airn,
+   const Index*       ajcn,
+   const double*      a,
+   std::vector<Real>& fact
+)
+{
+   fact.assign((size_t) n * n, 0.);
+   for( Index k = 0; k < nonzeros; ++k )
+   {
+      Index i = airn[k] - 1;
+      Index j = ajcn[k] - 1;
+      if( i < j )
+      {
+         std::swap(i, j);
+      }
+      fact[i + (size_t) j * n] += (Real) a[k];
+   }
+}
+
+/** Count the negative eigenvalues of the blocks of D computed by
+ *  DSYTRF or SSYTRF; a negative entry of ipiv marks the first column
+ *  of a 2x2 block.  Returns false if a block is singular.
+ */
+template<class Real>
+static bool CountNegEVals(
+   const Real*  fact,
+   Index        n,
+   const Index* ipiv,
+   Number       small_pivot,
+   Index&       negevals
+)
+{
+   negevals = 0;
+   for( Index k = 0; k < n; )
+   {
+      const Real* Dk = &fact[k + (size_t) k * n];
+      if( ipiv[k] > 0 )
+      {
+         if( std::abs(Dk[0]) <= small_pivot )
+         {
+            return false;
+         }
+         if( Dk[0] < 0. )
+         {
+            ++negevals;
+         }
+         ++k;
+      }
+      else
+      {
+         const double a = Dk[0];
+         const double b = Dk[1];
+         const double c = Dk[n + 1];
+         const double det = a * c - b * b;
+         // the smallest absolute eigenvalue is |det| divided by the
+         // largest one, which is at most max(|a|,|c|) + |b|
+         if( std::abs(det) <= small_pivot * (Max(std::abs(a), std::abs(c)) + std::abs(b)) )
+         {
+            return false;
+         }
+         if( det < 0. )
+         {
+            ++negevals;
+         }
+         else if( a + c < 0. )
+         {
+            negevals += 2;
+         }
+         k += 2;
+      }
+   }
+   return true;
+}
+
+LapackSolverInterface::LapackSolverInterface()
+   : dim_(0),
+     nonzeros_(0),
+     negevals_(-1),
+     initialized_(false),
+     precision_changed_(false),
+     refactorize_(false),
+     single_precision_(false)
+{
+   DBG_START_METH("LapackSolverInterface::LapackSolverInterface()", dbg_verbosity);
+}
+
+LapackSolverInterface::~LapackSolverInterface()
+{
+   DBG_START_METH("LapackSolverInterface::~LapackSolverInterface()",
+                  dbg_verbosity);
+}
+
+void LapackSolverInterface::RegisterOptions(
+   SmartPtr<RegisteredOptions> roptions
+)
+{
+   roptions->AddLowerBoundedNumberOption(
+      "lapack_small_pivot",
+      "Zero pivot threshold for the linear solver LAPACK.",
+      0.0, false,
+      1e-20,
+      "A 1x1 block of D is considered to be zero if its absolute value is at most this value, "
+      "and a 2x2 block if the smallest absolute value of its eigenvalues is at most this value. "
+      "The matrix is then reported to be singular.");
+}
+
+bool LapackSolverInterface::InitializeImpl(
+   const OptionsList& options,
+   const std::string& prefix
+)
+{
+   options.GetNumericValue("lapack_small_pivot", small_pivot_, prefix);
+   // The following option is registered by TSymLinearSolver
+   std::string precision;
+   options.GetStringValue("factorization_precision", precision, prefix);
+   single_precision_ = (precision == "single");
+   // The following option is registered by OrigIpoptNLP
+   options.GetBoolValue("warm_start_same_structure", warm_start_same_structure_, prefix);
+
+   // Reset all private data
+   initialized_ = false;
+   precision_changed_ = false;
+   refactorize_ = false;
+
+   if( !warm_start_same_structure_ )
+   {
+      dim_ = 0;
+      nonzeros_ = 0;
+   }
+   else
+   {
+      ASSERT_EXCEPTION(dim_ > 0 && nonzeros_ > 0, INVALID_WARMSTART,
+                       "LapackSolverInterface called with warm_start_same_structure, but the problem is solved for the first time.");
+   }
+
+   return true;
+}
+
+ESymSolverStatus LapackSolverInterface::MultiSolve(
+   bool         new_matrix,
+   const Index* airn,
+   const Index* ajcn,
+   Index        nrhs,
+   double*      rhs_vals,
+   bool         check_NegEVals,
+   Index        numberOfNegEVals
+)
+{
+   DBG_START_METH("LapackSolverInterface::MultiSolve", dbg_verbosity);
+   DBG_ASSERT(!check_NegEVals || ProvidesInertia());
+   DBG_ASSERT(initialized_);
+
+   if( precision_changed_ )
+   {
+      DBG_PRINT((1, "Precision has changed.\n"));
+      precision_changed_ = false;
+      // If the precision has been changed but the matrix is not new, we
+      // have to request the values for the matrix again to do the
+      // factorization again.
+      if( !new_matrix )
+      {
+         DBG_PRINT((1, "Ask caller to call again.\n"));
+         refactorize_ = true;
+         return SYMSOLVER_CALL_AGAIN;
+      }
+   }
+
+   // check if a factorization has to be done
+   DBG_PRINT((1, "new_matrix = %d\n", new_matrix));
+   if( new_matrix || refactorize_ )
+   {
+      ESymSolverStatus retval = Factorization(airn, ajcn, check_NegEVals, numberOfNegEVals);
+      if( retval != SYMSOLVER_SUCCESS )
+      {
+         DBG_PRINT((1, "FACTORIZATION FAILED!\n"));
+         return retval;  // Matrix singular or error occurred
+      }
+      refactorize_ = false;
+   }
+
+   // do the backsolve
+   return Backsolve(nrhs, rhs_vals);
+}
+
+double* LapackSolverInterface::GetValuesArrayPtr()
+{
+   DBG_START_METH("LapackSolverInterface::GetValuesArrayPtr", dbg_verbosity);
+   DBG_ASSERT(initialized_);
+
+   if( a_.empty() )
+   {
+      return NULL;
+   }
+   return &a_[0];
+}
+
+ESymSolverStatus LapackSolverInterface::InitializeStructure(
+   Index        dim,
+   Index        nonzeros,
+   const Index* /*airn*/,
+   const Index* /*ajcn*/
+)
+{
+   DBG_START_METH("LapackSolverInterface::InitializeStructure", dbg_verbosity);
+
+   if( !warm_start_same_structure_ )
+   {
+      dim_ = dim;
+      nonzeros_ = nonzeros;
+      a_.assign(nonzeros_, 0.);
+   }
+   else
+   {
+      ASSERT_EXCEPTION(dim_ == dim && nonzeros_ == nonzeros, INVALID_WARMSTART,
+                       "LapackSolverInterface called with warm_start_same_structure, but the problem size has changed.");
+   }
+
+   initialized_ = true;
+
+   return SYMSOLVER_SUCCESS;
+}
+
+ESymSolverStatus LapackSolverInterface::Factorization(
+   const Index* airn,
+   const Index* ajcn,
+   bool         check_NegEVals,
+   Index        numberOfNegEVals
+)
+{
+   DBG_START_METH("LapackSolverInterface::Factorization", dbg_verbosity);
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemFactorization().Start();
+   }
+
+   const Index n = dim_;
+   ipiv_.resize(n);
+   Index info;
+   bool singular;
+   if( single_precision_ )
+   {
+      AssembleLower(n, nonzeros_, airn, ajcn, &a_[0], fact_single_);
+      std::vector<double>().swap(fact_);
+      IpLapackSsytrf(n, &fact_single_[0], n, &ipiv_[0], info);
+      singular = info > 0 || !CountNegEVals(&fact_single_[0], n, &ipiv_[0], small_pivot_, negevals_);
+   }
+   else
+   {
+      AssembleLower(n, nonzeros_, airn, ajcn, &a_[0], fact_);
+      std::vector<float>().swap(fact_single_);
+      IpLapackDsytrf(n, &fact_[0], n, &ipiv_[0], info);
+      singular = info > 0 || !CountNegEVals(&fact_[0], n, &ipiv_[0], small_pivot_, negevals_);
+   }
+
+   if( singular )
+   {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "LAPACK factorization: matrix of dimension %" IPOPT_INDEX_FORMAT " is singular\n", n);
+      if( HaveIpData() )
+      {
+         IpData().TimingStats().LinearSystemFactorization().End();
+      }
+      return SYMSOLVER_SINGULAR;
+   }
+
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "LAPACK factorization: dimension %" IPOPT_INDEX_FORMAT ", %" IPOPT_INDEX_FORMAT " negative eigenvalues\n", n, negevals_);
+
+   if( HaveIpData() )
+   {
+      const Number nn = n;
+      IpData().LinearSolverStats().RecordFactorization((Index) (0.5 * nn * (nn + 1.)), nn * nn * nn / 3.,
+            nn * nn * (single_precision_ ? sizeof(float) : sizeof(double)) + nn * sizeof(Index), 0);
+      IpData().TimingStats().LinearSystemFactorization().End();
+   }
+
+   if( check_NegEVals && (numberOfNegEVals != negevals_) )
+   {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "In LapackSolverInterface::Factorization: negevals_ = %" IPOPT_INDEX_FORMAT ", but numberOfNegEVals = %" IPOPT_INDEX_FORMAT "\n", negevals_,
+                     numberOfNegEVals);
+      return SYMSOLVER_WRONG_INERTIA;
+   }
+
+   return SYMSOLVER_SUCCESS;
+}
+
+ESymSolverStatus LapackSolverInterface::Backsolve(
+   Index   nrhs,
+   double* rhs_vals
+)
+{
+   DBG_START_METH("LapackSolverInterface::Backsolve", dbg_verbosity);
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemBackSolve().Start();
+   }
+
+   if( single_precision_ )
+   {
+      // solve in single precision; the loss of accuracy is recovered by
+      // the iterative refinement of the caller
+      const size_t size = (size_t) dim_ * nrhs;
+      std::vector<float> x(rhs_vals, rhs_vals + size);
+      IpLapackSsytrs(dim_, nrhs, &fact_single_[0], dim_, &ipiv_[0], &x[0], dim_);
+      std::copy(x.begin(), x.end(), rhs_vals);
+   }
+   else
+   {
+      IpLapackDsytrs(dim_, nrhs, &fact_[0], dim_, &ipiv_[0], rhs_vals, dim_);
+   }
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemBackSolve().End();
+   }
+
+   return SYMSOLVER_SUCCESS;
+}
+
+bool LapackSolverInterface::IncreaseQuality()
+{
+   DBG_START_METH("LapackSolverInterface::IncreaseQuality", dbg_verbosity);
+   // the pivoting strategy of DSYTRF is fixed, so only the precision
+   // can be increased
+   if( !single_precision_ )
+   {
+      return false;
+   }
+
+   single_precision_ = false;
+   precision_changed_ = true;
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "Switching LAPACK factorization from single to double precision.\n");
+   return true;
+}
+
+Index LapackSolverInterface::NumberOfNegEVals() const
+{
+   DBG_START_METH("LapackSolverInterface::NumberOfNegEVals", dbg_verbosity);
+   DBG_ASSERT(ProvidesInertia());
+   DBG_ASSERT(initialized_);
+   return negevals_;
+}
+
+} // namespace Ipopt
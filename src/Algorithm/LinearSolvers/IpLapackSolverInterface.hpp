@@ -0,0 +1,199 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#ifndef __IPLAPACKSOLVERINTERFACE_HPP__
+#define __IPLAPACKSOLVERINTERFACE_HPP__
+
+#include "IpSparseSymLinearSolverInterface.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+/** Interface to the dense symmetric indefinite factorization of
+ *  LAPACK, derived from SparseSymLinearSolverInterface.
+ *
+ *  The matrix is assembled into a dense array and factorized by the
+ *  blocked Bunch-Kaufman method of DSYTRF as \f$P A P^T = L D L^T\f$,
+ *  where D is block diagonal with 1x1 and 2x2 blocks.  The inertia is
+ *  obtained from the blocks of D.  This avoids the ordering and
+ *  symbolic analysis of the sparse solvers, which dominate the
+ *  solution time for small linear systems with many nonzeros.
+ *
+ *  If factorization_precision is set to single, SSYTRF is used until
+ *  IncreaseQuality is called for the first time.
+ */
+class LapackSolverInterface: public SparseSymLinearSolverInterface
+{
+public:
+   /** @name Constructor/Destructor */
+   //@{
+   /** Constructor */
+   LapackSolverInterface();
+
+   /** Destructor */
+   virtual ~LapackSolverInterface();
+   //@}
+
+   bool InitializeImpl(
+      const OptionsList& options,
+      const std::string& prefix
+   );
+
+   /** @name Methods for requesting solution of the linear system. */
+   //@{
+   virtual ESymSolverStatus InitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* airn,
+      const Index* ajcn
+   );
+
+   virtual double* GetValuesArrayPtr();
+
+   virtual ESymSolverStatus MultiSolve(
+      bool         new_matrix,
+      const Index* airn,
+      const Index* ajcn,
+      Index        nrhs,
+      double*      rhs_vals,
+      bool         check_NegEVals,
+      Index        numberOfNegEVals
+   );
+
+   virtual Index NumberOfNegEVals() const;
+   //@}
+
+   //* @name Options of Linear solver */
+   //@{
+   /** The pivoting strategy of DSYTRF is fixed, so the quality of the
+    *  solution can only be increased by switching from single to
+    *  double precision.
+    */
+   virtual bool IncreaseQuality();
+
+   virtual bool SinglePrecision() const
+   {
+      return single_precision_;
+   }
+
+   virtual bool ProvidesInertia() const
+   {
+      return true;
+   }
+
+   EMatrixFormat MatrixFormat() const
+   {
+      return Triplet_Format;
+   }
+   //@}
+
+   //@{
+   static void RegisterOptions(
+      SmartPtr<RegisteredOptions> roptions
+   );
+   //@}
+
+private:
+   /**@name Default Compiler Generated Methods
+    * (Hidden to avoid implicit creation/calling).
+    * These methods are not implemented and
+    * we do not want the compiler to implement
+    * them for us, so we declare them private
+    * and do not define them. This ensures that
+    * they will not be implicitly created/called. */
+   //@{
+   /** Copy Constructor */
+   LapackSolverInterface(
+      const LapackSolverInterface&
+   );
+
+   /** Default Assignment Operator */
+   void operator=(
+      const LapackSolverInterface&
+   );
+   //@}
+
+   /** @name Information about the matrix */
+   //@{
+   /** Number of rows and columns of the matrix */
+   Index dim_;
+
+   /** Number of nonzeros of the matrix */
+   Index nonzeros_;
+
+   /** Values of the nonzeros of the matrix */
+   std::vector<double> a_;
+   //@}
+
+   /** @name Information about most recent factorization/solve */
+   //@{
+   /** Number of negative eigenvalues */
+   Index negevals_;
+   //@}
+
+   /** @name Initialization flags */
+   //@{
+   /** Flag indicating if internal data is initialized.
+    *
+    *  For initialization, this object needs to have seen a matrix.
+    */
+   bool initialized_;
+   /** Flag indicating if the matrix has to be refactorized because
+    *  the precision has been changed.
+    */
+   bool precision_changed_;
+   /** Flag that is true if we just requested the values of the
+    *  matrix again (SYMSOLVER_CALL_AGAIN) and have to factorize
+    *  again.
+    */
+   bool refactorize_;
+   //@}
+
+   /** @name Solver specific options */
+   //@{
+   /** Pivots of at most this absolute value are considered to be zero */
+   Number small_pivot_;
+   /** Flag indicating whether the factorization is done in single
+    *  precision by SSYTRF; it is switched off by IncreaseQuality.
+    */
+   bool single_precision_;
+   /** Flag indicating whether the TNLP with identical structure has
+    *  already been solved before.
+    */
+   bool warm_start_same_structure_;
+   //@}
+
+   /** @name Factorization */
+   //@{
+   /** Factors L and D computed by DSYTRF, stored column-wise in the
+    *  lower triangle of a dim_ x dim_ array
+    */
+   std::vector<double> fact_;
+   /** Factors L and D computed by SSYTRF in single precision */
+   std::vector<float> fact_single_;
+   /** Interchanges and block structure of D computed by DSYTRF */
+   std::vector<Index> ipiv_;
+   //@}
+
+   /** @name Internal functions */
+   //@{
+   /** Assemble the matrix in a_ and factorize it. */
+   ESymSolverStatus Factorization(
+      const Index* airn,
+      const Index* ajcn,
+      bool         check_NegEVals,
+      Index        numberOfNegEVals
+   );
+
+   /** Solve with the factors for nrhs right hand sides. */
+   ESymSolverStatus Backsolve(
+      Index   nrhs,
+      double* rhs_vals
+   );
+   //@}
+};
+
+} // namespace Ipopt
+#endif
@@ -0,0 +1,1830 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#include "IpoptConfig.h"
+#include "IpLdlSolverInterface.hpp"
+#include "IpBlas.hpp"
+
+#include <cmath>
+#include <bitset>
+
+namespace Ipopt
+{
+#if IPOPT_VERBOSITY > 0
+static const Index dbg_verbosity = 0;
+#endif
+
+/** Subgraphs with at most this many vertices are not dissected further,
+ *  but ordered by minimum degree.
+ */
+static const Index nd_leaf_size = 64;
+
+/** Number of columns of the blocks in which the update of a
+ *  contribution block is computed.
+ */
+static const Index cb_update_block = 256;
+
+/** Number of fully summed columns of a front that are searched for
+ *  pivots before the other fully summed columns are updated.
+ */
+static const Index panel_size = 32;
+
+/** Fronts with fewer pivots are solved with simple loops, since the
+ *  overhead of the BLAS calls dominates for them.
+ */
+static const Index solve_blas_npiv = 16;
+
+/** Compute the levels of a breadth-first search from root in the
+ *  subgraph of the vertices v with mark[v] == stamp.
+ *
+ *  The vertices of the subgraph must have level -1 on entry.  The
+ *  visited vertices are returned in queue, ordered by level.  Returns
+ *  the number of levels.
+ */
+static Index BreadthFirstLevels(
+   Index                     root,
+   Index                     stamp,
+   const std::vector<Index>& mark,
+   const std::vector<Index>& xadj,
+   const std::vector<Index>& adj,
+   std::vector<Index>&       level,
+   std::vector<Index>&       queue
+)
+{
+   queue.clear();
+   queue.push_back(root);
+   level[root] = 0;
+   Index nlevels = 1;
+   for( size_t head = 0; head < queue.size(); ++head )
+   {
+      const Index v = queue[head];
+      for( Index p = xadj[v]; p < xadj[v + 1]; ++p )
+      {
+         const Index u = adj[p];
+         if( mark[u] == stamp && level[u] < 0 )
+         {
+            level[u] = level[v] + 1;
+            nlevels = level[u] + 1;
+            queue.push_back(u);
+         }
+      }
+   }
+   return nlevels;
+}
+
+/** Order the (at most nd_leaf_size) vertices of a leaf subgraph by
+ *  minimum degree, using the edges within the subgraph only.
+ *
+ *  The vertices v of the subgraph are those with mark[v] == stamp,
+ *  local is used as workspace.
+ */
+static void MinimumDegreeLeaf(
+   const std::vector<Index>& verts,
+   Index                     stamp,
+   const std::vector<Index>& mark,
+   const std::vector<Index>& xadj,
+   const std::vector<Index>& adj,
+   std::vector<Index>&       local,
+   Index*                    order
+)
+{
+   const Index nv = (Index) verts.size();
+   DBG_ASSERT(nv <= nd_leaf_size);
+
+   for( Index i = 0; i < nv; ++i )
+   {
+      local[verts[i]] = i;
+   }
+   std::vector<std::bitset<nd_leaf_size> > graph(nv);
+   for( Index i = 0; i < nv; ++i )
+   {
+      const Index v = verts[i];
+      for( Index p = xadj[v]; p < xadj[v + 1]; ++p )
+      {
+         const Index u = adj[p];
+         if( mark[u] == stamp && u != v )
+         {
+            graph[i].set(local[u]);
+         }
+      }
+   }
+
+   std::bitset<nd_leaf_size> eliminated;
+   for( Index step = 0; step < nv; ++step )
+   {
+      Index best = -1;
+      size_t bestdeg = 0;
+      for( Index i = 0; i < nv; ++i )
+      {
+         if( !eliminated[i] && (best < 0 || graph[i].count() < bestdeg) )
+         {
+            best = i;
+            bestdeg = graph[i].count();
+         }
+      }
+      order[step] = verts[best];
+      eliminated.set(best);
+
+      // the neighbors of the eliminated vertex become a clique
+      const std::bitset<nd_leaf_size> nbrs = graph[best];
+      for( Index i = 0; i < nv; ++i )
+      {
+         if( nbrs[i] )
+         {
+            graph[i] |= nbrs;
+            graph[i].reset(i);
+            graph[i].reset(best);
+         }
+      }
+   }
+}
+
+/** Compute a nested dissection ordering of a graph.
+ *
+ *  Separators are middle levels of breadth-first searches from
+ *  pseudo-peripheral vertices.  order[k] is the vertex at position k.
+ */
+static void NestedDissection(
+   Index                     n,
+   const std::vector<Index>& xadj,
+   const std::vector<Index>& adj,
+   std::vector<Index>&       order
+)
+{
+   order.resize(n);
+   std::vector<Index> mark(n, -1);
+   std::vector<Index> level(n, -1);
+   std::vector<Index> queue;
+   queue.reserve(n);
+
+   // subgraphs that still have to be ordered, and their first position
+   std::vector<std::vector<Index> > parts(1);
+   std::vector<Index> part_start(1, 0);
+   parts[0].resize(n);
+   for( Index i = 0; i < n; ++i )
+   {
+      parts[0][i] = i;
+   }
+
+   Index stamp = 0;
+   while( !parts.empty() )
+   {
+      std::vector<Index> verts;
+      verts.swap(parts.back());
+      parts.pop_back();
+      const Index start = part_start.back();
+      part_start.pop_back();
+      const Index nv = (Index) verts.size();
+
+      ++stamp;
+      for( Index i = 0; i < nv; ++i )
+      {
+         mark[verts[i]] = stamp;
+         level[verts[i]] = -1;
+      }
+
+      if( nv <= nd_leaf_size )
+      {
+         MinimumDegreeLeaf(verts, stamp, mark, xadj, adj, level, &order[start]);
+         continue;
+      }
+
+      // find a pseudo-peripheral vertex, starting from one of minimal degree
+      Index root = verts[0];
+      for( Index i = 1; i < nv; ++i )
+      {
+         if( xadj[verts[i] + 1] - xadj[verts[i]] < xadj[root + 1] - xadj[root] )
+         {
+            root = verts[i];
+         }
+      }
+      Index nlevels = BreadthFirstLevels(root, stamp, mark, xadj, adj, level, queue);
+      for( Index iter = 0; iter < 5; ++iter )
+      {
+         Index cand = queue.back();
+         for( Index i = (Index) queue.size() - 1; i >= 0 && level[queue[i]] == nlevels - 1; --i )
+         {
+            if( xadj[queue[i] + 1] - xadj[queue[i]] < xadj[cand + 1] - xadj[cand] )
+            {
+               cand = queue[i];
+            }
+         }
+         for( size_t i = 0; i < queue.size(); ++i )
+         {
+            level[queue[i]] = -1;
+         }
+         const Index nl = BreadthFirstLevels(cand, stamp, mark, xadj, adj, level, queue);
+         const bool longer = nl > nlevels;
+         nlevels = nl;
+         if( !longer )
+         {
+            break;
+         }
+      }
+
+      const Index nreached = (Index) queue.size();
+      if( nreached < nv )
+      {
+         // the subgraph is not connected: order the component of root first
+         std::vector<Index> rest;
+         rest.reserve(nv - nreached);
+         for( Index i = 0; i < nv; ++i )
+         {
+            if( level[verts[i]] < 0 )
+            {
+               rest.push_back(verts[i]);
+            }
+         }
+         parts.push_back(rest);
+         part_start.push_back(start + nreached);
+         parts.push_back(queue);
+         part_start.push_back(start);
+         continue;
+      }
+
+      if( nlevels < 3 )
+      {
+         // no separator that splits the subgraph
+         for( Index i = 0; i < nv; ++i )
+         {
+            order[start + i] = queue[i];
+         }
+         continue;
+      }
+
+      // separate at the level that halves the subgraph
+      std::vector<Index> count(nlevels, 0);
+      for( Index i = 0; i < nv; ++i )
+      {
+         ++count[level[queue[i]]];
+      }
+      Index sep_level = 1;
+      Index below = count[0];
+      while( sep_level < nlevels - 2 && below + count[sep_level] < (nv + 1) / 2 )
+      {
+         below += count[sep_level];
+         ++sep_level;
+      }
+
+      // vertices of the separator level without a neighbor in the next
+      // level are not needed in the separator
+      std::vector<Index> part_a;
+      std::vector<Index> part_b;
+      std::vector<Index> sep;
+      for( Index i = 0; i < nv; ++i )
+      {
+         const Index v = queue[i];
+         if( level[v] < sep_level )
+         {
+            part_a.push_back(v);
+         }
+         else if( level[v] > sep_level )
+         {
+            part_b.push_back(v);
+         }
+         else
+         {
+            bool separates = false;
+            for( Index p = xadj[v]; p < xadj[v + 1] && !separates; ++p )
+            {
+               separates = mark[adj[p]] == stamp && level[adj[p]] == sep_level + 1;
+            }
+            if( separates )
+            {
+               sep.push_back(v);
+            }
+            else
+            {
+               part_a.push_back(v);
+            }
+         }
+      }
+
+      const Index na = (Index) part_a.size();
+      const Index nb = (Index) part_b.size();
+      for( size_t i = 0; i < sep.size(); ++i )
+      {
+         order[start + na + nb + i] = sep[i];
+      }
+      parts.push_back(part_b);
+      part_start.push_back(start + na);
+      parts.push_back(part_a);
+      part_start.push_back(start);
+   }
+}
+
+/** Compute the elimination tree of the matrix with the rows and
+ *  columns reordered by perm.
+ */
+static void EliminationTree(
+   Index                     n,
+   const std::vector<Index>& xadj,
+   const std::vector<Index>& adj,
+   const std::vector<Index>& perm,
+   const std::vector<Index>& iperm,
+   std::vector<Index>&       parent
+)
+{
+   parent.assign(n, -1);
+   std::vector<Index> ancestor(n, -1);
+   for( Index j = 0; j < n; ++j )
+   {
+      const Index v = perm[j];
+      for( Index p = xadj[v]; p < xadj[v + 1]; ++p )
+      {
+         Index i = iperm[adj[p]];
+         while( i != -1 && i < j )
+         {
+            const Index next = ancestor[i];
+            ancestor[i] = j;
+            if( next == -1 )
+            {
+               parent[i] = j;
+            }
+            i = next;
+         }
+      }
+   }
+}
+
+/** Compute a postorder of a forest. */
+static void TreePostorder(
+   Index                     n,
+   const std::vector<Index>& parent,
+   std::vector<Index>&       post
+)
+{
+   std::vector<Index> head(n, -1);
+   std::vector<Index> next(n, -1);
+   for( Index j = n - 1; j >= 0; --j )
+   {
+      if( parent[j] >= 0 )
+      {
+         next[j] = head[parent[j]];
+         head[parent[j]] = j;
+      }
+   }
+
+   post.resize(n);
+   std::vector<Index> stack;
+   Index k = 0;
+   for( Index j = 0; j < n; ++j )
+   {
+      if( parent[j] >= 0 )
+      {
+         continue;
+      }
+      stack.push_back(j);
+      while( !stack.empty() )
+      {
+         const Index p = stack.back();
+         const Index i = head[p];
+         if( i == -1 )
+         {
+            stack.pop_back();
+            post[k++] = p;
+         }
+         else
+         {
+            head[p] = next[i];
+            stack.push_back(i);
+         }
+      }
+   }
+   DBG_ASSERT(k == n);
+}
+
+/** Decide whether a supernode with ncols columns is formed although
+ *  zeros of its total entries are structural zeros of the factor.
+ */
+static bool RelaxedAmalgamation(
+   Index  ncols,
+   Number zeros,
+   Number total
+)
+{
+   if( ncols <= 4 )
+   {
+      return true;
+   }
+   const Number frac = zeros / total;
+   if( ncols <= 16 )
+   {
+      return frac < 0.8;
+   }
+   if( ncols <= 48 )
+   {
+      return frac < 0.1;
+   }
+   return frac < 0.05;
+}
+
+/** Matrix product with the BLAS routine of the precision of the
+ *  factorization.
+ */
+static inline void Gemm(
+   bool          transa,
+   bool          transb,
+   Index         m,
+   Index         n,
+   Index         k,
+   double        alpha,
+   const double* A,
+   Index         ldA,
+   const double* B,
+   Index         ldB,
+   double        beta,
+   double*       C,
+   Index         ldC
+)
+{
+   IpBlasDgemm(transa, transb, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
+}
+
+static inline void Gemm(
+   bool         transa,
+   bool         transb,
+   Index        m,
+   Index        n,
+   Index        k,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   const float* B,
+   Index        ldB,
+   float        beta,
+   float*       C,
+   Index        ldC
+)
+{
+   IpBlasSgemm(transa, transb, m, n, k, alpha, A, ldA, B, ldB, beta, C, ldC);
+}
+
+/** Triangular solve with the BLAS routine of the precision of the
+ *  factorization.
+ */
+static inline void Trsm(
+   bool          trans,
+   Index         ndim,
+   Index         nrhs,
+   double        alpha,
+   const double* A,
+   Index         ldA,
+   double*       B,
+   Index         ldB
+)
+{
+   IpBlasDtrsm(trans, ndim, nrhs, alpha, A, ldA, B, ldB);
+}
+
+static inline void Trsm(
+   bool         trans,
+   Index        ndim,
+   Index        nrhs,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   float*       B,
+   Index        ldB
+)
+{
+   IpBlasStrsm(trans, ndim, nrhs, alpha, A, ldA, B, ldB);
+}
+
+/** Exchange rows and columns p < q of a symmetric matrix of which the
+ *  lower triangle is stored column-wise in F with leading dimension nf.
+ */
+template<class Real>
+static void SwapSymmetric(
+   std::vector<Real>&  F,
+   Index               nf,
+   Index               p,
+   Index               q,
+   std::vector<Index>& index
+)
+{
+   if( p == q )
+   {
+      return;
+   }
+   DBG_ASSERT(p < q);
+   Real* Fp = &F[(size_t) p * nf];
+   Real* Fq = &F[(size_t) q * nf];
+   for( Index i = 0; i < p; ++i )
+   {
+      std::swap(F[p + (size_t) i * nf], F[q + (size_t) i * nf]);
+   }
+   std::swap(Fp[p], Fq[q]);
+   for( Index i = p + 1; i < q; ++i )
+   {
+      std::swap(Fp[i], F[q + (size_t) i * nf]);
+   }
+   for( Index i = q + 1; i < nf; ++i )
+   {
+      std::swap(Fp[i], Fq[i]);
+   }
+   std::swap(index[p], index[q]);
+}
+
+/** Compute W = L D for the nrows x npiv matrix L, stored column-wise
+ *  with leading dimension ldl, and the block diagonal D given by its
+ *  diagonal and subdiagonal entries in d.
+ */
+template<class Real>
+static void ScaleByD(
+   const Real*        L,
+   Index              ldl,
+   Index              nrows,
+   Index              npiv,
+   const double*      d,
+   std::vector<Real>& W
+)
+{
+   W.resize((size_t) nrows * npiv);
+   for( Index k = 0; k < npiv; )
+   {
+      const Real* Lk = L + (size_t) k * ldl;
+      Real* Wk = &W[(size_t) k * nrows];
+      if( d[2 * k + 1] == 0. )
+      {
+         for( Index i = 0; i < nrows; ++i )
+         {
+            Wk[i] = (Real) (d[2 * k] * Lk[i]);
+         }
+         ++k;
+      }
+      else
+      {
+         const Real* Lk1 = Lk + ldl;
+         Real* Wk1 = Wk + nrows;
+         for( Index i = 0; i < nrows; ++i )
+         {
+            Wk[i] = (Real) (d[2 * k] * Lk[i] + d[2 * k + 1] * Lk1[i]);
+            Wk1[i] = (Real) (d[2 * k + 1] * Lk[i] + d[2 * k + 2] * Lk1[i]);
+         }
+         k += 2;
+      }
+   }
+}
+
+/** Update the columns first to last-1 of the front F with leading
+ *  dimension nf by the pivots in the columns of L, i.e., subtract
+ *  the lower triangle of W L^T in the rows first to nf-1, where W = L D
+ *  has been computed by ScaleByD for these rows.
+ */
+template<class Real>
+static void UpdateFront(
+   Real*                    F,
+   Index                    nf,
+   Index                    first,
+   Index                    last,
+   const Real*              L,
+   Index                    npiv,
+   const std::vector<Real>& W
+)
+{
+   const Index nrows = nf - first;
+   for( Index jb = 0; jb < last - first; jb += cb_update_block )
+   {
+      const Index nb = Min(cb_update_block, last - first - jb);
+      Gemm(false, true, nrows - jb, nb, npiv, -1., &W[jb], nrows, L + first + jb, nf, 1.,
+           F + first + jb + (size_t) (first + jb) * nf, nf);
+   }
+}
+
+LdlSolverInterface::LdlSolverInterface()
+   : dim_(0),
+     nonzeros_(0),
+     negevals_(-1),
+     initialized_(false),
+     pivtol_changed_(false),
+     refactorize_(false),
+     single_precision_(false),
+     nsuper_(0),
+     reusable_symbolic_factorization_(false),
+     maxfront_(0)
+{
+   DBG_START_METH("LdlSolverInterface::LdlSolverInterface()", dbg_verbosity);
+}
+
+LdlSolverInterface::~LdlSolverInterface()
+{
+   DBG_START_METH("LdlSolverInterface::~LdlSolverInterface()",
+                  dbg_verbosity);
+}
+
+void LdlSolverInterface::RegisterOptions(
+   SmartPtr<RegisteredOptions> roptions
+)
+{
+   roptions->AddBoundedNumberOption(
+      "ldl_pivtol",
+      "Pivot tolerance for the linear solver LDL.",
+      0.0, true,
+      0.5, false,
+      1e-8,
+      "A 1x1 pivot is accepted if its absolute value is at least ldl_pivtol times the largest absolute value of the other entries in its column, "
+      "and 2x2 pivots are accepted by an analogous test. "
+      "Pivots that are not accepted are delayed to the next front. "
+      "A smaller number pivots for sparsity, a larger number pivots for stability.");
+   roptions->AddBoundedNumberOption(
+      "ldl_pivtolmax",
+      "Maximum pivot tolerance for the linear solver LDL.",
+      0.0, true,
+      0.5, false,
+      1e-4,
+      "Ipopt may increase pivtol as high as pivtolmax to get a more accurate solution to the linear system.");
+   roptions->AddLowerBoundedNumberOption(
+      "ldl_small_pivot",
+      "Zero pivot threshold for the linear solver LDL.",
+      0.0, false,
+      1e-20,
+      "Pivots of at most this absolute value are considered to be zero. "
+      "If such a pivot cannot be delayed, the matrix is reported to be singular.");
+}
+
+bool LdlSolverInterface::InitializeImpl(
+   const OptionsList& options,
+   const std::string& prefix
+)
+{
+   options.GetNumericValue("ldl_pivtol", pivtol_, prefix);
+   if( options.GetNumericValue("ldl_pivtolmax", pivtolmax_, prefix) )
+   {
+      ASSERT_EXCEPTION(pivtolmax_ >= pivtol_, OPTION_INVALID, "Option \"ldl_pivtolmax\": This value must be between "
+                       "ldl_pivtol and 0.5.");
+   }
+   else
+   {
+      pivtolmax_ = Max(pivtolmax_, pivtol_);
+   }
+   options.GetNumericValue("ldl_small_pivot", small_pivot_, prefix);
+   // The following option is registered by TSymLinearSolver
+   std::string precision;
+   options.GetStringValue("factorization_precision", precision, prefix);
+   single_precision_ = (precision == "single");
+   // The following option is registered by OrigIpoptNLP
+   options.GetBoolValue("warm_start_same_structure", warm_start_same_structure_, prefix);
+
+   // Reset all private data
+   initialized_ = false;
+   pivtol_changed_ = false;
+   refactorize_ = false;
+
+   if( !warm_start_same_structure_ )
+   {
+      dim_ = 0;
+      nonzeros_ = 0;
+   }
+   else
+   {
+      ASSERT_EXCEPTION(dim_ > 0 && nonzeros_ > 0, INVALID_WARMSTART,
+                       "LdlSolverInterface called with warm_start_same_structure, but the problem is solved for the first time.");
+   }
+
+   return true;
+}
+
+ESymSolverStatus LdlSolverInterface::MultiSolve(
+   bool         new_matrix,
+   const Index* /*ia*/,
+   const Index* /*ja*/,
+   Index        nrhs,
+   double*      rhs_vals,
+   bool         check_NegEVals,
+   Index        numberOfNegEVals
+)
+{
+   DBG_START_METH("LdlSolverInterface::MultiSolve", dbg_verbosity);
+   DBG_ASSERT(!check_NegEVals || ProvidesInertia());
+   DBG_ASSERT(initialized_);
+
+   if( pivtol_changed_ )
+   {
+      DBG_PRINT((1, "Pivot tolerance or precision has changed.\n"));
+      pivtol_changed_ = false;
+      // If the pivot tolerance or precision has been changed but the
+      // matrix is not new, we have to request the values for the matrix
+      // again to do the factorization again.
+      if( !new_matrix )
+      {
+         DBG_PRINT((1, "Ask caller to call again.\n"));
+         refactorize_ = true;
+         return SYMSOLVER_CALL_AGAIN;
+      }
+   }
+
+   // check if a factorization has to be done
+   DBG_PRINT((1, "new_matrix = %d\n", new_matrix));
+   if( new_matrix || refactorize_ )
+   {
+      ESymSolverStatus retval = Factorization(check_NegEVals, numberOfNegEVals);
+      if( retval != SYMSOLVER_SUCCESS )
+      {
+         DBG_PRINT((1, "FACTORIZATION FAILED!\n"));
+         return retval;  // Matrix singular or error occurred
+      }
+      refactorize_ = false;
+   }
+
+   // do the backsolve
+   if( single_precision_ )
+   {
+      return Backsolve(nrhs, rhs_vals, nd_l_single_);
+   }
+   return Backsolve(nrhs, rhs_vals, nd_l_);
+}
+
+double* LdlSolverInterface::GetValuesArrayPtr()
+{
+   DBG_START_METH("LdlSolverInterface::GetValuesArrayPtr", dbg_verbosity);
+   DBG_ASSERT(initialized_);
+
+   if( a_.empty() )
+   {
+      return NULL;
+   }
+   return &a_[0];
+}
+
+ESymSolverStatus LdlSolverInterface::InitializeStructure(
+   Index        dim,
+   Index        nonzeros,
+   const Index* ia,
+   const Index* ja
+)
+{
+   DBG_START_METH("LdlSolverInterface::InitializeStructure", dbg_verbosity);
+
+   ESymSolverStatus retval = SYMSOLVER_SUCCESS;
+   if( !warm_start_same_structure_ )
+   {
+      dim_ = dim;
+      nonzeros_ = nonzeros;
+      a_.assign(nonzeros_, 0.);
+
+      reusable_symbolic_factorization_ = false;
+      retval = SymbolicFactorization(ia, ja);
+      if( retval != SYMSOLVER_SUCCESS )
+      {
+         return retval;
+      }
+      reusable_symbolic_factorization_ = true;
+   }
+   else
+   {
+      ASSERT_EXCEPTION(dim_ == dim && nonzeros_ == nonzeros, INVALID_WARMSTART,
+                       "LdlSolverInterface called with warm_start_same_structure, but the problem size has changed.");
+   }
+
+   initialized_ = true;
+
+   return retval;
+}
+
+ESymSolverStatus LdlSolverInterface::ReinitializeStructure(
+   Index        dim,
+   Index        nonzeros,
+   const Index* ia,
+   const Index* ja
+)
+{
+   DBG_START_METH("LdlSolverInterface::ReinitializeStructure", dbg_verbosity);
+
+   if( !reusable_symbolic_factorization_ || warm_start_same_structure_ )
+   {
+      return InitializeStructure(dim, nonzeros, ia, ja);
+   }
+
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "Reusing symbolic factorization of LDL.\n");
+   dim_ = dim;
+   nonzeros_ = nonzeros;
+   initialized_ = true;
+
+   return SYMSOLVER_SUCCESS;
+}
+
+ESymSolverStatus LdlSolverInterface::SymbolicFactorization(
+   const Index* ia,
+   const Index* ja
+)
+{
+   DBG_START_METH("LdlSolverInterface::SymbolicFactorization", dbg_verbosity);
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemSymbolicFactorization().Start();
+   }
+
+   const Index n = dim_;
+
+   // adjacency structure of the matrix without the diagonal
+   std::vector<Index> xadj(n + 1, 0);
+   for( Index i = 0; i < n; ++i )
+   {
+      for( Index p = ia[i]; p < ia[i + 1]; ++p )
+      {
+         const Index j = ja[p];
+         if( j < 0 || j >= n )
+         {
+            Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
+                           "The index of a matrix is out of range.\nPlease check your implementation of the Jacobian and Hessian matrices.\n");
+            if( HaveIpData() )
+            {
+               IpData().TimingStats().LinearSystemSymbolicFactorization().End();
+            }
+            return SYMSOLVER_FATAL_ERROR;
+         }
+         if( j != i )
+         {
+            ++xadj[i + 1];
+            ++xadj[j + 1];
+         }
+      }
+   }
+   for( Index i = 0; i < n; ++i )
+   {
+      xadj[i + 1] += xadj[i];
+   }
+   std::vector<Index> adj(xadj[n]);
+   {
+      std::vector<Index> pos(xadj.begin(), xadj.end() - 1);
+      for( Index i = 0; i < n; ++i )
+      {
+         for( Index p = ia[i]; p < ia[i + 1]; ++p )
+         {
+            const Index j = ja[p];
+            if( j != i )
+            {
+               adj[pos[i]++] = j;
+               adj[pos[j]++] = i;
+            }
+         }
+      }
+   }
+
+   // fill-reducing ordering, followed by a postorder of its elimination
+   // tree, which keeps the fill but makes the supernodes contiguous
+   std::vector<Index> order;
+   NestedDissection(n, xadj, adj, order);
+   iperm_.resize(n);
+   for( Index k = 0; k < n; ++k )
+   {
+      iperm_[order[k]] = k;
+   }
+   std::vector<Index> parent;
+   EliminationTree(n, xadj, adj, order, iperm_, parent);
+   std::vector<Index> post;
+   TreePostorder(n, parent, post);
+   perm_.resize(n);
+   for( Index k = 0; k < n; ++k )
+   {
+      perm_[k] = order[post[k]];
+      iperm_[perm_[k]] = k;
+   }
+   EliminationTree(n, xadj, adj, perm_, iperm_, parent);
+
+   // children of the columns in the elimination tree
+   std::vector<Index> head(n, -1);
+   std::vector<Index> next(n, -1);
+   std::vector<Index> nchildren(n, 0);
+   for( Index j = n - 1; j >= 0; --j )
+   {
+      if( parent[j] >= 0 )
+      {
+         next[j] = head[parent[j]];
+         head[parent[j]] = j;
+         ++nchildren[parent[j]];
+      }
+   }
+
+   // number of nonzeros in each column of the factor, obtained from the
+   // union of the structures of the children
+   std::vector<Index> colcount(n);
+   std::vector<Index> marker(n, -1);
+   {
+      std::vector<std::vector<Index> > colstruct(n);
+      for( Index j = 0; j < n; ++j )
+      {
+         std::vector<Index>& cs = colstruct[j];
+         marker[j] = j;
+         const Index v = perm_[j];
+         for( Index p = xadj[v]; p < xadj[v + 1]; ++p )
+         {
+            const Index i = iperm_[adj[p]];
+            if( i > j && marker[i] != j )
+            {
+               marker[i] = j;
+               cs.push_back(i);
+            }
+         }
+         for( Index c = head[j]; c != -1; c = next[c] )
+         {
+            const std::vector<Index>& ccs = colstruct[c];
+            for( size_t p = 0; p < ccs.size(); ++p )
+            {
+               if( marker[ccs[p]] != j )
+               {
+                  marker[ccs[p]] = j;
+                  cs.push_back(ccs[p]);
+               }
+            }
+            std::vector<Index>().swap(colstruct[c]);
+         }
+         colcount[j] = (Index) cs.size() + 1;
+         if( parent[j] == -1 )
+         {
+            std::vector<Index>().swap(cs);
+         }
+      }
+   }
+
+   // fundamental supernodes, each merged with its last child if this
+   // does not introduce too many zeros
+   sn_first_.clear();
+   std::vector<Number> sn_zeros;
+   for( Index f = 0; f < n; )
+   {
+      Index l = f;
+      while( l + 1 < n && parent[l] == l + 1 && nchildren[l + 1] == 1 && colcount[l] == colcount[l + 1] + 1 )
+      {
+         ++l;
+      }
+      const Index np = l - f + 1;
+      const Index rp = colcount[l] - 1;
+
+      bool merged = false;
+      if( !sn_first_.empty() && parent[f - 1] == f )
+      {
+         const Index nq = f - sn_first_.back();
+         const Index rq = colcount[f - 1] - 1;
+         const Index nm = nq + np;
+         const Number zeros = sn_zeros.back() + (Number) nq * (Number) (np + rp - rq);
+         const Number total = 0.5 * (Number) nm * (Number) (nm + 1) + (Number) nm * (Number) rp;
+         if( RelaxedAmalgamation(nm, zeros, total) )
+         {
+            sn_zeros.back() = zeros;
+            merged = true;
+         }
+      }
+      if( !merged )
+      {
+         sn_first_.push_back(f);
+         sn_zeros.push_back(0.);
+      }
+      f = l + 1;
+   }
+   nsuper_ = (Index) sn_first_.size();
+   sn_first_.push_back(n);
+
+   std::vector<Index> col2sn(n);
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      for( Index j = sn_first_[s]; j < sn_first_[s + 1]; ++j )
+      {
+         col2sn[j] = s;
+      }
+   }
+   sn_parent_.resize(nsuper_);
+   sn_child_ptr_.assign(nsuper_ + 1, 0);
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      const Index pc = parent[sn_first_[s + 1] - 1];
+      sn_parent_[s] = pc >= 0 ? col2sn[pc] : -1;
+      if( sn_parent_[s] >= 0 )
+      {
+         ++sn_child_ptr_[sn_parent_[s] + 1];
+      }
+   }
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      sn_child_ptr_[s + 1] += sn_child_ptr_[s];
+   }
+   sn_child_.resize(sn_child_ptr_[nsuper_]);
+   {
+      std::vector<Index> pos(sn_child_ptr_.begin(), sn_child_ptr_.end() - 1);
+      for( Index s = 0; s < nsuper_; ++s )
+      {
+         if( sn_parent_[s] >= 0 )
+         {
+            sn_child_[pos[sn_parent_[s]]++] = s;
+         }
+      }
+   }
+
+   // rows of the supernodes below their last column
+   sn_rows_ptr_.assign(nsuper_ + 1, 0);
+   sn_rows_.clear();
+   marker.assign(n, -1);
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      const Index l = sn_first_[s + 1] - 1;
+      for( Index j = sn_first_[s]; j <= l; ++j )
+      {
+         const Index v = perm_[j];
+         for( Index p = xadj[v]; p < xadj[v + 1]; ++p )
+         {
+            const Index i = iperm_[adj[p]];
+            if( i > l && marker[i] != s )
+            {
+               marker[i] = s;
+               sn_rows_.push_back(i);
+            }
+         }
+      }
+      for( Index q = sn_child_ptr_[s]; q < sn_child_ptr_[s + 1]; ++q )
+      {
+         const Index c = sn_child_[q];
+         for( Index p = sn_rows_ptr_[c]; p < sn_rows_ptr_[c + 1]; ++p )
+         {
+            const Index i = sn_rows_[p];
+            if( i > l && marker[i] != s )
+            {
+               marker[i] = s;
+               sn_rows_.push_back(i);
+            }
+         }
+      }
+      sn_rows_ptr_[s + 1] = (Index) sn_rows_.size();
+   }
+
+   // assign each nonzero of the matrix to the supernode of its smaller position
+   entry_row_.resize(nonzeros_);
+   entry_col_.resize(nonzeros_);
+   sn_entries_ptr_.assign(nsuper_ + 1, 0);
+   for( Index i = 0; i < n; ++i )
+   {
+      for( Index p = ia[i]; p < ia[i + 1]; ++p )
+      {
+         const Index a = iperm_[i];
+         const Index b = iperm_[ja[p]];
+         entry_row_[p] = Max(a, b);
+         entry_col_[p] = Min(a, b);
+         ++sn_entries_ptr_[col2sn[entry_col_[p]] + 1];
+      }
+   }
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      sn_entries_ptr_[s + 1] += sn_entries_ptr_[s];
+   }
+   sn_entries_.resize(nonzeros_);
+   {
+      std::vector<Index> pos(sn_entries_ptr_.begin(), sn_entries_ptr_.end() - 1);
+      for( Index p = 0; p < nonzeros_; ++p )
+      {
+         sn_entries_[pos[col2sn[entry_col_[p]]]++] = p;
+      }
+   }
+
+   // group the supernodes by their height in the assembly tree; the
+   // fronts of one level do not depend on each other
+   std::vector<Index> height(nsuper_, 0);
+   Index nlevels = 0;
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      if( sn_parent_[s] >= 0 )
+      {
+         height[sn_parent_[s]] = Max(height[sn_parent_[s]], height[s] + 1);
+      }
+      nlevels = Max(nlevels, height[s] + 1);
+   }
+   level_ptr_.assign(nlevels + 1, 0);
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      ++level_ptr_[height[s] + 1];
+   }
+   for( Index l = 0; l < nlevels; ++l )
+   {
+      level_ptr_[l + 1] += level_ptr_[l];
+   }
+   level_nodes_.resize(nsuper_);
+   {
+      std::vector<Index> pos(level_ptr_.begin(), level_ptr_.end() - 1);
+      for( Index s = 0; s < nsuper_; ++s )
+      {
+         level_nodes_[pos[height[s]]++] = s;
+      }
+   }
+
+   nd_nelim_.assign(nsuper_, 0);
+   nd_index_.clear();
+   nd_index_.resize(nsuper_);
+   nd_l_.clear();
+   nd_l_.resize(nsuper_);
+   nd_l_single_.clear();
+   nd_l_single_.resize(nsuper_);
+   nd_dinv_.clear();
+   nd_dinv_.resize(nsuper_);
+   nd_negevals_.assign(nsuper_, 0);
+   nd_flops_.assign(nsuper_, 0.);
+   nd_singular_.assign(nsuper_, 0);
+   cb_.clear();
+   cb_.resize(nsuper_);
+   cb_single_.clear();
+   cb_single_.resize(nsuper_);
+   cb_index_.clear();
+   cb_index_.resize(nsuper_);
+   cb_ndelay_.assign(nsuper_, 0);
+
+   if( Jnlst().ProduceOutput(J_DETAILED, J_LINEAR_ALGEBRA) )
+   {
+      Number nnz = 0.;
+      Index maxfront = 0;
+      for( Index s = 0; s < nsuper_; ++s )
+      {
+         const Number nc = sn_first_[s + 1] - sn_first_[s];
+         const Number nr = sn_rows_ptr_[s + 1] - sn_rows_ptr_[s];
+         nnz += 0.5 * nc * (nc + 1.) + nc * nr;
+         maxfront = Max(maxfront, (Index) (nc + nr));
+      }
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "LDL symbolic factorization: %" IPOPT_INDEX_FORMAT " supernodes in %" IPOPT_INDEX_FORMAT " levels, largest front %" IPOPT_INDEX_FORMAT ", predicted nonzeros in factor %.0f\n",
+                     nsuper_, nlevels, maxfront, nnz);
+   }
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemSymbolicFactorization().End();
+   }
+
+   return SYMSOLVER_SUCCESS;
+}
+
+template<class Real>
+bool LdlSolverInterface::FactorizeFront(
+   Index                            s,
+   Index*                           map,
+   std::vector<std::vector<Real> >& nd_l,
+   std::vector<std::vector<Real> >& cb
+)
+{
+   const Index first = sn_first_[s];
+   const Index ncols = sn_first_[s + 1] - first;
+   Index ndelay = 0;
+   for( Index q = sn_child_ptr_[s]; q < sn_child_ptr_[s + 1]; ++q )
+   {
+      ndelay += cb_ndelay_[sn_child_[q]];
+   }
+   // number of fully summed variables and size of the front
+   const Index nfs = ncols + ndelay;
+   const Index nf = nfs + sn_rows_ptr_[s + 1] - sn_rows_ptr_[s];
+
+   // the fully summed variables are the columns of the supernode and
+   // the pivots delayed by the children
+   std::vector<Index>& index = nd_index_[s];
+   index.resize(nf);
+   Index pos = 0;
+   for( Index j = 0; j < ncols; ++j )
+   {
+      index[pos++] = first + j;
+   }
+   for( Index q = sn_child_ptr_[s]; q < sn_child_ptr_[s + 1]; ++q )
+   {
+      const Index c = sn_child_[q];
+      for( Index i = 0; i < cb_ndelay_[c]; ++i )
+      {
+         index[pos++] = cb_index_[c][i];
+      }
+   }
+   for( Index p = sn_rows_ptr_[s]; p < sn_rows_ptr_[s + 1]; ++p )
+   {
+      index[pos++] = sn_rows_[p];
+   }
+   for( Index p = 0; p < nf; ++p )
+   {
+      map[index[p]] = p;
+   }
+
+   // assemble the lower triangle of the front from the matrix and the
+   // contribution blocks of the children
+   std::vector<Real> F((size_t) nf * nf, 0.);
+   for( Index e = sn_entries_ptr_[s]; e < sn_entries_ptr_[s + 1]; ++e )
+   {
+      const Index k = sn_entries_[e];
+      const Index r = map[entry_row_[k]];
+      const Index c = map[entry_col_[k]];
+      if( r >= c )
+      {
+         F[r + (size_t) c * nf] += a_[k];
+      }
+      else
+      {
+         F[c + (size_t) r * nf] += a_[k];
+      }
+   }
+   for( Index q = sn_child_ptr_[s]; q < sn_child_ptr_[s + 1]; ++q )
+   {
+      const Index c = sn_child_[q];
+      const std::vector<Index>& cindex = cb_index_[c];
+      const std::vector<Real>& cvals = cb[c];
+      const Index m = (Index) cindex.size();
+      for( Index jj = 0; jj < m; ++jj )
+      {
+         const Index pj = map[cindex[jj]];
+         const Real* col = &cvals[(size_t) jj * m];
+         for( Index ii = jj; ii < m; ++ii )
+         {
+            const Index pi = map[cindex[ii]];
+            if( pi >= pj )
+            {
+               F[pi + (size_t) pj * nf] += col[ii];
+            }
+            else
+            {
+               F[pj + (size_t) pi * nf] += col[ii];
+            }
+         }
+      }
+      std::vector<Real>().swap(cb[c]);
+      std::vector<Index>().swap(cb_index_[c]);
+   }
+
+   // eliminate the fully summed variables with threshold pivoting; the
+   // pivots are chosen in panels of columns, which are updated right
+   // away, while the other fully summed columns are updated after each
+   // panel and the remaining block after all pivots have been chosen
+   const Number u = pivtol_;
+   const bool is_root = sn_parent_[s] < 0;
+   std::vector<double> d(2 * nfs, 0.);
+   std::vector<Real> W;
+   Index negevals = 0;
+   Number flops = 0.;
+   bool singular = false;
+   bool done = false;
+   Index k = 0;
+   Index pe = 0;
+   while( k < nfs && !done )
+   {
+      // the panel consists of the columns that could not be eliminated
+      // in the previous panel and the next panel_size columns
+      const Index ps = k;
+      pe = Min(nfs, pe + panel_size);
+      while( k < pe )
+      {
+         Index piv = -1;
+         Index piv2 = -1;
+         for( Index j = k; j < pe && piv < 0; ++j )
+         {
+            const Real* Fj = &F[(size_t) j * nf];
+            const double ajj = Fj[j];
+            // largest off-diagonal entry in column j, and row r of the
+            // largest one in the panel
+            double gamma = 0.;
+            double maxfs = 0.;
+            Index r = -1;
+            for( Index i = k; i < j; ++i )
+            {
+               const double v = std::abs(F[j + (size_t) i * nf]);
+               gamma = Max(gamma, v);
+               if( v > maxfs )
+               {
+                  maxfs = v;
+                  r = i;
+               }
+            }
+            for( Index i = j + 1; i < nf; ++i )
+            {
+               const double v = std::abs(Fj[i]);
+               gamma = Max(gamma, v);
+               if( i < pe && v > maxfs )
+               {
+                  maxfs = v;
+                  r = i;
+               }
+            }
+            if( std::abs(ajj) > small_pivot_ && std::abs(ajj) >= u * gamma )
+            {
+               piv = j;
+               continue;
+            }
+            if( r < 0 || maxfs <= small_pivot_ )
+            {
+               continue;
+            }
+
+            // try the 2x2 pivot of j and r
+            const Real* Fr = &F[(size_t) r * nf];
+            const double arr = Fr[r];
+            const double arj = r > j ? Fj[r] : Fr[j];
+            const double det = ajj * arr - arj * arj;
+            if( std::abs(det) <= small_pivot_ * Max(std::abs(arj), Max(std::abs(ajj), std::abs(arr))) )
+            {
+               continue;
+            }
+            double gj = 0.;
+            double gr = 0.;
+            for( Index i = k; i < nf; ++i )
+            {
+               if( i == j || i == r )
+               {
+                  continue;
+               }
+               gj = Max(gj, std::abs(i < j ? F[j + (size_t) i * nf] : Fj[i]));
+               gr = Max(gr, std::abs(i < r ? F[r + (size_t) i * nf] : Fr[i]));
+            }
+            const double i11 = arr / det;
+            const double i12 = -arj / det;
+            const double i22 = ajj / det;
+            if( u * (std::abs(i11) * gj + std::abs(i12) * gr) <= 1. && u * (std::abs(i12) * gj + std::abs(i22) * gr) <= 1. )
+            {
+               piv = j;
+               piv2 = r;
+            }
+         }
+
+         if( piv < 0 )
+         {
+            if( pe < nfs )
+            {
+               // try again with the next columns added to the panel
+               break;
+            }
+            if( is_root )
+            {
+               // there is no parent to delay to, so take the largest
+               // remaining diagonal entry
+               double amax = small_pivot_;
+               for( Index j = k; j < nfs; ++j )
+               {
+                  if( std::abs(F[j + (size_t) j * nf]) > amax )
+                  {
+                     amax = std::abs(F[j + (size_t) j * nf]);
+                     piv = j;
+                  }
+               }
+            }
+            if( piv < 0 )
+            {
+               // delay the remaining variables to the parent
+               singular = is_root;
+               done = true;
+               break;
+            }
+         }
+
+         if( piv2 < 0 )
+         {
+            SwapSymmetric(F, nf, k, piv, index);
+            Real* Fk = &F[(size_t) k * nf];
+            const double dk = Fk[k];
+            const Real rdk = (Real) (1. / dk);
+            for( Index j = k + 1; j < pe; ++j )
+            {
+               const Real ljk = Fk[j] * rdk;
+               if( ljk == 0. )
+               {
+                  continue;
+               }
+               Real* Fj = &F[(size_t) j * nf];
+               for( Index i = j; i < nf; ++i )
+               {
+                  Fj[i] -= Fk[i] * ljk;
+               }
+            }
+            for( Index i = k + 1; i < nf; ++i )
+            {
+               Fk[i] *= rdk;
+            }
+            Fk[k] = 1.;
+            d[2 * k] = dk;
+            d[2 * k + 1] = 0.;
+            if( dk < 0. )
+            {
+               ++negevals;
+            }
+            flops += (Number) (pe - k - 1) * (Number) (2 * nf - k - pe);
+            ++k;
+         }
+         else
+         {
+            SwapSymmetric(F, nf, k, piv, index);
+            if( piv2 == k )
+            {
+               piv2 = piv;
+            }
+            SwapSymmetric(F, nf, k + 1, piv2, index);
+            Real* Fk = &F[(size_t) k * nf];
+            Real* Fk1 = &F[(size_t) (k + 1) * nf];
+            const double a = Fk[k];
+            const double b = Fk[k + 1];
+            const double c = Fk1[k + 1];
+            const double det = a * c - b * b;
+            const Real i11 = (Real) (c / det);
+            const Real i12 = (Real) (-b / det);
+            const Real i22 = (Real) (a / det);
+            for( Index j = k + 2; j < pe; ++j )
+            {
+               const Real w1 = i11 * Fk[j] + i12 * Fk1[j];
+               const Real w2 = i12 * Fk[j] + i22 * Fk1[j];
+               Real* Fj = &F[(size_t) j * nf];
+               for( Index i = j; i < nf; ++i )
+               {
+                  Fj[i] -= Fk[i] * w1 + Fk1[i] * w2;
+               }
+            }
+            for( Index i = k + 2; i < nf; ++i )
+            {
+               const Real f1 = Fk[i];
+               const Real f2 = Fk1[i];
+               Fk[i] = f1 * i11 + f2 * i12;
+               Fk1[i] = f1 * i12 + f2 * i22;
+            }
+            Fk[k] = 1.;
+            Fk[k + 1] = 0.;
+            Fk1[k + 1] = 1.;
+            d[2 * k] = a;
+            d[2 * k + 1] = b;
+            d[2 * k + 2] = c;
+            d[2 * k + 3] = 0.;
+            if( det < 0. )
+            {
+               ++negevals;
+            }
+            else if( a + c < 0. )
+            {
+               negevals += 2;
+            }
+            flops += 2. * (Number) (pe - k - 2) * (Number) (2 * nf - k - pe - 1);
+            k += 2;
+         }
+      }
+
+      // update the fully summed columns after the panel with its pivots
+      if( k > ps && pe < nfs )
+      {
+         ScaleByD(&F[(size_t) ps * nf + pe], nf, nf - pe, k - ps, &d[2 * ps], W);
+         UpdateFront(&F[0], nf, pe, nfs, &F[(size_t) ps * nf], k - ps, W);
+         flops += (Number) (k - ps) * (Number) (nfs - pe) * (Number) (2 * nf - nfs - pe);
+      }
+   }
+   const Index npiv = k;
+
+   // update the block of the variables that are not fully summed by
+   // C -= L_C D L_C^T
+   const Index nr = nf - nfs;
+   if( nr > 0 && npiv > 0 )
+   {
+      ScaleByD(&F[nfs], nf, nr, npiv, &d[0], W);
+      UpdateFront(&F[0], nf, nfs, nf, &F[0], npiv, W);
+   }
+
+   // keep L and the inverse of D, and pass the remaining block to the parent
+   nd_nelim_[s] = npiv;
+   std::vector<double>& dinv = nd_dinv_[s];
+   dinv.resize(2 * npiv);
+   for( Index kk = 0; kk < npiv; )
+   {
+      if( d[2 * kk + 1] == 0. )
+      {
+         dinv[2 * kk] = 1. / d[2 * kk];
+         dinv[2 * kk + 1] = 0.;
+         ++kk;
+      }
+      else
+      {
+         const double det = d[2 * kk] * d[2 * kk + 2] - d[2 * kk + 1] * d[2 * kk + 1];
+         dinv[2 * kk] = d[2 * kk + 2] / det;
+         dinv[2 * kk + 1] = -d[2 * kk + 1] / det;
+         dinv[2 * kk + 2] = d[2 * kk] / det;
+         dinv[2 * kk + 3] = 0.;
+         kk += 2;
+      }
+   }
+   nd_l[s].assign(F.begin(), F.begin() + (size_t) nf * npiv);
+   nd_negevals_[s] = negevals;
+   nd_flops_[s] = flops + (Number) nr * (Number) nr * (Number) npiv;
+
+   const Index m = is_root ? 0 : nf - npiv;
+   cb_ndelay_[s] = is_root ? 0 : nfs - npiv;
+   cb_index_[s].assign(index.begin() + (nf - m), index.end());
+   cb[s].resize((size_t) m * m);
+   for( Index jj = 0; jj < m; ++jj )
+   {
+      const Real* col = &F[(size_t) (npiv + jj) * nf + npiv];
+      Real* cbcol = &cb[s][(size_t) jj * m];
+      for( Index ii = jj; ii < m; ++ii )
+      {
+         cbcol[ii] = col[ii];
+      }
+   }
+
+   for( Index p = 0; p < nf; ++p )
+   {
+      map[index[p]] = -1;
+   }
+
+   return !singular;
+}
+
+ESymSolverStatus LdlSolverInterface::Factorization(
+   bool  check_NegEVals,
+   Index numberOfNegEVals
+)
+{
+   DBG_START_METH("LdlSolverInterface::Factorization", dbg_verbosity);
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemFactorization().Start();
+   }
+
+   const size_t mapsize = (size_t) IpGetNumThreads() * dim_;
+   if( front_map_.size() < mapsize )
+   {
+      front_map_.assign(mapsize, -1);
+   }
+
+   // process the assembly tree from the leaves to the roots; the fronts
+   // of one level are distributed over the threads
+   const Index nlevels = (Index) level_ptr_.size() - 1;
+   for( Index l = 0; l < nlevels; ++l )
+   {
+      const Index first = level_ptr_[l];
+      const Index last = level_ptr_[l + 1];
+      const Index nthreads = IpNumThreadsForTasks(last - first);
+      IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+      for( Index i = first; i < last; ++i )
+      {
+         const Index s = level_nodes_[i];
+         Index* map = &front_map_[(size_t) IpGetThreadNum() * dim_];
+         if( single_precision_ )
+         {
+            nd_singular_[s] = !FactorizeFront(s, map, nd_l_single_, cb_single_);
+            // release the factor of a previous factorization in double precision
+            std::vector<double>().swap(nd_l_[s]);
+         }
+         else
+         {
+            nd_singular_[s] = !FactorizeFront(s, map, nd_l_, cb_);
+            std::vector<float>().swap(nd_l_single_[s]);
+         }
+      }
+   }
+
+   bool singular = false;
+   negevals_ = 0;
+   Number nnz = 0.;
+   Number flops = 0.;
+   Number memory = 0.;
+   Index delayed = 0;
+   maxfront_ = 0;
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      const Index nf = (Index) nd_index_[s].size();
+      const Index npiv = nd_nelim_[s];
+      singular = singular || nd_singular_[s];
+      negevals_ += nd_negevals_[s];
+      nnz += 0.5 * npiv * (npiv + 1.) + (Number) npiv * (nf - npiv);
+      flops += nd_flops_[s];
+      memory += (Number) nd_l_[s].size() * sizeof(double) + (Number) nd_l_single_[s].size() * sizeof(float)
+                + (Number) nd_dinv_[s].size() * sizeof(double)
+                + (Number) nf * sizeof(Index);
+      delayed += cb_ndelay_[s];
+      maxfront_ = Max(maxfront_, nf);
+   }
+
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "LDL factorization: %.0f nonzeros in factor, %.3e flops, %" IPOPT_INDEX_FORMAT " delayed pivots, largest front %" IPOPT_INDEX_FORMAT ", %" IPOPT_INDEX_FORMAT " negative eigenvalues\n",
+                  nnz, flops, delayed, maxfront_, negevals_);
+
+   if( singular )
+   {
+      if( HaveIpData() )
+      {
+         IpData().TimingStats().LinearSystemFactorization().End();
+      }
+      return SYMSOLVER_SINGULAR;
+   }
+
+   if( HaveIpData() )
+   {
+      IpData().LinearSolverStats().RecordFactorization((Index) nnz, flops, memory, delayed);
+      IpData().TimingStats().LinearSystemFactorization().End();
+   }
+
+   if( check_NegEVals && (numberOfNegEVals != negevals_) )
+   {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "In LdlSolverInterface::Factorization: negevals_ = %" IPOPT_INDEX_FORMAT ", but numberOfNegEVals = %" IPOPT_INDEX_FORMAT "\n", negevals_,
+                     numberOfNegEVals);
+      return SYMSOLVER_WRONG_INERTIA;
+   }
+
+   return SYMSOLVER_SUCCESS;
+}
+
+template<class Real>
+ESymSolverStatus LdlSolverInterface::Backsolve(
+   Index                                  nrhs,
+   double*                                rhs_vals,
+   const std::vector<std::vector<Real> >& nd_l
+)
+{
+   DBG_START_METH("LdlSolverInterface::Backsolve", dbg_verbosity);
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemBackSolve().Start();
+   }
+
+   const Index n = dim_;
+   std::vector<double> y((size_t) n * nrhs);
+   for( Index r = 0; r < nrhs; ++r )
+   {
+      for( Index i = 0; i < n; ++i )
+      {
+         y[i + (size_t) r * n] = rhs_vals[perm_[i] + (size_t) r * n];
+      }
+   }
+
+   // all right hand sides are processed together within each front
+   std::vector<Real> X((size_t) maxfront_ * nrhs);
+
+   // forward substitution with L
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      const std::vector<Index>& index = nd_index_[s];
+      const Index nf = (Index) index.size();
+      const Index npiv = nd_nelim_[s];
+      if( npiv == 0 )
+      {
+         continue;
+      }
+      const Real* L = &nd_l[s][0];
+      if( npiv < solve_blas_npiv )
+      {
+         for( Index r = 0; r < nrhs; ++r )
+         {
+            double* yr = &y[(size_t) r * n];
+            for( Index k = 0; k < npiv; ++k )
+            {
+               const double yk = yr[index[k]];
+               if( yk == 0. )
+               {
+                  continue;
+               }
+               const Real* Lk = L + (size_t) k * nf;
+               for( Index p = k + 1; p < nf; ++p )
+               {
+                  yr[index[p]] -= Lk[p] * yk;
+               }
+            }
+         }
+         continue;
+      }
+      for( Index r = 0; r < nrhs; ++r )
+      {
+         for( Index p = 0; p < nf; ++p )
+         {
+            X[p + (size_t) r * nf] = (Real) y[index[p] + (size_t) r * n];
+         }
+      }
+      Trsm(false, npiv, nrhs, 1., L, nf, &X[0], nf);
+      if( nf > npiv )
+      {
+         Gemm(false, false, nf - npiv, nrhs, npiv, -1., L + npiv, nf, &X[0], nf, 1., &X[npiv], nf);
+      }
+      for( Index r = 0; r < nrhs; ++r )
+      {
+         for( Index p = 0; p < nf; ++p )
+         {
+            y[index[p] + (size_t) r * n] = X[p + (size_t) r * nf];
+         }
+      }
+   }
+
+   // solve with D
+   for( Index s = 0; s < nsuper_; ++s )
+   {
+      const std::vector<Index>& index = nd_index_[s];
+      const std::vector<double>& dinv = nd_dinv_[s];
+      const Index npiv = nd_nelim_[s];
+      for( Index k = 0; k < npiv; )
+      {
+         if( dinv[2 * k + 1] == 0. )
+         {
+            for( Index r = 0; r < nrhs; ++r )
+            {
+               y[index[k] + (size_t) r * n] *= dinv[2 * k];
+            }
+            ++k;
+         }
+         else
+         {
+            for( Index r = 0; r < nrhs; ++r )
+            {
+               double& y1 = y[index[k] + (size_t) r * n];
+               double& y2 = y[index[k + 1] + (size_t) r * n];
+               const double t1 = y1;
+               y1 = dinv[2 * k] * t1 + dinv[2 * k + 1] * y2;
+               y2 = dinv[2 * k + 1] * t1 + dinv[2 * k + 2] * y2;
+            }
+            k += 2;
+         }
+      }
+   }
+
+   // backward substitution with L^T
+   for( Index s = nsuper_ - 1; s >= 0; --s )
+   {
+      const std::vector<Index>& index = nd_index_[s];
+      const Index nf = (Index) index.size();
+      const Index npiv = nd_nelim_[s];
+      if( npiv == 0 )
+      {
+         continue;
+      }
+      const Real* L = &nd_l[s][0];
+      if( npiv < solve_blas_npiv )
+      {
+         for( Index r = 0; r < nrhs; ++r )
+         {
+            double* yr = &y[(size_t) r * n];
+            for( Index k = npiv - 1; k >= 0; --k )
+            {
+               const Real* Lk = L + (size_t) k * nf;
+               double t = yr[index[k]];
+               for( Index p = k + 1; p < nf; ++p )
+               {
+                  t -= Lk[p] * yr[index[p]];
+               }
+               yr[index[k]] = t;
+            }
+         }
+         continue;
+      }
+      for( Index r = 0; r < nrhs; ++r )
+      {
+         for( Index p = 0; p < nf; ++p )
+         {
+            X[p + (size_t) r * nf] = (Real) y[index[p] + (size_t) r * n];
+         }
+      }
+      if( nf > npiv )
+      {
+         Gemm(true, false, npiv, nrhs, nf - npiv, -1., L + npiv, nf, &X[npiv], nf, 1., &X[0], nf);
+      }
+      Trsm(true, npiv, nrhs, 1., L, nf, &X[0], nf);
+      for( Index r = 0; r < nrhs; ++r )
+      {
+         for( Index p = 0; p < npiv; ++p )
+         {
+            y[index[p] + (size_t) r * n] = X[p + (size_t) r * nf];
+         }
+      }
+   }
+
+   for( Index r = 0; r < nrhs; ++r )
+   {
+      for( Index i = 0; i < n; ++i )
+      {
+         rhs_vals[perm_[i] + (size_t) r * n] = y[i + (size_t) r * n];
+      }
+   }
+
+   if( HaveIpData() )
+   {
+      IpData().TimingStats().LinearSystemBackSolve().End();
+   }
+
+   return SYMSOLVER_SUCCESS;
+}
+
+Index LdlSolverInterface::NumberOfNegEVals() const
+{
+   DBG_START_METH("LdlSolverInterface::NumberOfNegEVals", dbg_verbosity);
+   DBG_ASSERT(ProvidesInertia());
+   DBG_ASSERT(initialized_);
+   return negevals_;
+}
+
+bool LdlSolverInterface::IncreaseQuality()
+{
+   DBG_START_METH("LdlSolverInterface::IncreaseQuality", dbg_verbosity);
+   if( single_precision_ )
+   {
+      // the lack of accuracy is most likely caused by the precision
+      // and not by the pivot tolerance
+      single_precision_ = false;
+      pivtol_changed_ = true;
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Switching LDL factorization from single to double precision.\n");
+      return true;
+   }
+   if( pivtol_ == pivtolmax_ )
+   {
+      return false;
+   }
+
+   pivtol_changed_ = true;
+
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "Increasing pivot tolerance for LDL from %7.2e ", pivtol_);
+   pivtol_ = Min(pivtolmax_, pow(pivtol_, 0.75));
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "to %7.2e.\n", pivtol_);
+   return true;
+}
+
+} // namespace Ipopt
@@ -0,0 +1,308 @@
+// Copyright (C) 2020 COIN-OR Foundation
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+
+#ifndef __IPLDLSOLVERINTERFACE_HPP__
+#define __IPLDLSOLVERINTERFACE_HPP__
+
+#include "IpSparseSymLinearSolverInterface.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+/** Interface to Ipopt's own sparse symmetric indefinite solver,
+ *  derived from SparseSymLinearSolverInterface.
+ *
+ *  The matrix is reordered by nested dissection and factorized as
+ *  \f$P A P^T = L D L^T\f$ by a supernodal multifrontal method, where
+ *  D is block diagonal with 1x1 and 2x2 blocks.  Within each front,
+ *  pivots are chosen by a threshold Bunch-Kaufman strategy among the
+ *  fully summed variables; pivots that fail the threshold test are
+ *  delayed to the parent front.  The inertia is obtained from the
+ *  blocks of D.
+ *
+ *  Fronts that are not ancestors of each other are independent.  The
+ *  factorization therefore processes the assembly tree level by level
+ *  from the leaves to the roots and distributes the fronts of each
+ *  level over the threads.
+ *
+ *  If factorization_precision is set to single, L and the contribution
+ *  blocks are computed and stored in single precision.  The first call
+ *  of IncreaseQuality then switches to double precision.
+ */
+class LdlSolverInterface: public SparseSymLinearSolverInterface
+{
+public:
+   /** @name Constructor/Destructor */
+   //@{
+   /** Constructor */
+   LdlSolverInterface();
+
+   /** Destructor */
+   virtual ~LdlSolverInterface();
+   //@}
+
+   bool InitializeImpl(
+      const OptionsList& options,
+      const std::string& prefix
+   );
+
+   /** @name Methods for requesting solution of the linear system. */
+   //@{
+   virtual ESymSolverStatus InitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* ia,
+      const Index* ja
+   );
+
+   virtual ESymSolverStatus ReinitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* ia,
+      const Index* ja
+   );
+
+   virtual double* GetValuesArrayPtr();
+
+   virtual ESymSolverStatus MultiSolve(
+      bool         new_matrix,
+      const Index* ia,
+      const Index* ja,
+      Index        nrhs,
+      double*      rhs_vals,
+      bool         check_NegEVals,
+      Index        numberOfNegEVals
+   );
+
+   virtual Index NumberOfNegEVals() const;
+   //@}
+
+   //* @name Options of Linear solver */
+   //@{
+   virtual bool IncreaseQuality();
+
+   virtual bool SinglePrecision() const
+   {
+      return single_precision_;
+   }
+
+   virtual bool ProvidesInertia() const
+   {
+      return true;
+   }
+
+   EMatrixFormat MatrixFormat() const
+   {
+      return CSR_Format_0_Offset;
+   }
+   //@}
+
+   //@{
+   static void RegisterOptions(
+      SmartPtr<RegisteredOptions> roptions
+   );
+   //@}
+
+private:
+   /**@name Default Compiler Generated Methods
+    * (Hidden to avoid implicit creation/calling).
+    * These methods are not implemented and
+    * we do not want the compiler to implement
+    * them for us, so we declare them private
+    * and do not define them. This ensures that
+    * they will not be implicitly created/called. */
+   //@{
+   /** Copy Constructor */
+   LdlSolverInterface(
+      const LdlSolverInterface&
+   );
+
+   /** Default Assignment Operator */
+   void operator=(
+      const LdlSolverInterface&
+   );
+   //@}
+
+   /** @name Information about the matrix */
+   //@{
+   /** Number of rows and columns of the matrix */
+   Index dim_;
+
+   /** Number of nonzeros of the matrix */
+   Index nonzeros_;
+
+   /** Values of the nonzeros of the matrix */
+   std::vector<double> a_;
+   //@}
+
+   /** @name Information about most recent factorization/solve */
+   //@{
+   /** Number of negative eigenvalues */
+   Index negevals_;
+   //@}
+
+   /** @name Initialization flags */
+   //@{
+   /** Flag indicating if internal data is initialized.
+    *
+    *  For initialization, this object needs to have seen a matrix.
+    */
+   bool initialized_;
+   /** Flag indicating if the matrix has to be refactorized because
+    *  the pivot tolerance or the precision has been changed.
+    */
+   bool pivtol_changed_;
+   /** Flag that is true if we just requested the values of the
+    *  matrix again (SYMSOLVER_CALL_AGAIN) and have to factorize
+    *  again.
+    */
+   bool refactorize_;
+   //@}
+
+   /** @name Solver specific options */
+   //@{
+   /** Pivot tolerance */
+   Number pivtol_;
+   /** Maximal pivot tolerance */
+   Number pivtolmax_;
+   /** Pivots of at most this absolute value are considered to be zero */
+   Number small_pivot_;
+   /** Flag indicating whether the factorization is done in single
+    *  precision; it is switched off by IncreaseQuality.
+    */
+   bool single_precision_;
+   /** Flag indicating whether the TNLP with identical structure has
+    *  already been solved before.
+    */
+   bool warm_start_same_structure_;
+   //@}
+
+   /** @name Symbolic factorization
+    *
+    *  Positions in the factorization are the rows and columns of
+    *  the reordered matrix.
+    */
+   //@{
+   /** Row of the matrix for each position in the factorization */
+   std::vector<Index> perm_;
+   /** Position in the factorization for each row of the matrix */
+   std::vector<Index> iperm_;
+
+   /** Number of supernodes */
+   Index nsuper_;
+   /** First position of each supernode (nsuper_+1 entries).
+    *
+    *  Supernodes are numbered in postorder of the assembly tree,
+    *  so that each supernode comes after all its descendants.
+    */
+   std::vector<Index> sn_first_;
+   /** Parent of each supernode in the assembly tree, -1 for roots */
+   std::vector<Index> sn_parent_;
+   /** Start of the children of each supernode in sn_child_ */
+   std::vector<Index> sn_child_ptr_;
+   /** Children of the supernodes */
+   std::vector<Index> sn_child_;
+   /** Start of the rows of each supernode in sn_rows_ */
+   std::vector<Index> sn_rows_ptr_;
+   /** Positions below the last column of each supernode that are
+    *  nonzero in the factor (without delayed pivots)
+    */
+   std::vector<Index> sn_rows_;
+   /** Start of the nonzeros assembled into each supernode in sn_entries_ */
+   std::vector<Index> sn_entries_ptr_;
+   /** Nonzeros of the matrix assembled into the supernodes */
+   std::vector<Index> sn_entries_;
+   /** Larger position of each nonzero of the matrix */
+   std::vector<Index> entry_row_;
+   /** Smaller position of each nonzero of the matrix */
+   std::vector<Index> entry_col_;
+   /** Start of each level of the assembly tree in level_nodes_ */
+   std::vector<Index> level_ptr_;
+   /** Supernodes ordered by their height in the assembly tree */
+   std::vector<Index> level_nodes_;
+   /** Flag indicating that the symbolic factorization can be used
+    *  after a new initialization
+    */
+   bool reusable_symbolic_factorization_;
+   //@}
+
+   /** @name Numerical factorization */
+   //@{
+   /** Number of pivots eliminated in each front */
+   std::vector<Index> nd_nelim_;
+   /** Positions of the rows of each front */
+   std::vector<std::vector<Index> > nd_index_;
+   /** Columns of L of each front, stored column-wise with unit diagonal */
+   std::vector<std::vector<double> > nd_l_;
+   /** Columns of L of each front in single precision */
+   std::vector<std::vector<float> > nd_l_single_;
+   /** Inverse of the blocks of D of each front.
+    *
+    *  Entries 2k and 2k+1 hold the diagonal and subdiagonal entry of
+    *  column k of the inverse; a nonzero subdiagonal entry marks the
+    *  first column of a 2x2 block.
+    */
+   std::vector<std::vector<double> > nd_dinv_;
+   /** Number of negative eigenvalues of the pivots of each front */
+   std::vector<Index> nd_negevals_;
+   /** Number of floating point operations for each front */
+   std::vector<Number> nd_flops_;
+   /** Flag indicating that a root front is singular */
+   std::vector<char> nd_singular_;
+   /** Contribution block of each front to its parent, stored column-wise */
+   std::vector<std::vector<double> > cb_;
+   /** Contribution blocks in single precision */
+   std::vector<std::vector<float> > cb_single_;
+   /** Positions of the rows of the contribution blocks */
+   std::vector<std::vector<Index> > cb_index_;
+   /** Number of delayed pivots at the beginning of the contribution blocks */
+   std::vector<Index> cb_ndelay_;
+   /** Per-thread map from positions to rows of the current front */
+   std::vector<Index> front_map_;
+   /** Largest front of the most recent factorization */
+   Index maxfront_;
+   //@}
+
+   /** @name Internal functions */
+   //@{
+   /** Compute ordering, assembly tree, and supernodal structure of the factor. */
+   ESymSolverStatus SymbolicFactorization(
+      const Index* ia,
+      const Index* ja
+   );
+
+   /** Factorize the matrix in a_. */
+   ESymSolverStatus Factorization(
+      bool  check_NegEVals,
+      Index numberOfNegEVals
+   );
+
+   /** Assemble and partially factorize the front of supernode s.
+    *
+    *  The factor and the contribution block are stored in nd_l and cb,
+    *  which determine the precision of the factorization.
+    *  map must have dim_ entries with value -1 and is restored on
+    *  return.  Returns false if s is a root and its front is singular.
+    */
+   template<class Real>
+   bool FactorizeFront(
+      Index                            s,
+      Index*                           map,
+      std::vector<std::vector<Real> >& nd_l,
+      std::vector<std::vector<Real> >& cb
+   );
+
+   /** Solve with the factors nd_l for nrhs right hand sides. */
+   template<class Real>
+   ESymSolverStatus Backsolve(
+      Index                                  nrhs,
+      double*                                rhs_vals,
+      const std::vector<std::vector<Real> >& nd_l
+   );
+   //@}
+};
+
+} // namespace Ipopt
+#endif
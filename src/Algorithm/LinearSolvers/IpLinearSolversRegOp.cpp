@@ -12,6 +12,8 @@
 #include "IpRegOptions.hpp"
 #include "IpTSymLinearSolver.hpp"
 
+#include "IpLapackSolverInterface.hpp"
+#include "IpLdlSolverInterface.hpp"
 #include "IpMa27TSolverInterface.hpp"
 #include "IpMa57TSolverInterface.hpp"
 #include "IpMa77SolverInterface.hpp"
@@ -36,6 +38,10 @@ void RegisterOptions_LinearSolvers(
 {
    roptions->SetRegisteringCategory("Linear Solver");
    TSymLinearSolver::RegisterOptions(roptions);
+   roptions->SetRegisteringCategory("LDL Linear Solver");
+   LdlSolverInterface::RegisterOptions(roptions);
+   roptions->SetRegisteringCategory("LAPACK Linear Solver");
+   LapackSolverInterface::RegisterOptions(roptions);
 #if defined(COINHSL_HAS_MA27) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
    roptions->SetRegisteringCategory("MA27 Linear Solver");
    Ma27TSolverInterface::RegisterOptions(roptions);
@@ -44,15 +50,15 @@ void RegisterOptions_LinearSolvers(
    roptions->SetRegisteringCategory("MA57 Linear Solver");
    Ma57TSolverInterface::RegisterOptions(roptions);
 #endif
-#if defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
    roptions->SetRegisteringCategory("MA77 Linear Solver");
    Ma77SolverInterface::RegisterOptions(roptions);
 #endif
-#if defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
    roptions->SetRegisteringCategory("MA86 Linear Solver");
    Ma86SolverInterface::RegisterOptions(roptions);
 #endif
-#if defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
    roptions->SetRegisteringCategory("MA97 Linear Solver");
    Ma97SolverInterface::RegisterOptions(roptions);
 #endif
@@ -40,6 +40,13 @@ public:
       const Index* ajcn
    );
 
+   virtual ESymSolverStatus ReinitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* airn,
+      const Index* ajcn
+   );
+
    virtual double* GetValuesArrayPtr();
 
    virtual ESymSolverStatus MultiSolve(
@@ -174,6 +181,8 @@ private:
    ipfint nsteps_;
    /** MA27's MAXFRT */
    ipfint maxfrt_;
+   /** number of operations estimated by MA27AD */
+   Number ops_;
 
    /** length LA of A */
    ipfint la_;
@@ -184,6 +193,11 @@ private:
    bool la_increase_;
    /** flag indicating that liw should be increased before next factorization */
    bool liw_increase_;
+
+   /** flag indicating that iw_, ikeep_, nsteps_, and maxfrt_ hold a
+    *  symbolic factorization that can be used after a new initialization
+    */
+   bool reusable_symbolic_factorization_;
    //@}
 
    /** @name Internal functions */
@@ -573,7 +573,7 @@ ESymSolverStatus Ma57TSolverInterface::SymbolicFactorization(
    if( wd_info_[0] < 0 )
    {
       Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                     "*** Error from MA57AD *** INFO(0) = %d\n", wd_info_[0]);
+                     "*** Error from MA57AD *** INFO(0) = %" IPOPT_INDEX_FORMAT "\n", wd_info_[0]);
    }
 
    wd_lfact_ = (ma57int) ((Number) wd_info_[8] * ma57_pre_alloc_);
@@ -596,9 +596,9 @@ ESymSolverStatus Ma57TSolverInterface::SymbolicFactorization(
    wd_ifact_ = new ma57int[wd_lifact_];
 
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "Suggested lfact  (*%e):  %d\n", ma57_pre_alloc_, wd_lfact_);
+                  "Suggested lfact  (*%e):  %" IPOPT_INDEX_FORMAT "\n", ma57_pre_alloc_, wd_lfact_);
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "Suggested lifact (*%e):  %d\n", ma57_pre_alloc_, wd_lifact_);
+                  "Suggested lifact (*%e):  %" IPOPT_INDEX_FORMAT "\n", ma57_pre_alloc_, wd_lifact_);
 
    if( HaveIpData() )
    {
@@ -651,12 +651,12 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
 
          wd_lfact_ = (ma57int) ((Number) wd_info_[16] * ma57_pre_alloc_);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "Reallocating memory for MA57: lfact (%d)\n", wd_lfact_);
+                        "Reallocating memory for MA57: lfact (%" IPOPT_INDEX_FORMAT ")\n", wd_lfact_);
 
          if( (size_t) wd_lfact_ > std::numeric_limits<size_t>::max() / sizeof(double) )
          {
             Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                           "Cannot allocate memory of size %d exceeding SIZE_MAX = %u\n", wd_lfact_, std::numeric_limits<size_t>::max());
+                           "Cannot allocate memory of size %" IPOPT_INDEX_FORMAT " exceeding SIZE_MAX = %u\n", wd_lfact_, std::numeric_limits<size_t>::max());
             return SYMSOLVER_FATAL_ERROR;
          }
 
@@ -685,7 +685,7 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
          temp = new ma57int[wd_lifact_];
 
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "Reallocating lifact (%d)\n", wd_lifact_);
+                        "Reallocating lifact (%" IPOPT_INDEX_FORMAT ")\n", wd_lifact_);
 
          double ddmy;
          IPOPT_HSL_FUNC (ma57ed, MA57ED)(&n, &ic, wd_keep_, wd_fact_, &wd_info_[1], &ddmy, &wd_lifact_, wd_ifact_,
@@ -697,7 +697,7 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
       else if( wd_info_[0] < 0 )
       {
          Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                        "Error in MA57BD:  %d\n", wd_info_[0]);
+                        "Error in MA57BD:  %" IPOPT_INDEX_FORMAT "\n", wd_info_[0]);
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
                         "MA57 Error message: %s\n", ma57_err_msg[-wd_info_[1 - 1]]);
          return SYMSOLVER_FATAL_ERROR;
@@ -710,13 +710,13 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
             IpData().TimingStats().LinearSystemFactorization().End();
          }
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                        "System singular, rank = %d\n", wd_info_[25 - 1]);
+                        "System singular, rank = %" IPOPT_INDEX_FORMAT "\n", wd_info_[25 - 1]);
          return SYMSOLVER_SINGULAR;
       }
       else if( wd_info_[0] > 0 )
       {
          Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                        "Warning in MA57BD:  %d\n", wd_info_[0]);
+                        "Warning in MA57BD:  %" IPOPT_INDEX_FORMAT "\n", wd_info_[0]);
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
                         "MA57 Warning message: %s\n", ma57_wrn_msg[wd_info_[1 - 1]]);
          // For now, abort the process so that we don't miss any problems
@@ -726,7 +726,14 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
 
    double peak_mem = 1.0e-3 * ((double) wd_lfact_ * 8.0 + (double) wd_lifact_ * 4.0 + (double) wd_lkeep_ * 4.0);
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "MA57 peak memory use: %dKB\n", (ma57int) (peak_mem));
+                  "MA57 peak memory use: %" IPOPT_INDEX_FORMAT "KB\n", (ma57int) (peak_mem));
+
+   if( HaveIpData() )
+   {
+      // INFO(14): entries in factors, INFO(23): delayed pivots, RINFO(4): operations in elimination
+      IpData().LinearSolverStats().RecordFactorization((Index) wd_info_[14 - 1], wd_rinfo_[4 - 1], 1.0e3 * peak_mem,
+            (Index) wd_info_[23 - 1]);
+   }
 
    // Check whether the number of negative eigenvalues matches the
    // requested count.
@@ -737,7 +744,7 @@ ESymSolverStatus Ma57TSolverInterface::Factorization(
    if( check_NegEVals && (numberOfNegEVals != negevals_) )
    {
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                     "In Ma57TSolverInterface::Factorization: negevals_ = %d, but numberOfNegEVals = %d\n", negevals_, numberOfNegEVals);
+                     "In Ma57TSolverInterface::Factorization: negevals_ = %" IPOPT_INDEX_FORMAT ", but numberOfNegEVals = %" IPOPT_INDEX_FORMAT "\n", negevals_, numberOfNegEVals);
       return SYMSOLVER_WRONG_INERTIA;
    }
 
@@ -787,7 +794,7 @@ ESymSolverStatus Ma57TSolverInterface::Backsolve(
    if( wd_info_[0] != 0 )
    {
       Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                     "Error in MA57CD:  %d.\n", wd_info_[0]);
+                     "Error in MA57CD:  %" IPOPT_INDEX_FORMAT ".\n", wd_info_[0]);
    }
 
    if( DBG_VERBOSITY() >= 2 )
@@ -15,7 +15,7 @@
 #endif
 
 // if we do not have HSL_MA77 in HSL or the linear solver loader, then we want to build the MA77 interface
-#if defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
 #include "IpMa77SolverInterface.hpp"
 #include <iostream>
@@ -365,4 +365,4 @@ bool Ma77SolverInterface::IncreaseQuality()
 
 } // namespace Ipopt
 
-#endif /* COINHSL_HAS_MA77 or IPOPT_HAS_LINEARSOLVERLOADER */
+#endif /* (COINHSL_HAS_MA77 or IPOPT_HAS_LINEARSOLVERLOADER) and not IPOPT_INT64 */
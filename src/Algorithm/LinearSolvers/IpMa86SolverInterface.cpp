@@ -15,7 +15,7 @@
 #endif
 
 // if we do not have MA86 in HSL or the linear solver loader, then we want to build the MA86 interface
-#if defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
 #include "IpMa86SolverInterface.hpp"
 #include <iostream>
@@ -359,4 +359,4 @@ bool Ma86SolverInterface::IncreaseQuality()
 
 } // namespace Ipopt
 
-#endif /* COINHSL_HAS_MA86 or IPOPT_HAS_LINEARSOLVERLOADER */
+#endif /* (COINHSL_HAS_MA86 or IPOPT_HAS_LINEARSOLVERLOADER) and not IPOPT_INT64 */
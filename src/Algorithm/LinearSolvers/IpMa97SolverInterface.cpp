@@ -20,7 +20,7 @@
 #endif
 
 // if we have MA97 in HSL or the linear solver loader, then we want to build the MA97 interface
-#if defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
 #include "IpMa97SolverInterface.hpp"
 #include <iostream>
@@ -688,6 +688,11 @@ ESymSolverStatus Ma97SolverInterface::MultiSolve(
                         "In Ma97SolverInterface::Factorization: Unhandled error. info.flag = %d\n", info.flag);
          return SYMSOLVER_FATAL_ERROR;
       }
+      if( HaveIpData() )
+      {
+         // HSL_MA97 does not report its memory usage
+         IpData().LinearSolverStats().RecordFactorization((Index) info.num_factor, (Number) info.num_flops, -1., info.num_delay);
+      }
       if( check_NegEVals && info.num_neg != numberOfNegEVals )
       {
          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
@@ -760,4 +765,4 @@ bool Ma97SolverInterface::IncreaseQuality()
 
 } // namespace Ipopt
 
-#endif /* COINHSL_HAS_MA97 or IPOPT_HAS_LINEARSOLVERLOADER */
+#endif /* (COINHSL_HAS_MA97 or IPOPT_HAS_LINEARSOLVERLOADER) and not IPOPT_INT64 */
@@ -13,17 +13,21 @@
 // NOTES:
 // - Since Mumps 5.1.0, mumps_->nz should be replaced by mumps_->nnz
 
+// Apart from the configuration, the first header to include is the one for MPI.
+// In newer ThirdParty/Mumps, mpi.h is renamed to mumps_mpi.h.
+// We get informed about this by having COIN_USE_MUMPS_MPI_H defined,
+// either via compiler flags or in our version of mumps_compat.h.
+#include "IpoptConfig.h"
+#include "mumps_compat.h"
+#if defined(IPOPT_MUMPS_NOMPI) || defined(COIN_USE_MUMPS_MPI_H)
 // The following line is a fix for otherwise twice-defined global variable
-// (This would have to be taken out for a parallel MUMPS version!)
+// in the MPI dummy of a sequential MUMPS.
+// (A real mpi.h defines MPI_COMM_WORLD itself.)
 #define MPI_COMM_WORLD IPOPT_MPI_COMM_WORLD
 #ifdef __GNUC__
 #pragma GCC diagnostic ignored "-Wunused-variable"
 #endif
-// The first header to include is the one for MPI.
-// In newer ThirdParty/Mumps, mpi.h is renamed to mumps_mpi.h.
-// We get informed about this by having COIN_USE_MUMPS_MPI_H defined,
-// either via compiler flags or in our version of mumps_compat.h.
-#include "mumps_compat.h"
+#endif
 #ifdef COIN_USE_MUMPS_MPI_H
 #include "mumps_mpi.h"
 #else
@@ -34,8 +38,16 @@
 
 #include "dmumps_c.h"
 
+#include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <limits>
+#include <map>
+#include <vector>
+
+#if defined(IPOPT_INT64) && !defined(MUMPS_INTSIZE64)
+#error "Ipopt with 64-bit integers requires MUMPS to be built with 64-bit integers (-DINTSIZE64)"
+#endif
 
 namespace Ipopt
 {
@@ -46,8 +58,70 @@ static const Index dbg_verbosity = 0;
 #define USE_COMM_WORLD -987654
 
 int MumpsSolverInterface::instancecount_mpi = 0;
+int MumpsSolverInterface::mpi_instance_counter = 0;
+
+#ifndef MUMPS_MPI_H
+#ifdef MUMPS_INTSIZE64
+#define IPOPT_MPI_MUMPS_INT MPI_INT64_T
+#else
+#define IPOPT_MPI_MUMPS_INT MPI_INT
+#endif
+
+/** Job number that makes the MPI service return; not a valid MUMPS job. */
+static const int SERVICE_STOP = 0;
+
+/** Tags of the messages that send a part of the matrix to a process. */
+static const int TAG_IRN = 1;
+static const int TAG_JCN = 2;
+static const int TAG_A = 3;
+
+static MPI_Comm GetMPIComm(
+   int comm_fortran
+)
+{
+   if( comm_fortran == USE_COMM_WORLD )
+   {
+      return MPI_COMM_WORLD;
+   }
+   return MPI_Comm_f2c(comm_fortran);
+}
+
+/** MUMPS instance on a process in the MPI service, together with
+ *  the part of the matrix that this process contributes.
+ */
+struct MumpsServiceInstance
+{
+   DMUMPS_STRUC_C*        data;
+   std::vector<MUMPS_INT> irn;
+   std::vector<MUMPS_INT> jcn;
+   std::vector<double>    a;
+};
+
+/** Receive the part of a distributed matrix array that is sent by the host. */
+template<typename T>
+static void ReceiveFromHost(
+   std::vector<T>& buffer,
+   MPI_Datatype    type,
+   int             tag,
+   MPI_Comm        comm
+)
+{
+   MPI_Status status;
+   int count;
+   MPI_Probe(0, tag, comm, &status);
+   MPI_Get_count(&status, type, &count);
+   buffer.resize(count);
+   MPI_Recv(buffer.empty() ? NULL : &buffer[0], count, type, 0, tag, comm, MPI_STATUS_IGNORE);
+}
+#endif
 
 MumpsSolverInterface::MumpsSolverInterface()
+   : mumps_initialized_(false),
+     mpi_instance_id_(0),
+     mpi_comm_(USE_COMM_WORLD),
+     mpi_size_(1),
+     distributed_matrix_(false),
+     reusable_symbolic_factorization_(false)
 {
    DBG_START_METH("MumpsSolverInterface::MumpsSolverInterface()",
                   dbg_verbosity);
@@ -73,16 +147,8 @@ MumpsSolverInterface::MumpsSolverInterface()
    MPI_Comm_rank(MPI_COMM_WORLD, &myid);
 #endif
 
-   //initialize mumps
+   // mumps is initialized in InitializeImpl, when the communicator is known
    DMUMPS_STRUC_C* mumps_ = (DMUMPS_STRUC_C*) calloc(1, sizeof(DMUMPS_STRUC_C));
-   mumps_->job = -1; //initialize mumps
-   mumps_->par = 1; //working host for sequential version
-   mumps_->sym = 2; //general symetric matrix
-   mumps_->comm_fortran = USE_COMM_WORLD;
-   dmumps_c(mumps_);
-   mumps_->icntl[1] = 0;
-   mumps_->icntl[2] = 0; //QUIETLY!
-   mumps_->icntl[3] = 0;
    mumps_ptr_ = (void*) mumps_;
 }
 
@@ -92,8 +158,10 @@ MumpsSolverInterface::~MumpsSolverInterface()
                   dbg_verbosity);
 
    DMUMPS_STRUC_C* mumps_ = (DMUMPS_STRUC_C*) mumps_ptr_;
-   mumps_->job = -2; //terminate mumps
-   dmumps_c(mumps_);
+   if( mumps_initialized_ )
+   {
+      CallMumps(-2); //terminate mumps
+   }
 #ifndef MUMPS_MPI_H
 #ifdef HAVE_MPI_INITIALIZED
    if( instancecount_mpi == 1 )
@@ -164,6 +232,24 @@ void MumpsSolverInterface::RegisterOptions(
       "When MUMPS is used to determine linearly dependent constraints, "
       "this is determines the threshold for a pivot to be considered zero. "
       "This is CNTL(3) in MUMPS.");
+   roptions->AddIntegerOption(
+      "mumps_mpi_comm",
+      "Fortran handle of the MPI communicator for MUMPS.",
+      USE_COMM_WORLD,
+      "If set to a communicator (as returned by MPI_Comm_c2f), MUMPS runs in parallel on its processes. "
+      "Ipopt has to run on the process with rank 0, while all other processes need to call "
+      "RunIpoptMumpsService with the same communicator. "
+      "For the default value -987654, MUMPS uses MPI_COMM_WORLD and all processes need to run Ipopt. "
+      "This option is only available if Ipopt has been compiled with a parallel version of MUMPS.");
+   roptions->AddStringOption2(
+      "mumps_distributed_matrix",
+      "Whether the matrix is distributed over the MPI processes of MUMPS.",
+      "yes",
+      "no", "the matrix is given to MUMPS on the host process only",
+      "yes", "each process gives a part of the matrix entries to MUMPS",
+      "The host process sends a part of the matrix entries to each process before analysis and factorization. "
+      "This is ICNTL(18)=3 in MUMPS. "
+      "Only relevant if mumps_mpi_comm has been set to a communicator with more than one process.");
 }
 
 bool MumpsSolverInterface::InitializeImpl(
@@ -191,6 +277,51 @@ bool MumpsSolverInterface::InitializeImpl(
    options.GetIntegerValue("mumps_pivot_order", mumps_pivot_order_, prefix);
    options.GetIntegerValue("mumps_scaling", mumps_scaling_, prefix);
    options.GetNumericValue("mumps_dep_tol", mumps_dep_tol_, prefix);
+   Index mpi_comm;
+   options.GetIntegerValue("mumps_mpi_comm", mpi_comm, prefix);
+   bool distributed_matrix;
+   options.GetBoolValue("mumps_distributed_matrix", distributed_matrix, prefix);
+   if( distributed_matrix != distributed_matrix_ )
+   {
+      // the matrix has to be given to MUMPS differently
+      reusable_symbolic_factorization_ = false;
+   }
+   distributed_matrix_ = distributed_matrix;
+
+   DMUMPS_STRUC_C* mumps_ = (DMUMPS_STRUC_C*) mumps_ptr_;
+   if( !mumps_initialized_ || (int) mpi_comm != mpi_comm_ )
+   {
+      if( mumps_initialized_ )
+      {
+         CallMumps(-2); //terminate mumps on previous communicator
+         mumps_initialized_ = false;
+         reusable_symbolic_factorization_ = false;
+      }
+      mpi_comm_ = (int) mpi_comm;
+      mpi_size_ = 1;
+#ifndef MUMPS_MPI_H
+      if( mpi_comm_ != USE_COMM_WORLD )
+      {
+         MPI_Comm comm = GetMPIComm(mpi_comm_);
+         int myid;
+         MPI_Comm_rank(comm, &myid);
+         MPI_Comm_size(comm, &mpi_size_);
+         ASSERT_EXCEPTION(myid == 0, OPTION_INVALID,
+                          "Option \"mumps_mpi_comm\": Ipopt has to run on the process with rank 0 of this communicator.");
+         mpi_instance_id_ = ++mpi_instance_counter;
+      }
+#endif
+
+      //initialize mumps
+      mumps_->par = 1; //working host
+      mumps_->sym = 2; //general symetric matrix
+      mumps_->comm_fortran = mpi_comm_;
+      CallMumps(-1);
+      mumps_->icntl[1] = 0;
+      mumps_->icntl[2] = 0; //QUIETLY!
+      mumps_->icntl[3] = 0;
+      mumps_initialized_ = true;
+   }
 
    // Reset all private data
    initialized_ = false;
@@ -198,7 +329,6 @@ bool MumpsSolverInterface::InitializeImpl(
    refactorize_ = false;
    have_symbolic_factorization_ = false;
 
-   DMUMPS_STRUC_C* mumps_ = (DMUMPS_STRUC_C*) mumps_ptr_;
    if( !warm_start_same_structure_ )
    {
       mumps_->n = 0;
@@ -260,6 +390,7 @@ ESymSolverStatus MumpsSolverInterface::MultiSolve(
             return retval;
          }
          have_symbolic_factorization_ = true;
+         reusable_symbolic_factorization_ = true;
       }
       // perform the factorization
       retval = Factorization(check_NegEVals, numberOfNegEVals);
@@ -291,17 +422,17 @@ void dump_matrix(
    // Dump the matrix
    for (int i = 0; i < 40; i++)
    {
-      printf("%d\n", mumps_data->icntl[i]);
+      printf("%" IPOPT_INDEX_FORMAT "\n", mumps_data->icntl[i]);
    }
    for (int i = 0; i < 5; i++)
    {
       printf("%25.15e\n", mumps_data->cntl[i]);
    }
-   printf("%-15d :N\n", mumps_data->n);
-   printf("%-15d :NZ", mumps_data->nz);
+   printf("%-15" IPOPT_INDEX_FORMAT " :N\n", mumps_data->n);
+   printf("%-15" IPOPT_INDEX_FORMAT " :NZ", mumps_data->nz);
    for (int i = 0; i < mumps_data->nz; i++)
    {
-      printf("\n%d %d %25.15e", mumps_data->irn[i], mumps_data->jcn[i], mumps_data->a[i]);
+      printf("\n%" IPOPT_INDEX_FORMAT " %" IPOPT_INDEX_FORMAT " %25.15e", mumps_data->irn[i], mumps_data->jcn[i], mumps_data->a[i]);
    }
    printf("       :values");
    // Dummy RHS for now
@@ -326,6 +457,12 @@ ESymSolverStatus MumpsSolverInterface::InitializeStructure(
    DBG_START_METH("MumpsSolverInterface::InitializeStructure", dbg_verbosity);
 
    ESymSolverStatus retval = SYMSOLVER_SUCCESS;
+   if( mpi_size_ > 1 && distributed_matrix_ && nonzeros / mpi_size_ >= std::numeric_limits<int>::max() )
+   {
+      Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
+                     "Too many nonzeros in the matrix to distribute them over %d MPI processes.\n", mpi_size_);
+      return SYMSOLVER_FATAL_ERROR;
+   }
    if( !warm_start_same_structure_ )
    {
       mumps_->n = dim;
@@ -334,12 +471,13 @@ ESymSolverStatus MumpsSolverInterface::InitializeStructure(
       mumps_->a = NULL;
 
       mumps_->a = new double[nonzeros];
-      mumps_->irn = const_cast<int*>(ia);
-      mumps_->jcn = const_cast<int*>(ja);
+      mumps_->irn = const_cast<MUMPS_INT*>(ia);
+      mumps_->jcn = const_cast<MUMPS_INT*>(ja);
 
       // make sure we do the symbolic factorization before a real
       // factorization
       have_symbolic_factorization_ = false;
+      reusable_symbolic_factorization_ = false;
    }
    else
    {
@@ -351,6 +489,39 @@ ESymSolverStatus MumpsSolverInterface::InitializeStructure(
    return retval;
 }
 
+ESymSolverStatus MumpsSolverInterface::ReinitializeStructure(
+   Index        dim,
+   Index        nonzeros,
+   const Index* ia,
+   const Index* ja
+)
+{
+   DMUMPS_STRUC_C* mumps_ = (DMUMPS_STRUC_C*) mumps_ptr_;
+   DBG_START_METH("MumpsSolverInterface::ReinitializeStructure", dbg_verbosity);
+
+   if( !reusable_symbolic_factorization_ || warm_start_same_structure_ )
+   {
+      return InitializeStructure(dim, nonzeros, ia, ja);
+   }
+
+   DBG_ASSERT(mumps_->irn == ia);
+   (void) ia;
+   DBG_ASSERT(mumps_->jcn == ja);
+   (void) ja;
+   mumps_->n = dim;
+   mumps_->nz = nonzeros;
+
+   // the pivot tolerance and memory settings may have been increased in the previous solve
+   mumps_->cntl[0] = pivtol_;
+   mumps_->icntl[13] = mem_percent_;
+
+   Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                  "Reusing symbolic factorization of MUMPS.\n");
+   have_symbolic_factorization_ = true;
+   initialized_ = true;
+   return SYMSOLVER_SUCCESS;
+}
+
 ESymSolverStatus MumpsSolverInterface::SymbolicFactorization()
 {
    DBG_START_METH("MumpsSolverInterface::SymbolicFactorization",
@@ -362,8 +533,6 @@ ESymSolverStatus MumpsSolverInterface::SymbolicFactorization()
       IpData().TimingStats().LinearSystemSymbolicFactorization().Start();
    }
 
-   mumps_data->job = 1;      //symbolic ordering pass
-
    //mumps_data->icntl[1] = 6;
    //mumps_data->icntl[2] = 6;//QUIETLY!
    //mumps_data->icntl[3] = 4;
@@ -375,22 +544,23 @@ ESymSolverStatus MumpsSolverInterface::SymbolicFactorization()
 
    mumps_data->icntl[12] = 1;   //avoid lapack bug, ensures proper inertia; mentioned to be very expensive in mumps manual
    mumps_data->icntl[13] = mem_percent_; //% memory to allocate over expected
+   mumps_data->icntl[17] = (mpi_size_ > 1 && distributed_matrix_) ? 3 : 0; //distributed or centralized matrix
    mumps_data->cntl[0] = pivtol_;  // Set pivot tolerance
 
    dump_matrix(mumps_data);
 
    Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                   "Calling MUMPS-1 for symbolic factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
-   dmumps_c(mumps_data);
+   CallMumps(1);      //symbolic ordering pass
    Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                   "Done with MUMPS-1 for symbolic factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
    int error = mumps_data->info[0];
-   const int& mumps_permuting_scaling_used = mumps_data->infog[22];
-   const int& mumps_pivot_order_used = mumps_data->infog[6];
+   const MUMPS_INT& mumps_permuting_scaling_used = mumps_data->infog[22];
+   const MUMPS_INT& mumps_pivot_order_used = mumps_data->infog[6];
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "MUMPS used permuting_scaling %d and pivot_order %d.\n", mumps_permuting_scaling_used, mumps_pivot_order_used);
+                  "MUMPS used permuting_scaling %" IPOPT_INDEX_FORMAT " and pivot_order %" IPOPT_INDEX_FORMAT ".\n", mumps_permuting_scaling_used, mumps_pivot_order_used);
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "           scaling will be %d.\n", mumps_data->icntl[7]);
+                  "           scaling will be %" IPOPT_INDEX_FORMAT ".\n", mumps_data->icntl[7]);
 
    if( HaveIpData() )
    {
@@ -422,12 +592,10 @@ ESymSolverStatus MumpsSolverInterface::Factorization(
    DBG_START_METH("MumpsSolverInterface::Factorization", dbg_verbosity);
    DMUMPS_STRUC_C* mumps_data = (DMUMPS_STRUC_C*) mumps_ptr_;
 
-   mumps_data->job = 2;  //numerical factorization
-
    dump_matrix(mumps_data);
    Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                   "Calling MUMPS-2 for numerical factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
-   dmumps_c(mumps_data);
+   CallMumps(2);  //numerical factorization
    Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                   "Done with MUMPS-2 for numerical factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
    int error = mumps_data->info[0];
@@ -441,17 +609,17 @@ ESymSolverStatus MumpsSolverInterface::Factorization(
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
                         "MUMPS returned INFO(1) = %d and requires more memory, reallocating.  Attempt %d\n", error, trycount + 1);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "  Increasing icntl[13] from %d to ", mumps_data->icntl[13]);
+                        "  Increasing icntl[13] from %" IPOPT_INDEX_FORMAT " to ", mumps_data->icntl[13]);
          double mem_percent = mumps_data->icntl[13];
          mumps_data->icntl[13] = (Index) (2.0 * mem_percent);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "%d.\n", mumps_data->icntl[13]);
+                        "%" IPOPT_INDEX_FORMAT ".\n", mumps_data->icntl[13]);
 
          dump_matrix(mumps_data);
          Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                         "Calling MUMPS-2 (repeated) for numerical factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(),
                         WallclockTime());
-         dmumps_c(mumps_data);
+         CallMumps(2);
          Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                         "Done with MUMPS-2 (repeated) for numerical factorization at cpu time %10.3f (wall %10.3f).\n", CpuTime(),
                         WallclockTime());
@@ -470,9 +638,9 @@ ESymSolverStatus MumpsSolverInterface::Factorization(
    }
 
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "Number of doubles for MUMPS to hold factorization (INFO(9)) = %d\n", mumps_data->info[8]);
+                  "Number of doubles for MUMPS to hold factorization (INFO(9)) = %" IPOPT_INDEX_FORMAT "\n", mumps_data->info[8]);
    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                  "Number of integers for MUMPS to hold factorization (INFO(10)) = %d\n", mumps_data->info[9]);
+                  "Number of integers for MUMPS to hold factorization (INFO(10)) = %" IPOPT_INDEX_FORMAT "\n", mumps_data->info[9]);
 
    if( error == -10 )  //system is singular
    {
@@ -486,7 +654,7 @@ ESymSolverStatus MumpsSolverInterface::Factorization(
    if( error == -13 )
    {
       Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
-                     "MUMPS returned INFO(1) =%d - out of memory when trying to allocate %d %s.\nIn some cases it helps to decrease the value of the option \"mumps_mem_percent\".\n",
+                     "MUMPS returned INFO(1) =%d - out of memory when trying to allocate %" IPOPT_INDEX_FORMAT " %s.\nIn some cases it helps to decrease the value of the option \"mumps_mem_percent\".\n",
                      error, mumps_data->info[1] < 0 ? -mumps_data->info[1] : mumps_data->info[1],
                      mumps_data->info[1] < 0 ? "MB" : "bytes");
       return SYMSOLVER_FATAL_ERROR;
@@ -498,10 +666,19 @@ ESymSolverStatus MumpsSolverInterface::Factorization(
       return SYMSOLVER_FATAL_ERROR;
    }
 
+   if( HaveIpData() )
+   {
+      // INFOG(9): entries in factors (in millions if negative), RINFOG(3): operations in elimination,
+      // INFOG(22): memory in MB used during factorization, INFOG(13): delayed pivots
+      Number nonzeros_in_factor = mumps_data->infog[8] < 0 ? -1e6 * mumps_data->infog[8] : mumps_data->infog[8];
+      IpData().LinearSolverStats().RecordFactorization((Index) Min(nonzeros_in_factor, (Number) std::numeric_limits<Index>::max()),
+            mumps_data->rinfog[2], 1e6 * mumps_data->infog[21], mumps_data->infog[12]);
+   }
+
    if( check_NegEVals && (numberOfNegEVals != negevals_) )
    {
       Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
-                     "In MumpsSolverInterface::Factorization: negevals_ = %d, but numberOfNegEVals = %d\n", negevals_,
+                     "In MumpsSolverInterface::Factorization: negevals_ = %" IPOPT_INDEX_FORMAT ", but numberOfNegEVals = %" IPOPT_INDEX_FORMAT "\n", negevals_,
                      numberOfNegEVals);
       return SYMSOLVER_WRONG_INERTIA;
    }
@@ -525,10 +702,9 @@ ESymSolverStatus MumpsSolverInterface::Solve(
    {
       Index offset = i * mumps_data->n;
       mumps_data->rhs = &(rhs_vals[offset]);
-      mumps_data->job = 3;  //solve
       Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                      "Calling MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
-      dmumps_c(mumps_data);
+      CallMumps(3);  //solve
       Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                      "Done with MUMPS-3 for solve at cpu time %10.3f (wall %10.3f).\n", CpuTime(), WallclockTime());
       int error = mumps_data->info[0];
@@ -598,6 +774,8 @@ ESymSolverStatus MumpsSolverInterface::DetermineDependentRows(
       const Index mumps_scaling_orig = mumps_scaling_;
       mumps_permuting_scaling_ = 0;
       mumps_scaling_ = 6;
+      // this symbolic factorization uses different settings
+      reusable_symbolic_factorization_ = false;
       retval = SymbolicFactorization();
       mumps_permuting_scaling_ = mumps_permuting_scaling_orig;
       mumps_scaling_ = mumps_scaling_orig;
@@ -612,10 +790,9 @@ ESymSolverStatus MumpsSolverInterface::DetermineDependentRows(
    //Set flags to ask MUMPS for checking linearly dependent rows
    mumps_data->icntl[23] = 1;
    mumps_data->cntl[2] = mumps_dep_tol_;
-   mumps_data->job = 2;   //numerical factorization
 
    dump_matrix(mumps_data);
-   dmumps_c(mumps_data);
+   CallMumps(2);   //numerical factorization
    int error = mumps_data->info[0];
 
    //Check for errors
@@ -627,14 +804,14 @@ ESymSolverStatus MumpsSolverInterface::DetermineDependentRows(
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
                         "MUMPS returned INFO(1) = %d and requires more memory, reallocating.  Attempt %d\n", error, trycount + 1);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "  Increasing icntl[13] from %d to ", mumps_data->icntl[13]);
+                        "  Increasing icntl[13] from %" IPOPT_INDEX_FORMAT " to ", mumps_data->icntl[13]);
          double mem_percent = mumps_data->icntl[13];
          mumps_data->icntl[13] = (Index) (2.0 * mem_percent);
          Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
-                        "%d.\n", mumps_data->icntl[13]);
+                        "%" IPOPT_INDEX_FORMAT ".\n", mumps_data->icntl[13]);
 
          dump_matrix(mumps_data);
-         dmumps_c(mumps_data);
+         CallMumps(2);
          error = mumps_data->info[0];
          if( error != -8 && error != -9 )
          {
@@ -670,5 +847,139 @@ ESymSolverStatus MumpsSolverInterface::DetermineDependentRows(
    return SYMSOLVER_SUCCESS;
 }
 
+void MumpsSolverInterface::CallMumps(
+   int job
+)
+{
+   DMUMPS_STRUC_C* mumps_data = (DMUMPS_STRUC_C*) mumps_ptr_;
+
+#ifndef MUMPS_MPI_H
+   if( mpi_size_ > 1 )
+   {
+      MPI_Comm comm = GetMPIComm(mpi_comm_);
+      const bool send_matrix = distributed_matrix_ && (job == 1 || job == 2);
+      int command[3] = { mpi_instance_id_, job, send_matrix ? 1 : 0 };
+      MPI_Bcast(command, 3, MPI_INT, 0, comm);
+
+      if( send_matrix )
+      {
+         // process p gets a contiguous part of the entries, the host keeps the first one
+         const Index nz = mumps_data->nz;
+         Index first = 0;
+         for( int p = 0; p < mpi_size_; p++ )
+         {
+            const int count = (int) (nz / mpi_size_ + (p < nz % mpi_size_ ? 1 : 0));
+            if( p == 0 )
+            {
+               mumps_data->nz_loc = count;
+               mumps_data->irn_loc = mumps_data->irn;
+               mumps_data->jcn_loc = mumps_data->jcn;
+               mumps_data->a_loc = mumps_data->a;
+            }
+            else if( job == 1 )
+            {
+               MPI_Send(mumps_data->irn + first, count, IPOPT_MPI_MUMPS_INT, p, TAG_IRN, comm);
+               MPI_Send(mumps_data->jcn + first, count, IPOPT_MPI_MUMPS_INT, p, TAG_JCN, comm);
+            }
+            else
+            {
+               MPI_Send(mumps_data->a + first, count, MPI_DOUBLE, p, TAG_A, comm);
+            }
+            first += count;
+         }
+      }
+   }
+#endif
+
+   mumps_data->job = job;
+   dmumps_c(mumps_data);
+}
+
+bool MumpsSolverInterface::RunMPIService(
+   int comm_fortran
+)
+{
+#ifndef MUMPS_MPI_H
+   MPI_Comm comm = GetMPIComm(comm_fortran);
+   std::map<int, MumpsServiceInstance> instances;
+
+   while( true )
+   {
+      int command[3];
+      MPI_Bcast(command, 3, MPI_INT, 0, comm);
+      const int job = command[1];
+      if( job == SERVICE_STOP )
+      {
+         break;
+      }
+
+      MumpsServiceInstance& instance = instances[command[0]];
+      if( job == -1 )
+      {
+         instance.data = (DMUMPS_STRUC_C*) calloc(1, sizeof(DMUMPS_STRUC_C));
+         instance.data->par = 1;
+         instance.data->sym = 2;
+         instance.data->comm_fortran = comm_fortran;
+      }
+      DMUMPS_STRUC_C* mumps_data = instance.data;
+
+      if( job == 1 )
+      {
+         mumps_data->icntl[17] = command[2] ? 3 : 0; //distributed or centralized matrix
+      }
+      if( command[2] )
+      {
+         if( job == 1 )
+         {
+            ReceiveFromHost(instance.irn, IPOPT_MPI_MUMPS_INT, TAG_IRN, comm);
+            ReceiveFromHost(instance.jcn, IPOPT_MPI_MUMPS_INT, TAG_JCN, comm);
+            mumps_data->nz_loc = (MUMPS_INT) instance.irn.size();
+            mumps_data->irn_loc = instance.irn.empty() ? NULL : &instance.irn[0];
+            mumps_data->jcn_loc = instance.jcn.empty() ? NULL : &instance.jcn[0];
+         }
+         else
+         {
+            ReceiveFromHost(instance.a, MPI_DOUBLE, TAG_A, comm);
+            mumps_data->a_loc = instance.a.empty() ? NULL : &instance.a[0];
+         }
+      }
+
+      mumps_data->job = job;
+      dmumps_c(mumps_data);
+
+      if( job == -1 )
+      {
+         mumps_data->icntl[1] = 0;
+         mumps_data->icntl[2] = 0; //QUIETLY!
+         mumps_data->icntl[3] = 0;
+      }
+      else if( job == -2 )
+      {
+         free(mumps_data);
+         instances.erase(command[0]);
+      }
+   }
+
+   return true;
+#else
+   (void) comm_fortran;
+   return false;
+#endif
+}
+
+bool MumpsSolverInterface::StopMPIService(
+   int comm_fortran
+)
+{
+#ifndef MUMPS_MPI_H
+   int command[3] = { 0, SERVICE_STOP, 0 };
+   MPI_Bcast(command, 3, MPI_INT, 0, GetMPIComm(comm_fortran));
+   return true;
+#else
+   (void) comm_fortran;
+   return false;
+#endif
+}
+
 }  //end Ipopt namespace
 
@@ -47,6 +47,13 @@ public:
       const Index* ajcn
    );
 
+   virtual ESymSolverStatus ReinitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* airn,
+      const Index* ajcn
+   );
+
    virtual double* GetValuesArrayPtr();
 
    virtual ESymSolverStatus MultiSolve(
@@ -89,6 +96,31 @@ public:
       std::list<Index>& c_deps
    );
 
+   /** @name Methods for running MUMPS on several MPI processes. */
+   //@{
+   /** Serve the MUMPS instances of the host process.
+    *
+    *  To be called on all processes of the MPI communicator except
+    *  the host (rank 0), which runs Ipopt with option mumps_mpi_comm
+    *  set to the same communicator.  Joins every call of MUMPS made by
+    *  the host and returns after the host called StopMPIService.
+    *
+    *  @return false if MUMPS has been compiled without MPI
+    */
+   static bool RunMPIService(
+      int comm_fortran /**< Fortran handle of the communicator, as returned by MPI_Comm_c2f */
+   );
+
+   /** Make the processes that are in RunMPIService return.
+    *
+    *  To be called on the host after all MUMPS instances have been
+    *  destroyed, i.e., after the IpoptApplication has been freed.
+    */
+   static bool StopMPIService(
+      int comm_fortran /**< Fortran handle of the communicator, as returned by MPI_Comm_c2f */
+   );
+   //@}
+
 private:
    /**@name Default Compiler Generated Methods
     * (Hidden to avoid implicit creation/calling).
@@ -141,6 +173,12 @@ private:
     * When the last object is destroyed, we will call MPI_Finalize.
     */
    static int instancecount_mpi;
+   /** Flag indicating if MUMPS has been initialized (job=-1) for mpi_comm_ */
+   bool mumps_initialized_;
+   /** Identifier of this MUMPS instance on the processes in the MPI service */
+   int mpi_instance_id_;
+   /** Counter to assign identifiers to MUMPS instances on the host */
+   static int mpi_instance_counter;
    //@}
 
    /** @name Solver specific data/options */
@@ -166,6 +204,15 @@ private:
    /** Threshold in MUMPS to state that a constraint is linearly dependent */
    Number mumps_dep_tol_;
 
+   /** Fortran handle of the MPI communicator for MUMPS */
+   int mpi_comm_;
+
+   /** Number of MPI processes in mpi_comm_ */
+   int mpi_size_;
+
+   /** Whether the matrix is distributed over the MPI processes (ICNTL(18)=3) */
+   bool distributed_matrix_;
+
    /** Flag indicating whether the TNLP with identical structure has
     *  already been solved before.
     */
@@ -175,6 +222,11 @@ private:
    /** Flag indicating if symbolic factorization has already been called */
    bool have_symbolic_factorization_;
 
+   /** Flag indicating whether MUMPS holds a symbolic factorization of
+    *  the current structure that can be used after a new initialization.
+    */
+   bool reusable_symbolic_factorization_;
+
    /** @name Internal functions */
    //@{
    /** Call MUMPS (job=1) to perform symbolic manipulations, and reserve
@@ -196,6 +248,17 @@ private:
       Index   nrhs,
       double* rhs_vals
    );
+
+   /** Call MUMPS with the given job.
+    *
+    *  If MUMPS runs on more than one MPI process, the job is first
+    *  announced to the processes in the MPI service and, if the
+    *  matrix is distributed, the part of the matrix structure (job=1)
+    *  or values (job=2) of each process is sent to it.
+    */
+   void CallMumps(
+      int job
+   );
    //@}
 };
 
@@ -141,6 +141,28 @@ public:
       const Index* ja
    ) = 0;
 
+   /** Method for initializing internal structures for a matrix whose
+    *  structure is identical to the one of the previous call of
+    *  InitializeStructure.
+    *
+    *  This is called instead of InitializeStructure after a new
+    *  initialization of the solver interface if the caller detected
+    *  that the structure of the matrix has not changed.  ia and ja
+    *  are the same arrays as in the previous call of
+    *  InitializeStructure.  Solver interfaces can overwrite this
+    *  method to keep their symbolic factorization.  The default
+    *  implementation calls InitializeStructure.
+    */
+   virtual ESymSolverStatus ReinitializeStructure(
+      Index        dim,
+      Index        nonzeros,
+      const Index* ia,
+      const Index* ja
+   )
+   {
+      return InitializeStructure(dim, nonzeros, ia, ja);
+   }
+
    /** Method returning an internal array into which the nonzero
     *  elements (in the same order as ja) will be stored by the
     *  calling routine before a call to MultiSolve with a
@@ -217,6 +239,17 @@ public:
     */
    virtual bool IncreaseQuality() = 0;
 
+   /** Query whether the linear solver currently factorizes in single
+    *  precision.
+    *
+    *  If true, the next call of IncreaseQuality switches to double
+    *  precision.
+    */
+   virtual bool SinglePrecision() const
+   {
+      return false;
+   }
+
    /** Query whether inertia is computed by linear solver.
     *
     *  @return true, if linear solver provides inertia
@@ -8,6 +8,8 @@
 #include "IpTripletHelper.hpp"
 #include "IpBlas.hpp"
 
+#include <algorithm>
+
 namespace Ipopt
 {
 #if IPOPT_VERBOSITY > 0
@@ -16,7 +18,8 @@ static const Index dbg_verbosity = 0;
 
 TSymLinearSolver::TSymLinearSolver(
    SmartPtr<SparseSymLinearSolverInterface> solver_interface,
-   SmartPtr<TSymScalingMethod>              scaling_method
+   SmartPtr<TSymScalingMethod>              scaling_method,
+   SmartPtr<SparseSymLinearSolverInterface> dense_solver_interface
 )
    : SymLinearSolver(),
      atag_(0),
@@ -26,10 +29,13 @@ TSymLinearSolver::TSymLinearSolver(
      have_structure_(false),
      initialized_(false),
      solver_interface_(solver_interface),
+     sparse_solver_interface_(solver_interface),
+     dense_solver_interface_(dense_solver_interface),
      scaling_method_(scaling_method),
      scaling_factors_(NULL),
      airn_(NULL),
-     ajcn_(NULL)
+     ajcn_(NULL),
+     check_structure_(false)
 {
    DBG_START_METH("TSymLinearSolver::TSymLinearSolver()", dbg_verbosity);
    DBG_ASSERT(IsValid(solver_interface));
@@ -58,6 +64,49 @@ void TSymLinearSolver::RegisterOptions(
       "This can be quite expensive. "
       "Choosing \"yes\" means that the algorithm will start the scaling method only "
       "when the solutions to the linear system seem not good, and then use it until the end.");
+   roptions->AddStringOption2(
+      "reuse_linear_system_structure",
+      "Whether to reuse the structure of the linear system when a problem is solved again.",
+      "no",
+      "no", "analyze the structure of the linear system for every solve",
+      "yes", "keep the structure if the sparsity pattern has not changed",
+      "If enabled and a problem is reoptimized (e.g., by ReOptimizeTNLP), the sparsity pattern of the first "
+      "linear system is compared with the one from the previous solve. "
+      "If it is identical, the conversion to the format of the linear solver and "
+      "the symbolic factorization (if supported by the linear solver, currently MA27 and MUMPS) are reused. "
+      "Unlike warm_start_same_structure, this does not require the structure to be unchanged.");
+   roptions->AddLowerBoundedIntegerOption(
+      "dense_linear_solver_max_dim",
+      "Largest dimension of a linear system that is solved by the dense linear solver.",
+      0,
+      2000,
+      "If no linear solver has been chosen by the option linear_solver, "
+      "linear systems of at most this dimension whose density is at least dense_linear_solver_min_density "
+      "are factorized as dense matrices by LAPACK, which avoids the overhead of the ordering and symbolic "
+      "analysis of the sparse linear solvers. "
+      "The choice is made when the structure of the linear system is seen for the first time. "
+      "A value of 0 disables the dense linear solver.");
+   roptions->AddBoundedNumberOption(
+      "dense_linear_solver_min_density",
+      "Smallest density of a linear system that is solved by the dense linear solver.",
+      0.0, false,
+      1.0, false,
+      0.1,
+      "The density is the number of nonzeros in the lower triangle of the matrix divided by n(n+1)/2, "
+      "where n is the dimension of the matrix. "
+      "See dense_linear_solver_max_dim.");
+   roptions->AddStringOption2(
+      "factorization_precision",
+      "Floating-point precision of the factorization of the linear system.",
+      "double",
+      "double", "factorize in double precision",
+      "single", "factorize in single precision and fall back to double precision if needed",
+      "A factorization in single precision needs half the memory and is up to twice as fast. "
+      "The loss of accuracy is recovered by iterative refinement in double precision. "
+      "If the refinement does not converge or the matrix is singular in single precision, "
+      "the linear solver switches to double precision for the rest of the optimization. "
+      "This option is currently only supported by the linear solvers ldl and lapack, "
+      "and ignored by the other linear solvers.");
 }
 
 bool TSymLinearSolver::InitializeImpl(
@@ -75,22 +124,39 @@ bool TSymLinearSolver::InitializeImpl(
    }
    // This option is registered by OrigIpoptNLP
    options.GetBoolValue("warm_start_same_structure", warm_start_same_structure_, prefix);
+   options.GetBoolValue("reuse_linear_system_structure", reuse_structure_, prefix);
+   options.GetIntegerValue("dense_linear_solver_max_dim", dense_max_dim_, prefix);
+   options.GetNumericValue("dense_linear_solver_min_density", dense_min_density_, prefix);
 
    bool retval;
    if( HaveIpData() )
    {
-      retval = solver_interface_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(), options, prefix);
+      retval = sparse_solver_interface_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(), options, prefix);
+      if( retval && IsValid(dense_solver_interface_) )
+      {
+         retval = dense_solver_interface_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(), options, prefix);
+      }
    }
    else
    {
-      retval = solver_interface_->ReducedInitialize(Jnlst(), options, prefix);
+      retval = sparse_solver_interface_->ReducedInitialize(Jnlst(), options, prefix);
+      if( retval && IsValid(dense_solver_interface_) )
+      {
+         retval = dense_solver_interface_->ReducedInitialize(Jnlst(), options, prefix);
+      }
    }
    if( !retval )
    {
       return false;
    }
 
-   if( !warm_start_same_structure_ )
+   check_structure_ = false;
+   if( !warm_start_same_structure_ && reuse_structure_ && have_structure_ && matrix_format_ == solver_interface_->MatrixFormat() )
+   {
+      // Keep the structure from the previous solve, but verify it for the first matrix
+      check_structure_ = true;
+   }
+   else if( !warm_start_same_structure_ )
    {
       // Reset all private data
       atag_ = 0;
@@ -99,27 +165,10 @@ bool TSymLinearSolver::InitializeImpl(
       nonzeros_compressed_ = 0;
       have_structure_ = false;
 
-      matrix_format_ = solver_interface_->MatrixFormat();
-      switch( matrix_format_ )
-      {
-         case SparseSymLinearSolverInterface::CSR_Format_0_Offset:
-            triplet_to_csr_converter_ = new TripletToCSRConverter(0);
-            break;
-         case SparseSymLinearSolverInterface::CSR_Format_1_Offset:
-            triplet_to_csr_converter_ = new TripletToCSRConverter(1);
-            break;
-         case SparseSymLinearSolverInterface::CSR_Full_Format_0_Offset:
-            triplet_to_csr_converter_ = new TripletToCSRConverter(0, TripletToCSRConverter::Full_Format);
-            break;
-         case SparseSymLinearSolverInterface::CSR_Full_Format_1_Offset:
-            triplet_to_csr_converter_ = new TripletToCSRConverter(1, TripletToCSRConverter::Full_Format);
-            break;
-         case SparseSymLinearSolverInterface::Triplet_Format:
-            triplet_to_csr_converter_ = NULL;
-            break;
-         default:
-            DBG_ASSERT(false && "Invalid MatrixFormat returned from solver interface.");
-            return false;
+      solver_interface_ = sparse_solver_interface_;
+      if( !SetMatrixFormat() )
+      {
+         return false;
       }
    }
    else
@@ -207,11 +256,11 @@ ESymSolverStatus TSymLinearSolver::MultiSolve(
       if( Jnlst().ProduceOutput(J_MOREMATRIX, J_LINEAR_ALGEBRA) )
       {
          Jnlst().Printf(J_MOREMATRIX, J_LINEAR_ALGEBRA,
-                        "Right hand side %d in TSymLinearSolver:\n", irhs);
+                        "Right hand side %" IPOPT_INDEX_FORMAT " in TSymLinearSolver:\n", irhs);
          for( Index i = 0; i < dim_; i++ )
          {
             Jnlst().Printf(J_MOREMATRIX, J_LINEAR_ALGEBRA,
-                           "Trhs[%5d,%5d] = %23.16e\n", irhs, i, rhs_vals[irhs * (dim_) + i]);
+                           "Trhs[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e\n", irhs, i, rhs_vals[irhs * (dim_) + i]);
          }
       }
       if( use_scaling_ )
@@ -267,6 +316,15 @@ ESymSolverStatus TSymLinearSolver::MultiSolve(
          DBG_PRINT((1, "Solver interface asks to be called again.\n"));
          GiveMatrixToSolver(false, sym_A);
       }
+      else if( retval == SYMSOLVER_SINGULAR && solver_interface_->SinglePrecision()
+               && solver_interface_->IncreaseQuality() )
+      {
+         // A matrix that is singular in single precision can be
+         // regular in double precision, so factorize it again after
+         // the linear solver has switched to double precision
+         DBG_PRINT((1, "Singular in single precision, trying double precision.\n"));
+         GiveMatrixToSolver(false, sym_A);
+      }
       else
       {
          done = true;
@@ -297,11 +355,11 @@ ESymSolverStatus TSymLinearSolver::MultiSolve(
          if( Jnlst().ProduceOutput(J_MOREMATRIX, J_LINEAR_ALGEBRA) )
          {
             Jnlst().Printf(J_MOREMATRIX, J_LINEAR_ALGEBRA,
-                           "Solution %d in TSymLinearSolver:\n", irhs);
+                           "Solution %" IPOPT_INDEX_FORMAT " in TSymLinearSolver:\n", irhs);
             for( Index i = 0; i < dim_; i++ )
             {
                Jnlst().Printf(J_MOREMATRIX, J_LINEAR_ALGEBRA,
-                              "Tsol[%5d,%5d] = %23.16e\n", irhs, i, rhs_vals[irhs * (dim_) + i]);
+                              "Tsol[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e\n", irhs, i, rhs_vals[irhs * (dim_) + i]);
             }
          }
          TripletHelper::PutValuesInVector(dim_, &rhs_vals[irhs * (dim_)], *solV[irhs]);
@@ -313,6 +371,33 @@ ESymSolverStatus TSymLinearSolver::MultiSolve(
    return retval;
 }
 
+bool TSymLinearSolver::SetMatrixFormat()
+{
+   matrix_format_ = solver_interface_->MatrixFormat();
+   switch( matrix_format_ )
+   {
+      case SparseSymLinearSolverInterface::CSR_Format_0_Offset:
+         triplet_to_csr_converter_ = new TripletToCSRConverter(0);
+         break;
+      case SparseSymLinearSolverInterface::CSR_Format_1_Offset:
+         triplet_to_csr_converter_ = new TripletToCSRConverter(1);
+         break;
+      case SparseSymLinearSolverInterface::CSR_Full_Format_0_Offset:
+         triplet_to_csr_converter_ = new TripletToCSRConverter(0, TripletToCSRConverter::Full_Format);
+         break;
+      case SparseSymLinearSolverInterface::CSR_Full_Format_1_Offset:
+         triplet_to_csr_converter_ = new TripletToCSRConverter(1, TripletToCSRConverter::Full_Format);
+         break;
+      case SparseSymLinearSolverInterface::Triplet_Format:
+         triplet_to_csr_converter_ = NULL;
+         break;
+      default:
+         DBG_ASSERT(false && "Invalid MatrixFormat returned from solver interface.");
+         return false;
+   }
+   return true;
+}
+
 ESymSolverStatus TSymLinearSolver::InitializeStructure(
    const SymMatrix& sym_A
 )
@@ -323,6 +408,37 @@ ESymSolverStatus TSymLinearSolver::InitializeStructure(
 
    ESymSolverStatus retval;
 
+   if( check_structure_ )
+   {
+      check_structure_ = false;
+      if( HasSameStructure(sym_A) )
+      {
+         // The structure is identical to the one of the previous solve,
+         // so the compressed format and the symbolic factorization can be kept
+         const Index* ia;
+         const Index* ja;
+         Index nonzeros;
+         if( matrix_format_ == SparseSymLinearSolverInterface::Triplet_Format )
+         {
+            ia = airn_;
+            ja = ajcn_;
+            nonzeros = nonzeros_triplet_;
+         }
+         else
+         {
+            ia = triplet_to_csr_converter_->IA();
+            ja = triplet_to_csr_converter_->JA();
+            nonzeros = nonzeros_compressed_;
+         }
+         retval = solver_interface_->ReinitializeStructure(dim_, nonzeros, ia, ja);
+         initialized_ = true;
+         return retval;
+      }
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Structure of linear system has changed, cannot reuse it.\n");
+      have_structure_ = false;
+   }
+
    // have_structure_ is already true if this is a warm start for a
    // problem with identical structure
    if( !have_structure_ )
@@ -338,6 +454,25 @@ ESymSolverStatus TSymLinearSolver::InitializeStructure(
 
       TripletHelper::FillRowCol(nonzeros_triplet_, sym_A, airn_, ajcn_);
 
+      // Small and dense matrices are given to the dense linear solver
+      if( IsValid(dense_solver_interface_) )
+      {
+         const bool use_dense = dim_ <= dense_max_dim_
+                                && nonzeros_triplet_ >= dense_min_density_ * 0.5 * dim_ * (dim_ + 1.);
+         Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                        "Using the %s linear solver for a matrix of dimension %" IPOPT_INDEX_FORMAT " with %" IPOPT_INDEX_FORMAT " nonzeros.\n",
+                        use_dense ? "dense" : "sparse", dim_, nonzeros_triplet_);
+         SmartPtr<SparseSymLinearSolverInterface> solver = use_dense ? dense_solver_interface_ : sparse_solver_interface_;
+         if( GetRawPtr(solver) != GetRawPtr(solver_interface_) )
+         {
+            solver_interface_ = solver;
+            if( !SetMatrixFormat() )
+            {
+               return SYMSOLVER_FATAL_ERROR;
+            }
+         }
+      }
+
       // If the solver wants the compressed format, the converter has to
       // be initialized
       const Index* ia;
@@ -422,6 +557,30 @@ ESymSolverStatus TSymLinearSolver::InitializeStructure(
    return retval;
 }
 
+bool TSymLinearSolver::HasSameStructure(
+   const SymMatrix& sym_A
+) const
+{
+   DBG_START_METH("TSymLinearSolver::HasSameStructure",
+                  dbg_verbosity);
+
+   if( sym_A.Dim() != dim_ || TripletHelper::GetNumberEntries(sym_A) != nonzeros_triplet_ )
+   {
+      return false;
+   }
+
+   // Comparing the full structure is not more expensive than computing a
+   // hash of it, since the structure has to be obtained from sym_A anyway
+   Index* airn = new Index[nonzeros_triplet_];
+   Index* ajcn = new Index[nonzeros_triplet_];
+   TripletHelper::FillRowCol(nonzeros_triplet_, sym_A, airn, ajcn);
+   bool same = std::equal(airn, airn + nonzeros_triplet_, airn_) && std::equal(ajcn, ajcn + nonzeros_triplet_, ajcn_);
+   delete[] airn;
+   delete[] ajcn;
+
+   return same;
+}
+
 Index TSymLinearSolver::NumberOfNegEVals() const
 {
    DBG_START_METH("TSymLinearSolver::NumberOfNegEVals", dbg_verbosity);
@@ -439,10 +598,16 @@ bool TSymLinearSolver::IncreaseQuality()
       IpData().Append_info_string("Mc");
       use_scaling_ = true;
       just_switched_on_scaling_ = true;
+      IpData().LinearSolverStats().RecordQualityIncrease();
       return true;
    }
 
-   return solver_interface_->IncreaseQuality();
+   bool retval = solver_interface_->IncreaseQuality();
+   if( retval && HaveIpData() )
+   {
+      IpData().LinearSolverStats().RecordQualityIncrease();
+   }
+   return retval;
 }
 
 bool TSymLinearSolver::ProvidesInertia() const
@@ -505,7 +670,7 @@ void TSymLinearSolver::GiveMatrixToSolver(
             for( Index i = 0; i < dim_; i++ )
             {
                Jnlst().Printf(J_MOREVECTOR, J_LINEAR_ALGEBRA,
-                              "scaling factor[%6d] = %22.17e\n", i, scaling_factors_[i]);
+                              "scaling factor[%6" IPOPT_INDEX_FORMAT "] = %22.17e\n", i, scaling_factors_[i]);
             }
          }
          just_switched_on_scaling_ = false;
@@ -672,7 +837,7 @@ ESymSolverStatus TSymLinearSolver::DetermineDependentRows(
          for( Index i = 0; i < dim_; i++ )
          {
             Jnlst().Printf(J_MOREVECTOR, J_LINEAR_ALGEBRA,
-                           "scaling factor[%6d] = %22.17e\n", i, scaling_factors_[i]);
+                           "scaling factor[%6" IPOPT_INDEX_FORMAT "] = %22.17e\n", i, scaling_factors_[i]);
          }
       }
       for( Index i = 0; i < nonzeros_triplet_; i++ )
@@ -41,10 +41,15 @@ public:
     *  solver for symmetric matrices in triplet format.
     *  If scaling_method not NULL, it must be a pointer to a class for
     *  computing scaling factors for the matrix.
+    *  If dense_solver_interface is not NULL, it is used instead of
+    *  solver_interface for matrices whose dimension and density are
+    *  within the limits given by the options dense_linear_solver_max_dim
+    *  and dense_linear_solver_min_density.
     */
    TSymLinearSolver(
       SmartPtr<SparseSymLinearSolverInterface> solver_interface,
-      SmartPtr<TSymScalingMethod>              scaling_method
+      SmartPtr<TSymScalingMethod>              scaling_method,
+      SmartPtr<SparseSymLinearSolverInterface> dense_solver_interface = NULL
    );
 
    /** Destructor */
@@ -161,8 +166,19 @@ private:
    bool initialized_;
    //@}
 
-   /** Strategy Object for an interface to a linear solver. */
+   /** Strategy Object for an interface to a linear solver.
+    *
+    *  This is either sparse_solver_interface_ or
+    *  dense_solver_interface_, depending on the structure of the matrix.
+    */
    SmartPtr<SparseSymLinearSolverInterface> solver_interface_;
+   /** Interface to the linear solver given in the constructor. */
+   SmartPtr<SparseSymLinearSolverInterface> sparse_solver_interface_;
+   /** Interface to a linear solver for small and dense matrices.
+    *
+    *  If NULL, sparse_solver_interface_ is used for all matrices.
+    */
+   SmartPtr<SparseSymLinearSolverInterface> dense_solver_interface_;
    /** @name Stuff for scaling of the linear system. */
    //@{
    /** Strategy Object for a method that computes scaling factors for
@@ -201,10 +217,29 @@ private:
     *  already been solved before.
     */
    bool warm_start_same_structure_;
+   /** Flag indicating whether the structure of the matrix and the
+    *  symbolic factorization are kept for a new solve if the sparsity
+    *  structure of the matrix has not changed.
+    */
+   bool reuse_structure_;
+   /** Largest dimension of a matrix for which the dense solver is used */
+   Index dense_max_dim_;
+   /** Smallest density of a matrix for which the dense solver is used */
+   Number dense_min_density_;
    //@}
 
+   /** Flag indicating that the structure of the next matrix has to be
+    *  compared with airn_ and ajcn_ before it can be reused.
+    */
+   bool check_structure_;
+
    /** @name Internal functions */
    //@{
+   /** Set matrix_format_ to the format required by solver_interface_
+    *  and create the converter to this format.
+    */
+   bool SetMatrixFormat();
+
    /** Initialize nonzero structure.
     *
     *  Set dim_ and nonzeros_, and copy the nonzero structure of symT_A
@@ -214,6 +249,13 @@ private:
       const SymMatrix& symT_A
    );
 
+   /** Check whether the nonzero structure of sym_A is identical to
+    *  the one stored in airn_ and ajcn_.
+    */
+   bool HasSameStructure(
+      const SymMatrix& sym_A
+   ) const;
+
    /** Copy the elements of the matrix in the required format into
     *  the array that is provided by the solver interface.
     */
@@ -65,16 +65,6 @@ Index TripletToCSRConverter::InitializeConverter(
    dim_ = dim;
    nonzeros_triplet_ = nonzeros;
 
-   // Create a list with all triplet entries
-   std::vector<TripletEntry> entry_list(nonzeros);
-   std::vector<TripletEntry>::iterator list_iterator = entry_list.begin();
-   for( Index i = 0; i < nonzeros; i++ )
-   {
-      list_iterator->Set(airn[i], ajcn[i], i);
-      list_iterator++;
-   }
-   DBG_ASSERT(list_iterator == entry_list.end());
-
    if( DBG_VERBOSITY() >= 2 )
    {
       for( Index i = 0; i < nonzeros; i++ )
@@ -83,10 +73,45 @@ Index TripletToCSRConverter::InitializeConverter(
       }
    }
 
-   // sort the list
-   std::sort(entry_list.begin(), entry_list.end());
+   // Sort the triplet entries, mapped to the upper triangle, by row and
+   // then by column.  This is done by two stable counting sorts, first
+   // by column and then by row, so it takes time linear in nonzeros+dim
+   // and entries at the same position keep the order of the triplets.
+   // perm[k] is the position in the triplet format of the k-th sorted entry.
+   std::vector<Index> count(dim_ + 1);
+   std::vector<Index> perm_col(nonzeros);
+   std::vector<Index> perm(nonzeros);
+   for( Index i = 0; i < nonzeros; i++ )
+   {
+      count[Max(airn[i], ajcn[i])]++;
+   }
+   for( Index i = 0; i < dim_; i++ )
+   {
+      count[i + 1] += count[i];
+   }
+   for( Index i = 0; i < nonzeros; i++ )
+   {
+      perm_col[count[Max(airn[i], ajcn[i]) - 1]++] = i;
+   }
+
+   std::fill(count.begin(), count.end(), 0);
+   for( Index i = 0; i < nonzeros; i++ )
+   {
+      count[Min(airn[i], ajcn[i])]++;
+   }
+   for( Index i = 0; i < dim_; i++ )
+   {
+      count[i + 1] += count[i];
+   }
+   for( Index k = 0; k < nonzeros; k++ )
+   {
+      Index i = perm_col[k];
+      perm[count[Min(airn[i], ajcn[i]) - 1]++] = i;
+   }
+   std::vector<Index>().swap(perm_col);
+   std::vector<Index>().swap(count);
 
-   // Now got through the list and compute ipos_ arrays and the
+   // Now got through the sorted entries and compute ipos_ arrays and the
    // number of elements in the compressed format
    Index* ja_tmp = new Index[nonzeros];    // overestimate memory requirement
    Index* rc_tmp = NULL;
@@ -113,38 +138,39 @@ Index TripletToCSRConverter::InitializeConverter(
    }
 
    // Take care of possible empty rows
-   list_iterator = entry_list.begin();
-   while( cur_row < list_iterator->IRow() )
+   Index first_row = Min(airn[perm[0]], ajcn[perm[0]]);
+   Index first_col = Max(airn[perm[0]], ajcn[perm[0]]);
+   while( cur_row < first_row )
    {
       ia_[cur_row - 1] = 0;
       cur_row++;
    }
    ia_[cur_row - 1] = 0;
-   ja_tmp[0] = list_iterator->JCol();
-   ipos_first_tmp[0] = list_iterator->PosTriplet();
+   ja_tmp[0] = first_col;
+   ipos_first_tmp[0] = perm[0];
    if( hf_ == Full_Format )
    {
       // Count in both lower and upper triangles. Count diagonal only once.
       nonzeros_compressed_full++;
       rc_tmp[cur_row - 1]++;
-      if( cur_row != list_iterator->JCol() )
+      if( cur_row != first_col )
       {
          nonzeros_compressed_full++;
-         rc_tmp[list_iterator->JCol() - 1]++;
+         rc_tmp[first_col - 1]++;
       }
    }
 
-   list_iterator++;
    Index idouble = 0;
    Index idouble_full = 0;
-   while( list_iterator != entry_list.end() )
+   for( Index k = 1; k < nonzeros; k++ )
    {
-      Index irow = list_iterator->IRow();
-      Index jcol = list_iterator->JCol();
+      Index ipos = perm[k];
+      Index irow = Min(airn[ipos], ajcn[ipos]);
+      Index jcol = Max(airn[ipos], ajcn[ipos]);
       if( cur_row == irow && ja_tmp[nonzeros_compressed_] == jcol )
       {
          // This element appears repeatedly, add to the double list
-         ipos_double_triplet_tmp[idouble] = list_iterator->PosTriplet();
+         ipos_double_triplet_tmp[idouble] = ipos;
          ipos_double_compressed_tmp[idouble] = nonzeros_compressed_;
          idouble++;
          idouble_full++;
@@ -169,17 +195,14 @@ Index TripletToCSRConverter::InitializeConverter(
          }
          nonzeros_compressed_++;
          ja_tmp[nonzeros_compressed_] = jcol;
-         ipos_first_tmp[nonzeros_compressed_] = list_iterator->PosTriplet();
-         if( cur_row != irow )
+         ipos_first_tmp[nonzeros_compressed_] = ipos;
+         // this may be in a new row, possibly after some empty rows
+         while( cur_row < irow )
          {
-            // this is in a new row
-
             ia_[cur_row] = nonzeros_compressed_;
             cur_row++;
          }
       }
-
-      list_iterator++;
    }
    nonzeros_compressed_++;
    for( Index i = cur_row; i <= dim_; i++ )
@@ -335,6 +358,8 @@ void TripletToCSRConverter::ConvertValues(
    DBG_ASSERT(nonzeros_triplet_ == nonzeros_triplet);
    DBG_ASSERT(nonzeros_compressed_ == nonzeros_compressed);
 
+   const Index nthreads = IpNumThreadsForDim(nonzeros_compressed_);
+   IPOPT_OMP_PARFOR(nthreads)
    for( Index i = 0; i < nonzeros_compressed_; i++ )
    {
       a_compressed[i] = a_triplet[ipos_first_[i]];
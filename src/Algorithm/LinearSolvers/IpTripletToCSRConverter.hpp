@@ -21,72 +21,6 @@ namespace Ipopt
  */
 class TripletToCSRConverter: public ReferencedObject
 {
-   /** Class for one triplet position entry. */
-   class TripletEntry
-   {
-   public:
-
-      /** Set the values of an entry */
-      void Set(
-         Index i_row,
-         Index j_col,
-         Index i_pos_triplet
-      )
-      {
-         if( i_row > j_col )
-         {
-            i_row_ = j_col;
-            j_col_ = i_row;
-         }
-         else
-         {
-            i_row_ = i_row;
-            j_col_ = j_col;
-         }
-         i_pos_triplet_ = i_pos_triplet;
-      }
-
-      /** @name Accessor methods. */
-      //@{
-      /** Row position. */
-      Index IRow() const
-      {
-         return i_row_;
-      }
-
-      /** Column position. */
-      Index JCol() const
-      {
-         return j_col_;
-      }
-
-      /** Index in original triplet matrix. */
-      Index PosTriplet() const
-      {
-         return i_pos_triplet_;
-      }
-      //@}
-
-      /** Comparison operator.
-       *
-       * This is required for the sort function.
-       */
-      bool operator<(
-         const TripletEntry& Tentry
-      ) const
-      {
-         return ((i_row_ < Tentry.i_row_) || (i_row_ == Tentry.i_row_ && j_col_ < Tentry.j_col_));
-      }
-
-   private:
-      /** @name Entry content. */
-      //@{
-      Index i_row_;
-      Index j_col_;
-      Index i_pos_triplet_;
-      //@}
-   };
-
 public:
    /** Enum to specify half or full matrix storage */
    enum ETriFull
@@ -56,7 +56,8 @@ public:
       //      suffix_values_.push_back();
    }
 
-   const Index* GetIntegerSuffixValues(
+   /** ASL stores integer suffix values as int, also with 64-bit Index */
+   const int* GetIntegerSuffixValues(
       std::string   suffix_string,
       Suffix_Source source
    ) const;
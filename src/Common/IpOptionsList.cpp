@@ -210,7 +210,7 @@ bool OptionsList::SetIntegerValue(
 )
 {
    char buffer[256];
-   Snprintf(buffer, 255, "%d", value);
+   Snprintf(buffer, 255, "%" IPOPT_INDEX_FORMAT, value);
 
    if( IsValid(reg_options_) )
    {
@@ -647,7 +647,7 @@ void OptionsList::PrintList(
    list += buffer;
    for( std::map<std::string, OptionValue>::const_iterator p = options_.begin(); p != options_.end(); p++ )
    {
-      Snprintf(buffer, 255, "%40s = %-20s %6d\n", p->first.c_str(), p->second.Value().c_str(), p->second.Counter());
+      Snprintf(buffer, 255, "%40s = %-20s %6" IPOPT_INDEX_FORMAT "\n", p->first.c_str(), p->second.Value().c_str(), p->second.Counter());
       list += buffer;
    }
 }
@@ -89,7 +89,7 @@ void RegisteredOption::OutputDescription(
       if( has_lower_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      "%d", (Index) lower_);
+                      "%" IPOPT_INDEX_FORMAT, (Index) lower_);
       }
       else
       {
@@ -98,12 +98,12 @@ void RegisteredOption::OutputDescription(
       }
 
       jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                   " <= (%d) <= ", (Index) default_number_);
+                   " <= (%" IPOPT_INDEX_FORMAT ") <= ", (Index) default_number_);
 
       if( has_upper_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      "%d\n", (Index) upper_);
+                      "%" IPOPT_INDEX_FORMAT "\n", (Index) upper_);
       }
       else
       {
@@ -231,7 +231,7 @@ void RegisteredOption::OutputLatexDescription(
       if( has_lower_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      "%d \\le ", (Index) lower_);
+                      "%" IPOPT_INDEX_FORMAT " \\le ", (Index) lower_);
       }
       else
       {
@@ -245,7 +245,7 @@ void RegisteredOption::OutputLatexDescription(
       if( has_upper_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      " \\le %d", (Index) upper_);
+                      " \\le %" IPOPT_INDEX_FORMAT, (Index) upper_);
       }
       else
       {
@@ -254,7 +254,7 @@ void RegisteredOption::OutputLatexDescription(
       }
 
       jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                   "$\nand its default value is $%d$.\n\n", (Index) default_number_);
+                   "$\nand its default value is $%" IPOPT_INDEX_FORMAT "$.\n\n", (Index) default_number_);
    }
    else if( type_ == OT_String )
    {
@@ -444,7 +444,7 @@ void RegisteredOption::OutputDoxygenDescription(
          if( has_lower_ )
          {
             jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                         "%d &le; ", (Index) lower_);
+                         "%" IPOPT_INDEX_FORMAT " &le; ", (Index) lower_);
          }
          //else
          //{
@@ -458,7 +458,7 @@ void RegisteredOption::OutputDoxygenDescription(
          if( has_upper_ )
          {
             jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                         " &le; %d", (Index) upper_);
+                         " &le; %" IPOPT_INDEX_FORMAT, (Index) upper_);
          }
          //else
          //{
@@ -473,7 +473,7 @@ void RegisteredOption::OutputDoxygenDescription(
       }
 
       jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                   " and its default value is %d.\n\n", (Index) default_number_);
+                   " and its default value is %" IPOPT_INDEX_FORMAT ".\n\n", (Index) default_number_);
    }
    else if( type_ == OT_String )
    {
@@ -618,7 +618,7 @@ void RegisteredOption::OutputShortDescription(
       if( has_lower_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      "%10d <= ", (Index) lower_);
+                      "%10" IPOPT_INDEX_FORMAT " <= ", (Index) lower_);
       }
       else
       {
@@ -627,12 +627,12 @@ void RegisteredOption::OutputShortDescription(
       }
 
       jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                   "(%11d)", (Index) default_number_);
+                   "(%11" IPOPT_INDEX_FORMAT ")", (Index) default_number_);
 
       if( has_upper_ )
       {
          jnlst.Printf(J_SUMMARY, J_DOCUMENTATION,
-                      " <= %-10d\n", (Index) upper_);
+                      " <= %-10" IPOPT_INDEX_FORMAT "\n", (Index) upper_);
       }
       else
       {
@@ -1273,6 +1273,55 @@ void RegisteredOptions::AddStringOption10(
    registered_options_[name] = option;
 }
 
+void RegisteredOptions::AddStringOption11(
+   const std::string& name,
+   const std::string& short_description,
+   const std::string& default_value,
+   const std::string& setting1,
+   const std::string& description1,
+   const std::string& setting2,
+   const std::string& description2,
+   const std::string& setting3,
+   const std::string& description3,
+   const std::string& setting4,
+   const std::string& description4,
+   const std::string& setting5,
+   const std::string& description5,
+   const std::string& setting6,
+   const std::string& description6,
+   const std::string& setting7,
+   const std::string& description7,
+   const std::string& setting8,
+   const std::string& description8,
+   const std::string& setting9,
+   const std::string& description9,
+   const std::string& setting10,
+   const std::string& description10,
+   const std::string& setting11,
+   const std::string& description11,
+   const std::string& long_description
+)
+{
+   SmartPtr<RegisteredOption> option = new RegisteredOption(name, short_description, long_description,
+         current_registering_category_, next_counter_++);
+   option->SetType(OT_String);
+   option->SetDefaultString(default_value);
+   option->AddValidStringSetting(setting1, description1);
+   option->AddValidStringSetting(setting2, description2);
+   option->AddValidStringSetting(setting3, description3);
+   option->AddValidStringSetting(setting4, description4);
+   option->AddValidStringSetting(setting5, description5);
+   option->AddValidStringSetting(setting6, description6);
+   option->AddValidStringSetting(setting7, description7);
+   option->AddValidStringSetting(setting8, description8);
+   option->AddValidStringSetting(setting9, description9);
+   option->AddValidStringSetting(setting10, description10);
+   option->AddValidStringSetting(setting11, description11);
+   ASSERT_EXCEPTION(registered_options_.find(name) == registered_options_.end(), OPTION_ALREADY_REGISTERED,
+                    std::string("The option: ") + option->Name() + " has already been registered by someone else");
+   registered_options_[name] = option;
+}
+
 SmartPtr<const RegisteredOption> RegisteredOptions::GetOption(
    const std::string& name
 )
@@ -32,8 +32,15 @@ namespace Ipopt
 /** Global data that is incremented every time ANY TaggedObject changes.
  *
  * This allows us to obtain a unique Tag when the object changes.
+ *
+ * With OpenMP, the blocks of a compound vector may be changed by different
+ * threads, so the counter is shared by all threads and incremented atomically.
  */
+#ifdef _OPENMP
+static TaggedObject::Tag unique_tag =  1;
+#else
 static IPOPT_THREAD_LOCAL TaggedObject::Tag unique_tag =  1;
+#endif
 
 /** Objects derived from TaggedObject MUST call this
  *  method every time their internal state changes to
@@ -42,8 +49,15 @@ static IPOPT_THREAD_LOCAL TaggedObject::Tag unique_tag =  1;
 void TaggedObject::ObjectChanged()
 {
    DBG_START_METH("TaggedObject::ObjectChanged()", 0);
+#ifdef _OPENMP
+   Tag tag;
+   #pragma omp atomic capture
+   tag = unique_tag++;
+   tag_ = tag;
+#else
    tag_ = unique_tag;
    unique_tag++;
+#endif
    DBG_ASSERT(unique_tag < std::numeric_limits<Tag>::max());
    // The Notify method from the Subject base class notifies all
    // registered Observers that this subject has changed.
@@ -11,8 +11,40 @@
 
 #include "IpUtils.hpp"
 
+#include <string>
+
 namespace Ipopt
 {
+class TimedTask;
+
+/** Interface for objects that record the individual executions
+ *  of timed tasks, e.g., to write a trace of the optimization run.
+ */
+class IPOPTLIB_EXPORT TimedTaskRecorder
+{
+public:
+   virtual ~TimedTaskRecorder()
+   {}
+
+   /** Method that is called when the execution of a task starts. */
+   virtual void TaskStarted(
+      const TimedTask& task
+   ) = 0;
+
+   /** Method that is called when the execution of a task ends.
+    *
+    *  start_walltime is the wall clock time at the start of the
+    *  execution, cputime and walltime are the CPU and wall clock time
+    *  spend in this execution.
+    */
+   virtual void TaskEnded(
+      const TimedTask& task,
+      Number           start_walltime,
+      Number           cputime,
+      Number           walltime
+   ) = 0;
+};
+
 /** This class is used to collect timing information for a
  *  particular task. */
 class IPOPTLIB_EXPORT TimedTask
@@ -23,6 +55,7 @@ public:
    /** Default constructor. */
    TimedTask()
       :
+      recorder_(NULL),
       total_cputime_(0.),
       total_systime_(0.),
       total_walltime_(0.),
@@ -45,6 +78,24 @@ public:
       end_called_ = true;
    }
 
+   /** Method for setting the name of the task and the object that
+    *  records its executions (NULL for none).
+    */
+   void SetRecorder(
+      const std::string& name,
+      TimedTaskRecorder* recorder
+   )
+   {
+      name_ = name;
+      recorder_ = recorder;
+   }
+
+   /** Name of the task. */
+   const std::string& Name() const
+   {
+      return name_;
+   }
+
    /** Method that is called before execution of the task. */
    void Start()
    {
@@ -55,6 +106,10 @@ public:
       start_cputime_ = CpuTime();
       start_systime_ = SysTime();
       start_walltime_ = WallclockTime();
+      if( recorder_ != NULL )
+      {
+         recorder_->TaskStarted(*this);
+      }
    }
 
    /** Method that is called after execution of the task. */
@@ -64,9 +119,7 @@ public:
       DBG_ASSERT(start_called_);
       end_called_ = true;
       start_called_ = false;
-      total_cputime_ += CpuTime() - start_cputime_;
-      total_systime_ += SysTime() - start_systime_;
-      total_walltime_ += WallclockTime() - start_walltime_;
+      Accumulate();
    }
 
    /** Method that is called after execution of the task for which
@@ -79,9 +132,7 @@ public:
       {
          end_called_ = true;
          start_called_ = false;
-         total_cputime_ += CpuTime() - start_cputime_;
-         total_systime_ += SysTime() - start_systime_;
-         total_walltime_ += WallclockTime() - start_walltime_;
+         Accumulate();
       }
       DBG_ASSERT(end_called_);
    }
@@ -122,6 +173,25 @@ private:
    void operator=(const TimedTask&);
    //@}
 
+   /** Add the times since the start of the task to the totals. */
+   void Accumulate()
+   {
+      Number cputime = CpuTime() - start_cputime_;
+      Number walltime = WallclockTime() - start_walltime_;
+      total_cputime_ += cputime;
+      total_systime_ += SysTime() - start_systime_;
+      total_walltime_ += walltime;
+      if( recorder_ != NULL )
+      {
+         recorder_->TaskEnded(*this, start_walltime_, cputime, walltime);
+      }
+   }
+
+   /** Name of the task. */
+   std::string name_;
+   /** Object recording the executions of the task, or NULL. */
+   TimedTaskRecorder* recorder_;
+
    /** CPU time at beginning of task. */
    Number start_cputime_;
    /** Total CPU time for task measured so far. */
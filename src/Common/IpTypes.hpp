@@ -13,13 +13,33 @@ namespace Ipopt
 {
 /** Type of all numbers */
 typedef double Number;
-/** Type of all indices of vectors, matrices etc */
+/** Type of all indices of vectors, matrices etc
+ *
+ *  This is a 64-bit integer if Ipopt has been configured with
+ *  --enable-int64, which is needed if the number of nonzeros in the
+ *  Jacobian, the Hessian, or the KKT matrix exceeds 2^31-1.
+ */
+#ifdef IPOPT_INT64
+typedef int64_t Index;
+#else
 typedef int Index;
+#endif
 /** Type of default integer */
 typedef int Int;
 
 } // namespace Ipopt
 
+/** Conversion specifier to print an Index with printf-like functions,
+ *  to be used as "%" IPOPT_INDEX_FORMAT
+ */
+#ifndef IPOPT_INDEX_FORMAT
+#ifdef IPOPT_INT64
+#define IPOPT_INDEX_FORMAT PRId64
+#else
+#define IPOPT_INDEX_FORMAT "d"
+#endif
+#endif
+
 /* Type of Fortran integer translated into C */
 typedef IPOPT_FORTRAN_INTEGER_TYPE ipfint;
 
@@ -17,6 +17,11 @@
 #include <cstdio>
 #include <cstdarg>
 #include <limits>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // The special treatment of vsnprintf on SUN has been suggsted by Lou Hafer 2010/07/04
 #if defined(HAVE_VSNPRINTF) && defined(__SUNPRO_CC)
@@ -193,6 +198,122 @@ Number WallclockTime()
    return callTime - Wallclock_firstCall_;
 }
 
+static Index num_threads_ = 1;
+static Index parallel_min_dim_ = 100000;
+
+void IpSetNumThreads(
+   Index num_threads
+)
+{
+   DBG_ASSERT(num_threads >= 0);
+#ifdef _OPENMP
+   if( num_threads == 0 )
+   {
+      num_threads = omp_get_max_threads();
+   }
+   num_threads_ = Max(num_threads, 1);
+#else
+   (void) num_threads;
+#endif
+}
+
+Index IpGetNumThreads()
+{
+   return num_threads_;
+}
+
+Index IpGetThreadNum()
+{
+#ifdef _OPENMP
+   return omp_get_thread_num();
+#else
+   return 0;
+#endif
+}
+
+void IpSetParallelMinDim(
+   Index min_dim
+)
+{
+   parallel_min_dim_ = min_dim;
+}
+
+Index IpGetParallelMinDim()
+{
+   return parallel_min_dim_;
+}
+
+Index IpNumThreadsForDim(
+   Index dim
+)
+{
+#ifdef _OPENMP
+   if( num_threads_ > 1 && dim >= parallel_min_dim_ && !omp_in_parallel() )
+   {
+      return Min(num_threads_, dim);
+   }
+#else
+   (void) dim;
+#endif
+   return 1;
+}
+
+Index IpNumThreadsForTasks(
+   Index ntasks
+)
+{
+#ifdef _OPENMP
+   if( num_threads_ > 1 && ntasks > 1 && !omp_in_parallel() )
+   {
+      return Min(num_threads_, ntasks);
+   }
+#else
+   (void) ntasks;
+#endif
+   return 1;
+}
+
+static bool parallel_blocks_ = false;
+
+void IpSetParallelBlocks(
+   bool parallel_blocks
+)
+{
+   parallel_blocks_ = parallel_blocks;
+}
+
+bool IpGetParallelBlocks()
+{
+   return parallel_blocks_;
+}
+
+Index IpNumThreadsForBlocks(
+   Index nblocks,
+   Index dim
+)
+{
+   if( !parallel_blocks_ || nblocks < 2 )
+   {
+      return 1;
+   }
+   return Min(IpNumThreadsForDim(dim), nblocks);
+}
+
+bool IpBlocksDisjoint(
+   std::vector<std::pair<const void*, Index> >& objects
+)
+{
+   std::sort(objects.begin(), objects.end());
+   for( size_t k = 1; k < objects.size(); k++ )
+   {
+      if( objects[k].first == objects[k - 1].first && objects[k].second != objects[k - 1].second )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
 bool Compare_le(
    Number lhs,
    Number rhs,
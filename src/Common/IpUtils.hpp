@@ -11,6 +11,47 @@
 #include "IpTypes.hpp"
 #include "IpDebug.hpp"
 
+#include <utility>
+#include <vector>
+
+/** @name Macros for the multithreaded kernels.
+ *
+ *  If Ipopt has been compiled with OpenMP support, IPOPT_OMP_PARFOR(nthreads)
+ *  parallelizes the following for-loop on nthreads threads, unless nthreads is 1.
+ *  IPOPT_OMP_PARFOR_SIMD additionally asks the compiler to vectorize the loop,
+ *  so it must only be used for loops whose iterations are independent.
+ *  IPOPT_OMP_PARFOR_MIN and IPOPT_OMP_PARFOR_MAX parallelize and vectorize a
+ *  loop that computes the minimum or maximum of the given variable.
+ *  IPOPT_OMP_PARFOR_DYNAMIC hands out the iterations one by one, which is
+ *  meant for loops over a few blocks of different size.
+ *  Without OpenMP support, these macros only mark nthreads as used, so
+ *  they must be placed where a statement is allowed.  IPOPT_OMP_PARFOR_SIMD
+ *  then still tells GCC and Clang that the iterations are independent, so
+ *  that the loop is vectorized for the target architecture.
+ */
+//@{
+#define IPOPT_PRAGMA(x) _Pragma(#x)
+#ifdef _OPENMP
+#define IPOPT_OMP_PARFOR(nthreads) IPOPT_PRAGMA(omp parallel for schedule(static) num_threads(nthreads) if(parallel: nthreads > 1))
+#define IPOPT_OMP_PARFOR_SIMD(nthreads) IPOPT_PRAGMA(omp parallel for simd schedule(static) num_threads(nthreads) if(parallel: nthreads > 1))
+#define IPOPT_OMP_PARFOR_MIN(nthreads, var) IPOPT_PRAGMA(omp parallel for simd schedule(static) num_threads(nthreads) if(parallel: nthreads > 1) reduction(min:var))
+#define IPOPT_OMP_PARFOR_MAX(nthreads, var) IPOPT_PRAGMA(omp parallel for simd schedule(static) num_threads(nthreads) if(parallel: nthreads > 1) reduction(max:var))
+#define IPOPT_OMP_PARFOR_DYNAMIC(nthreads) IPOPT_PRAGMA(omp parallel for schedule(dynamic, 1) num_threads(nthreads) if(parallel: nthreads > 1))
+#else
+#define IPOPT_OMP_PARFOR(nthreads) (void)(nthreads);
+#if defined(__clang__)
+#define IPOPT_OMP_PARFOR_SIMD(nthreads) (void)(nthreads); IPOPT_PRAGMA(clang loop vectorize(assume_safety))
+#elif defined(__GNUC__) && !defined(__INTEL_COMPILER) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define IPOPT_OMP_PARFOR_SIMD(nthreads) (void)(nthreads); IPOPT_PRAGMA(GCC ivdep)
+#else
+#define IPOPT_OMP_PARFOR_SIMD(nthreads) (void)(nthreads);
+#endif
+#define IPOPT_OMP_PARFOR_MIN(nthreads, var) (void)(nthreads);
+#define IPOPT_OMP_PARFOR_MAX(nthreads, var) (void)(nthreads);
+#define IPOPT_OMP_PARFOR_DYNAMIC(nthreads) (void)(nthreads);
+#endif
+//@}
+
 namespace Ipopt
 {
 
@@ -161,6 +202,111 @@ IPOPTLIB_EXPORT Number SysTime();
 /** method determining wallclock time since first call */
 IPOPTLIB_EXPORT Number WallclockTime();
 
+/** Set the maximal number of threads that Ipopt uses in its multithreaded kernels.
+ *
+ *  This has only an effect if Ipopt has been compiled with OpenMP support.
+ *  A value of 1 (the default) disables multithreading.
+ */
+IPOPTLIB_EXPORT void IpSetNumThreads(
+   Index num_threads
+);
+
+/** Maximal number of threads that Ipopt uses in its multithreaded kernels.
+ *
+ *  Always 1 if Ipopt has been compiled without OpenMP support.
+ */
+IPOPTLIB_EXPORT Index IpGetNumThreads();
+
+/** Number of the calling thread within the current parallel region.
+ *
+ *  Always 0 outside of a parallel region or if Ipopt has been compiled
+ *  without OpenMP support.
+ */
+IPOPTLIB_EXPORT Index IpGetThreadNum();
+
+/** Set the minimal number of elements of a vector for which the
+ *  multithreaded kernels are used.
+ */
+IPOPTLIB_EXPORT void IpSetParallelMinDim(
+   Index min_dim
+);
+
+/** Minimal number of elements of a vector for which the multithreaded kernels are used. */
+IPOPTLIB_EXPORT Index IpGetParallelMinDim();
+
+/** Number of threads to use for an operation on dim elements.
+ *
+ *  Returns 1 if the operation should be done serially, i.e., if
+ *  multithreading is disabled, dim is below the value set by
+ *  IpSetParallelMinDim, or we are already within a parallel region.
+ */
+IPOPTLIB_EXPORT Index IpNumThreadsForDim(
+   Index dim
+);
+
+/** Number of threads to use for ntasks independent tasks, e.g., calls of user functions.
+ *
+ *  Unlike IpNumThreadsForDim, this does not consider the minimal dimension
+ *  set by IpSetParallelMinDim, since each task is assumed to be expensive.
+ *  Returns 1 if multithreading is disabled, there are less than two tasks,
+ *  or we are already within a parallel region.
+ */
+IPOPTLIB_EXPORT Index IpNumThreadsForTasks(
+   Index ntasks
+);
+
+/** Enable or disable the processing of the blocks of compound vectors
+ *  and matrices by different threads (disabled by default).
+ *
+ *  If enabled, the operations on the individual blocks run serially
+ *  within their thread.
+ */
+IPOPTLIB_EXPORT void IpSetParallelBlocks(
+   bool parallel_blocks
+);
+
+/** Whether the blocks of compound vectors and matrices are processed by different threads. */
+IPOPTLIB_EXPORT bool IpGetParallelBlocks();
+
+/** Number of threads to use for an operation on nblocks blocks with dim elements in total.
+ *
+ *  Returns 1 if the blocks should be processed serially, i.e., if
+ *  multithreading or the processing of blocks in parallel is disabled,
+ *  there is only one block, dim is below the value set by
+ *  IpSetParallelMinDim, or we are already within a parallel region.
+ */
+IPOPTLIB_EXPORT Index IpNumThreadsForBlocks(
+   Index nblocks,
+   Index dim
+);
+
+/** Check whether blocks can be processed by different threads without sharing objects.
+ *
+ *  Each entry of objects is a pair of an object that is accessed when
+ *  processing a block and the number of that block.  Returns true if no
+ *  object is accessed by two different blocks.  The entries of objects
+ *  are reordered.
+ */
+IPOPTLIB_EXPORT bool IpBlocksDisjoint(
+   std::vector<std::pair<const void*, Index> >& objects
+);
+
+/** Range [start, end) of block number block if dim elements are split into nblocks blocks of (almost) equal size. */
+inline void IpBlockRange(
+   Index  dim,
+   Index  nblocks,
+   Index  block,
+   Index& start,
+   Index& end
+)
+{
+   DBG_ASSERT(nblocks > 0 && block >= 0 && block < nblocks);
+   Index blocksize = dim / nblocks;
+   Index remainder = dim % nblocks;
+   start = block * blocksize + Min(block, remainder);
+   end = start + blocksize + (block < remainder ? 1 : 0);
+}
+
 /** Method for comparing two numbers within machine precision.
  *
  *  @return true, if lhs is less or equal the rhs, relaxing
@@ -40,6 +40,15 @@
 
 #endif /* HAVE_CONFIG_H */
 
+/* int64_t is used for indices and Fortran integers in a 64-bit integer build,
+ * and PRId64 to print them */
+#ifdef IPOPT_INT64
+#ifndef __STDC_FORMAT_MACROS
+#define __STDC_FORMAT_MACROS
+#endif
+#include <inttypes.h>
+#endif
+
 
 /* overwrite XYZ_EXPORT from config.h when building XYZ
  * we want it to be __declspec(dllexport) when building a DLL on Windows
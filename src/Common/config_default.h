@@ -37,6 +37,9 @@
 /* If defined, the MUMPS library is available. */
 /* #undef IPOPT_HAS_MUMPS */
 
+/* If defined, MUMPS has been built with the sequential MPI dummy. */
+/* #undef IPOPT_MUMPS_NOMPI */
+
 /* Define to 1 if the linear solver loader should be compiled to allow dynamic
    loading of shared libraries with linear solvers */
 /* #undef IPOPT_HAS_LINEARSOLVERLOADER */
@@ -53,10 +56,17 @@
 /* Define to 1 if WSMP is available */
 /* #undef IPOPT_HAS_WSMP */
 
+/* Define to 1 if Ipopt uses 64-bit integers for indices */
+/* #undef IPOPT_INT64 */
+
 /* Define to the C type corresponding to Fortran INTEGER */
 #ifndef IPOPT_FORTRAN_INTEGER_TYPE
+#ifdef IPOPT_INT64
+#define IPOPT_FORTRAN_INTEGER_TYPE int64_t
+#else
 #define IPOPT_FORTRAN_INTEGER_TYPE int
 #endif
+#endif
 
 /* Define to be the name of C-function for Inf check */
 #ifdef _MSC_VER
@@ -16,10 +16,17 @@
 /* Release Version number of project */
 #define IPOPT_VERSION_RELEASE    3
 
+/* Define to 1 if Ipopt uses 64-bit integers for indices */
+/* #undef IPOPT_INT64 */
+
 /* Define to the C type corresponding to Fortran INTEGER */
 #ifndef IPOPT_FORTRAN_INTEGER_TYPE
+#ifdef IPOPT_INT64
+#define IPOPT_FORTRAN_INTEGER_TYPE int64_t
+#else
 #define IPOPT_FORTRAN_INTEGER_TYPE int
 #endif
+#endif
 
 #ifndef IPOPTLIB_EXPORT
 #if defined(_WIN32) && defined(DLL_EXPORT)
@@ -31,6 +31,10 @@
 #include <cmath>
 #include <fstream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // Factory to facilitate creating IpoptApplication objects from within a DLL
 
 Ipopt::IpoptApplication* IpoptApplicationFactory()
@@ -51,7 +55,8 @@ IpoptApplication::IpoptApplication(
    : read_params_dat_(true),
      rethrow_nonipoptexception_(false),
      inexact_algorithm_(false),
-     replace_bounds_(false)
+     replace_bounds_(false),
+     batch_worker_(false)
 {
    options_ = new OptionsList();
    if( create_empty )
@@ -113,7 +118,8 @@ IpoptApplication::IpoptApplication(
      reg_options_(reg_options),
      options_(options),
      inexact_algorithm_(false),
-     replace_bounds_(false)
+     replace_bounds_(false),
+     batch_worker_(false)
 { }
 
 SmartPtr<IpoptApplication> IpoptApplication::clone()
@@ -235,6 +241,8 @@ ApplicationReturnStatus IpoptApplication::Initialize(
             options_to_print.push_back("print_info_string");
             options_to_print.push_back("inf_pr_output");
             options_to_print.push_back("print_timing_statistics");
+            options_to_print.push_back("timing_trace_file");
+            options_to_print.push_back("timing_trace_format");
 
             options_to_print.push_back("#Termination");
             options_to_print.push_back("tol");
@@ -388,7 +396,7 @@ ApplicationReturnStatus IpoptApplication::Initialize(
             options_to_print.push_back("ma57_small_pivot_flag");
 #endif
 
-#if defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA77) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
             options_to_print.push_back("#MA77 Linear Solver");
             options_to_print.push_back("ma77_print_level");
@@ -404,7 +412,7 @@ ApplicationReturnStatus IpoptApplication::Initialize(
             options_to_print.push_back("ma77_umax");
 #endif
 
-#if defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA86) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
             options_to_print.push_back("#MA86 Linear Solver");
             options_to_print.push_back("ma86_print_level");
@@ -417,7 +425,7 @@ ApplicationReturnStatus IpoptApplication::Initialize(
             options_to_print.push_back("ma86_umax");
 #endif
 
-#if defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)
+#if (defined(COINHSL_HAS_MA97) || defined(IPOPT_HAS_LINEARSOLVERLOADER)) && !defined(IPOPT_INT64)
 
             options_to_print.push_back("#MA97 Linear Solver");
             options_to_print.push_back("ma97_print_level");
@@ -506,6 +514,7 @@ ApplicationReturnStatus IpoptApplication::Initialize(
             categories.push_back("Mumps Linear Solver");
 #endif
             categories.push_back("MA28 Linear Solver");
+            categories.push_back("Multithreading");
 
             categories.push_back("Uncategorized");
             //categories.push_back("Undocumented Options");
@@ -681,6 +690,21 @@ void IpoptApplication::RegisterOptions(
       "no", "don't print statistics",
       "yes", "print all timing statistics",
       "If selected, the program will print the CPU usage (user time) for selected tasks.");
+   roptions->AddStringOption1(
+      "timing_trace_file",
+      "File name for a trace of all timed tasks (leave unset for no trace).",
+      "",
+      "*", "Any acceptable standard file name",
+      "If set, every execution of a timed task (algorithm phases, linear solver calls, function evaluations) "
+      "is recorded with its iteration number, nesting depth, and thread, "
+      "and written to this file at the end of the optimization. "
+      "The file format is selected by \"timing_trace_format\".");
+   roptions->AddStringOption2(
+      "timing_trace_format",
+      "Format of the file written for \"timing_trace_file\".",
+      "json",
+      "json", "JSON object with a list of task executions",
+      "chrome", "Chrome trace event format, as read by chrome://tracing or Perfetto");
 
    roptions->AddStringOption1(
       "option_file_name",
@@ -709,6 +733,35 @@ void IpoptApplication::RegisterOptions(
       "In some Ipopt applications, the user might want to call the FinalizeSolution method separately. "
       "Setting this option to \"yes\" will cause the IpoptApplication object to suppress the default call to that method.");
 
+   roptions->SetRegisteringCategory("Multithreading");
+   roptions->AddLowerBoundedIntegerOption(
+      "num_threads",
+      "Number of threads used in the multithreaded linear algebra kernels.",
+      0,
+      1,
+      "This option has only an effect if Ipopt has been compiled with OpenMP support. "
+      "The value 0 chooses the number of threads that OpenMP uses by default (e.g., as given by OMP_NUM_THREADS). "
+      "The value 1 disables multithreading. "
+      "For OptimizeTNLPBatch, this is the number of problems that are solved concurrently.");
+   roptions->AddLowerBoundedIntegerOption(
+      "parallel_min_dim",
+      "Minimal vector length for which the multithreaded linear algebra kernels are used.",
+      1,
+      100000,
+      "Operations on shorter vectors are done serially, since the overhead of starting threads "
+      "outweighs the gain for them.");
+   roptions->AddStringOption2(
+      "parallel_compound_blocks",
+      "Whether to process the blocks of compound vectors and matrices in parallel.",
+      "no",
+      "no", "process blocks one after another",
+      "yes", "process blocks in parallel",
+      "If enabled, the blocks of compound vectors (e.g., the x, s, y_c, y_d, z_L, z_U, v_L, v_U parts of an iterate) "
+      "and the block rows of compound matrices are processed by different threads, "
+      "while the operations on each block are done serially. "
+      "This can be faster than multithreading the operations on each block if there are many blocks of similar size. "
+      "The option has only an effect if num_threads is larger than 1.");
+
    roptions->SetRegisteringCategory("Undocumented");
    roptions->AddStringOption3(
       "print_options_mode",
@@ -853,6 +906,56 @@ ApplicationReturnStatus IpoptApplication::ReOptimizeNLP(
    return call_optimize();
 }
 
+void IpoptApplication::OptimizeTNLPBatch(
+   const std::vector<SmartPtr<TNLP> >&      tnlps,
+   std::vector<ApplicationReturnStatus>&    status,
+   std::vector<SmartPtr<SolveStatistics> >& statistics
+)
+{
+   const Index ntnlps = (Index) tnlps.size();
+   status.assign(ntnlps, Internal_Error);
+   statistics.assign(ntnlps, NULL);
+
+   Index nworkers = 1;
+#ifdef _OPENMP
+   options_->GetIntegerValue("num_threads", nworkers, "");
+   if( nworkers == 0 )
+   {
+      nworkers = omp_get_max_threads();
+   }
+   nworkers = Max(Min(nworkers, ntnlps), 1);
+#endif
+
+   // Each worker gets its own journalist, registered options, and copy of
+   // the options, so that the workers do not share any reference counted
+   // objects.  Exceptions must not leave the parallel region, so they are
+   // not rethrown.
+   std::vector<SmartPtr<IpoptApplication> > workers(nworkers);
+   for( Index w = 0; w < nworkers; w++ )
+   {
+      workers[w] = new IpoptApplication(false);
+      *workers[w]->options_ = *options_;
+      workers[w]->options_->SetJournalist(workers[w]->jnlst_);
+      workers[w]->options_->SetRegisteredOptions(workers[w]->reg_options_);
+      workers[w]->read_params_dat_ = false;
+      workers[w]->inexact_algorithm_ = inexact_algorithm_;
+      workers[w]->replace_bounds_ = replace_bounds_;
+      workers[w]->batch_worker_ = true;
+   }
+
+   IPOPT_OMP_PARFOR_DYNAMIC(nworkers)
+   for( Index i = 0; i < ntnlps; i++ )
+   {
+#ifdef _OPENMP
+      IpoptApplication& worker = *workers[omp_get_thread_num()];
+#else
+      IpoptApplication& worker = *workers[0];
+#endif
+      status[i] = worker.OptimizeTNLP(tnlps[i]);
+      statistics[i] = worker.Statistics();
+   }
+}
+
 ApplicationReturnStatus IpoptApplication::call_optimize()
 {
    // Reset the print-level for the screen output
@@ -881,9 +984,26 @@ ApplicationReturnStatus IpoptApplication::call_optimize()
    IpoptCalculatedQuantities* p2ip_cq = static_cast<IpoptCalculatedQuantities*>(GetRawPtr(ip_cq_));
    DBG_ASSERT(dynamic_cast<IpoptCalculatedQuantities*> (GetRawPtr(ip_cq_)));
 
+   // Setup multithreading of the linear algebra kernels
+   if( !batch_worker_ )
+   {
+      options_->GetIntegerValue("num_threads", ivalue, "");
+      IpSetNumThreads(ivalue);
+      options_->GetIntegerValue("parallel_min_dim", ivalue, "");
+      IpSetParallelMinDim(ivalue);
+      bool bvalue;
+      options_->GetBoolValue("parallel_compound_blocks", bvalue, "");
+      IpSetParallelBlocks(bvalue);
+   }
+
    // Reset Timing statistics
    ip_data_->TimingStats().ResetTimes();
    p2ip_nlp->ResetTimes();
+   ip_data_->LinearSolverStats().Reset();
+   p2ip_nlp->SetTimedTaskRecorder(&ip_data_->TimingStats());
+   std::string timing_trace_file;
+   options_->GetStringValue("timing_trace_file", timing_trace_file, "");
+   ip_data_->TimingStats().EnableTrace(timing_trace_file != "");
 
    ApplicationReturnStatus retValue = Internal_Error;
    SolverReturn status = INTERNAL_ERROR;
@@ -925,7 +1045,7 @@ ApplicationReturnStatus IpoptApplication::call_optimize()
       // case, we rethrow the TOO_FEW_DOF exception here
       ASSERT_EXCEPTION(status != TOO_FEW_DEGREES_OF_FREEDOM, TOO_FEW_DOF, "Too few degrees of freedom (rethrown)!");
 
-      jnlst_->Printf(J_SUMMARY, J_SOLUTION, "\nNumber of Iterations....: %d\n", p2ip_data->iter_count());
+      jnlst_->Printf(J_SUMMARY, J_SOLUTION, "\nNumber of Iterations....: %" IPOPT_INDEX_FORMAT "\n", p2ip_data->iter_count());
 
       if( status != INVALID_NUMBER_DETECTED )
       {
@@ -966,20 +1086,32 @@ ApplicationReturnStatus IpoptApplication::call_optimize()
          p2ip_cq->curr_d_minus_s()->Print(*jnlst_, J_VECTOR, J_SOLUTION, "curr_d_minus_s");
       }
 
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "\nNumber of objective function evaluations             = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "\nNumber of objective function evaluations             = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->f_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of objective gradient evaluations             = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of objective gradient evaluations             = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->grad_f_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of equality constraint evaluations            = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of equality constraint evaluations            = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->c_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of inequality constraint evaluations          = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of inequality constraint evaluations          = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->d_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of equality constraint Jacobian evaluations   = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of equality constraint Jacobian evaluations   = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->jac_c_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of inequality constraint Jacobian evaluations = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of inequality constraint Jacobian evaluations = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->jac_d_evals());
-      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of Lagrangian Hessian evaluations             = %d\n",
+      jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Number of Lagrangian Hessian evaluations             = %" IPOPT_INDEX_FORMAT "\n",
                      p2ip_nlp->h_evals());
+      const LinearSolverStatistics& linsol_stats = p2ip_data->LinearSolverStats();
+      jnlst_->Printf(J_DETAILED, J_STATISTICS, "Number of linear system factorizations               = %" IPOPT_INDEX_FORMAT "\n",
+                     linsol_stats.NumFactorizations());
+      jnlst_->Printf(J_DETAILED, J_STATISTICS, "Number of linear solver quality increases            = %" IPOPT_INDEX_FORMAT "\n",
+                     linsol_stats.NumQualityIncreases());
+      jnlst_->Printf(J_DETAILED, J_STATISTICS, "Number of inertia corrections                        = %" IPOPT_INDEX_FORMAT "\n",
+                     linsol_stats.NumInertiaCorrections());
+      if( linsol_stats.PeakMemory() >= 0. )
+      {
+         jnlst_->Printf(J_DETAILED, J_STATISTICS, "Peak memory of linear system factorizations (MB)     = %10.3f\n",
+                        1e-6 * linsol_stats.PeakMemory());
+      }
       Number cpu_time_overall_alg = p2ip_data->TimingStats().OverallAlgorithm().TotalCpuTime();
       Number cpu_time_funcs = p2ip_nlp->TotalFunctionEvaluationCpuTime();
       jnlst_->Printf(J_SUMMARY, J_STATISTICS, "Total CPU secs in IPOPT (w/o function evaluations)   = %10.3f\n",
@@ -995,6 +1127,19 @@ ApplicationReturnStatus IpoptApplication::call_optimize()
          p2ip_nlp->PrintTimingStatistics(*jnlst_, J_SUMMARY, J_TIMING_STATISTICS);
       }
 
+      // Write trace of timed tasks
+      if( timing_trace_file != "" )
+      {
+         std::string timing_trace_format;
+         options_->GetStringValue("timing_trace_format", timing_trace_format, "");
+         if( !p2ip_data->TimingStats().WriteTrace(timing_trace_file, timing_trace_format == "chrome") )
+         {
+            jnlst_->Printf(J_WARNING, J_MAIN, "\nWARNING: Could not write timing trace to file \"%s\".\n",
+                           timing_trace_file.c_str());
+         }
+         p2ip_data->TimingStats().EnableTrace(false);
+      }
+
       // Write EXIT message
       if( status == SUCCESS )
       {
@@ -16,6 +16,7 @@
 #endif
 
 #include <iostream>
+#include <vector>
 
 #include "IpJournalist.hpp"
 #include "IpTNLP.hpp"
@@ -184,6 +185,27 @@ public:
    virtual ApplicationReturnStatus ReOptimizeNLP(
       const SmartPtr<NLP>& nlp
    );
+
+   /** Solve several independent problems that inherit from TNLP.
+    *
+    *  If Ipopt has been compiled with OpenMP support, the problems are
+    *  distributed onto up to num_threads (option) worker threads.
+    *  Each worker uses its own copy of the options of this application
+    *  and its own Journalist without journals, i.e., the solves do not
+    *  produce output.  The multithreaded kernels run serially within a
+    *  worker.  The TNLP objects must be distinct and, as the linear
+    *  solver, must allow for being used from different threads.
+    *
+    *  On return, status[i] and statistics[i] hold the return status and
+    *  the statistics of the solve of tnlps[i].  Options registered by
+    *  the user in addition to the Ipopt options are not available
+    *  to the workers.
+    */
+   virtual void OptimizeTNLPBatch(
+      const std::vector<SmartPtr<TNLP> >&      tnlps,
+      std::vector<ApplicationReturnStatus>&    status,
+      std::vector<SmartPtr<SolveStatistics> >& statistics
+   );
    //@}
 
    /** Method for opening an output file with given print_level.
@@ -364,6 +386,12 @@ private:
     *  This is necessary for the inexact algorithm.
     */
    bool replace_bounds_;
+
+   /** Flag indicating that this application is a worker of
+    *  OptimizeTNLPBatch, which must not change the global settings
+    *  of the multithreaded kernels.
+    */
+   bool batch_worker_;
    //@}
 };
 
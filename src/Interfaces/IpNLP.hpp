@@ -156,6 +156,44 @@ public:
       const Vector& yd,
       SymMatrix&    h
    ) = 0;
+
+   /** Evaluate several quantities at the same point x in one go.
+    *
+    *  Quantities whose argument is NULL are not requested.
+    *  The default dummy implementation returns false, in which case the
+    *  quantities are evaluated by the individual methods above.
+    */
+   virtual bool Eval_all(
+      const Vector& /*x*/,
+      Number*       /*f*/,
+      Vector*       /*g_f*/,
+      Vector*       /*c*/,
+      Vector*       /*d*/,
+      Matrix*       /*jac_c*/,
+      Matrix*       /*jac_d*/
+   )
+   {
+      return false;
+   }
+
+   /** Evaluate the objective function and the constraints at several
+    *  points, possibly concurrently.
+    *
+    *  On return, success[i] indicates whether f[i], c[i], and d[i] could
+    *  be computed at the point x[i].  The default dummy implementation
+    *  returns false, in which case nothing has been evaluated.
+    */
+   virtual bool Eval_f_c_d_at_points(
+      Index                /*npoints*/,
+      const Vector* const* /*x*/,
+      Number*              /*f*/,
+      Vector* const*       /*c*/,
+      Vector* const*       /*d*/,
+      bool*                /*success*/
+   )
+   {
+      return false;
+   }
    //@}
 
    /** @name NLP solution routines.
@@ -35,7 +35,12 @@ SolveStatistics::SolveStatistics(
      scaled_compl_(ip_cq->curr_complementarity(0., NORM_MAX)),
      compl_(ip_cq->unscaled_curr_complementarity(0., NORM_MAX)),
      scaled_kkt_error_(ip_cq->curr_nlp_error()),
-     kkt_error_(ip_cq->unscaled_curr_nlp_error())
+     kkt_error_(ip_cq->unscaled_curr_nlp_error()),
+     num_factorizations_(ip_data->LinearSolverStats().NumFactorizations()),
+     num_quality_increases_(ip_data->LinearSolverStats().NumQualityIncreases()),
+     num_inertia_corrections_(ip_data->LinearSolverStats().NumInertiaCorrections()),
+     peak_factorization_memory_(ip_data->LinearSolverStats().PeakMemory()),
+     total_factorization_flops_(ip_data->LinearSolverStats().TotalFlops())
 { }
 
 Index SolveStatistics::IterationCount() const
@@ -109,4 +114,19 @@ Number SolveStatistics::FinalScaledObjective() const
    return scaled_obj_val_;
 }
 
+void SolveStatistics::FactorizationStatistics(
+   Index&  num_factorizations,
+   Index&  num_quality_increases,
+   Index&  num_inertia_corrections,
+   Number& peak_memory,
+   Number& total_flops
+) const
+{
+   num_factorizations      = num_factorizations_;
+   num_quality_increases   = num_quality_increases_;
+   num_inertia_corrections = num_inertia_corrections_;
+   peak_memory             = peak_factorization_memory_;
+   total_flops             = total_factorization_flops_;
+}
+
 } // namespace Ipopt
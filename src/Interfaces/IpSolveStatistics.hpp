@@ -99,6 +99,19 @@ public:
 
    /** Final scaled value of objective function */
    virtual Number FinalScaledObjective() const;
+
+   /** Statistics about the factorizations of the linear systems.
+    *
+    *  Peak memory is given in bytes and is -1 if the linear solver
+    *  does not report its memory usage.
+    */
+   virtual void FactorizationStatistics(
+      Index&  num_factorizations,
+      Index&  num_quality_increases,
+      Index&  num_inertia_corrections,
+      Number& peak_memory,
+      Number& total_flops
+   ) const;
    //@}
 
 private:
@@ -167,6 +180,16 @@ private:
    Number scaled_kkt_error_;
    /** Final overall unscaled KKT error (max-norm) */
    Number kkt_error_;
+   /** Number of factorizations of the linear system */
+   Index num_factorizations_;
+   /** Number of quality increases of the linear solver */
+   Index num_quality_increases_;
+   /** Number of inertia corrections */
+   Index num_inertia_corrections_;
+   /** Peak memory of a factorization in bytes */
+   Number peak_factorization_memory_;
+   /** Floating point operations of all factorizations */
+   Number total_factorization_flops_;
    //@}
 };
 
@@ -10,6 +10,9 @@
 #include "IpStdInterfaceTNLP.hpp"
 #include "IpOptionsList.hpp"
 #include "IpIpoptApplication.hpp"
+#ifdef IPOPT_HAS_MUMPS
+# include "IpMumpsSolverInterface.hpp"
+#endif
 
 struct IpoptProblemInfo
 {
@@ -317,3 +320,27 @@ enum ApplicationReturnStatus IpoptSolve(
 
    return ApplicationReturnStatus(status);
 }
+
+Bool RunIpoptMumpsService(
+   Int comm_fortran
+)
+{
+#ifdef IPOPT_HAS_MUMPS
+   return (Bool) Ipopt::MumpsSolverInterface::RunMPIService(comm_fortran);
+#else
+   (void) comm_fortran;
+   return (Bool) false;
+#endif
+}
+
+Bool StopIpoptMumpsService(
+   Int comm_fortran
+)
+{
+#ifdef IPOPT_HAS_MUMPS
+   return (Bool) Ipopt::MumpsSolverInterface::StopMPIService(comm_fortran);
+#else
+   (void) comm_fortran;
+   return (Bool) false;
+#endif
+}
@@ -33,7 +33,23 @@ typedef double Number;
  *
  * We need to make sure that this is identical with what is defined in Common/IpTypes.hpp
  */
+#ifdef IPOPT_INT64
+typedef int64_t Index;
+#else
 typedef int Index;
+#endif
+
+/** Conversion specifier to print an Index with printf, to be used as "%" IPOPT_INDEX_FORMAT.
+ *
+ * We need to make sure that this is identical with what is defined in Common/IpTypes.hpp
+ */
+#ifndef IPOPT_INDEX_FORMAT
+#ifdef IPOPT_INT64
+#define IPOPT_INDEX_FORMAT PRId64
+#else
+#define IPOPT_INDEX_FORMAT "d"
+#endif
+#endif
 
 /** Type for all integers.
  *
@@ -334,6 +350,31 @@ IPOPTLIB_EXPORT IPOPT_EXPORT(enum ApplicationReturnStatus) IpoptSolve(
                                 */
 );
 
+/** Function to run the parallel linear solver MUMPS on an MPI process that does not run Ipopt.
+ *
+ *  To let MUMPS run in parallel, set the option mumps_mpi_comm to a
+ *  communicator and call IpoptSolve on the process with rank 0 of this
+ *  communicator.  All other processes of the communicator call this
+ *  function, which takes part in all calls of MUMPS from the process
+ *  with rank 0 and returns after that process called StopIpoptMumpsService.
+ *
+ * @return false, if Ipopt has not been compiled with a parallel version of MUMPS
+ */
+IPOPTLIB_EXPORT IPOPT_EXPORT(Bool) RunIpoptMumpsService(
+   Int comm_fortran  /**< Fortran handle of the communicator, as returned by MPI_Comm_c2f */
+);
+
+/** Function to make all processes that run RunIpoptMumpsService return.
+ *
+ *  To be called on the process with rank 0 after all problems that use
+ *  the communicator have been freed with FreeIpoptProblem.
+ *
+ * @return false, if Ipopt has not been compiled with a parallel version of MUMPS
+ */
+IPOPTLIB_EXPORT IPOPT_EXPORT(Bool) StopIpoptMumpsService(
+   Int comm_fortran  /**< Fortran handle of the communicator, as returned by MPI_Comm_c2f */
+);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -497,6 +497,59 @@ public:
       (void) values;
       return false;
    }
+
+   /** Method to request several of the function values and first derivatives at the same point at once.
+    *
+    *  \Ipopt calls this method if it needs more than one of the objective
+    *  value, the objective gradient, the constraint values, and the
+    *  constraint Jacobian at a point, e.g., the function values at a trial
+    *  point and the derivatives once the trial point has been accepted.
+    *  An implementation can then share work between these quantities,
+    *  e.g., a forward pass of automatic differentiation.
+    *
+    *  @param n     (in) the number of variables \f$x\f$ in the problem; it will have the same value that was specified in TNLP::get_nlp_info
+    *  @param x     (in) the values for the primal variables \f$x\f$ at which the quantities are to be evaluated
+    *  @param new_x (in) false if any evaluation method (`eval_*`) was previously called with the same values in x, true otherwise; see also TNLP::eval_f
+    *  @param obj_value (out) storage for the value of the objective function, or NULL if not requested
+    *  @param grad_f (out) array of length n to store the gradient of the objective function, or NULL if not requested
+    *  @param m     (in) the number of constraints \f$g(x)\f$ in the problem; it will have the same value that was specified in TNLP::get_nlp_info
+    *  @param g     (out) array of length m to store the constraint values, or NULL if not requested
+    *  @param nele_jac (in) the number of nonzero elements in the Jacobian; it will have the same value that was specified in TNLP::get_nlp_info
+    *  @param jac_values (out) array of length nele_jac to store the values of the Jacobian entries
+    *                   in the order of the sparsity structure given by TNLP::eval_jac_g, or NULL if not requested
+    *
+    *  @return true if all requested quantities have been computed,
+    *  false otherwise.  If false is returned, \Ipopt evaluates the
+    *  quantities by the individual `eval_*` methods instead, passing
+    *  new_x as true to the first of these calls.
+    *
+    *  The default implementation returns false.
+    */
+   // [TNLP_eval_all]
+   virtual bool eval_all(
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number*       obj_value,
+      Number*       grad_f,
+      Index         m,
+      Number*       g,
+      Index         nele_jac,
+      Number*       jac_values
+   )
+   // [TNLP_eval_all]
+   {
+      (void) n;
+      (void) x;
+      (void) new_x;
+      (void) obj_value;
+      (void) grad_f;
+      (void) m;
+      (void) g;
+      (void) nele_jac;
+      (void) jac_values;
+      return false;
+   }
    //@}
 
    /** @name Solution Methods */
@@ -743,6 +796,184 @@ public:
    }
    //@}
 
+   /** @name Methods for the parallel evaluation of derivatives.
+    *
+    *  If the constraints can be partitioned into blocks whose Jacobian
+    *  rows and Hessian entries can be evaluated independently of each other,
+    *  \Ipopt can evaluate these blocks concurrently on up to num_threads
+    *  threads (requires that \Ipopt has been compiled with OpenMP support).
+    *  In that case, \Ipopt obtains the values of the Jacobian of the
+    *  constraints and the Hessian of the Lagrangian from eval_jac_g_block
+    *  and eval_h_block instead of eval_jac_g and eval_h.  Each block writes
+    *  directly into its own part of the arrays that \Ipopt would otherwise
+    *  pass to eval_jac_g and eval_h.  The sparsity structures are still
+    *  obtained from eval_jac_g and eval_h.
+    *
+    *  The block evaluation methods may be called concurrently for different
+    *  blocks.  They must therefore be thread-safe and must not throw
+    *  exceptions.  All blocks of one evaluation receive the same value of
+    *  new_x and new_lambda; if data that is shared between blocks is
+    *  updated for a new point, this needs to be synchronized by the TNLP.
+    *
+    * @{
+    */
+
+   /** Return whether the function evaluations of the TNLP are reentrant.
+    *
+    *  If true, \Ipopt may call eval_f, eval_grad_f, eval_g, and eval_jac_g
+    *  concurrently for different points on up to num_threads threads if
+    *  these functions are needed at several points at once, e.g., for the
+    *  finite-difference approximation of the Jacobian or in the derivative
+    *  checker.  Such calls pass new_x as true and must not throw exceptions.
+    *
+    *  The default implementation returns false.
+    */
+   // [TNLP_is_reentrant]
+   virtual bool is_reentrant()
+   // [TNLP_is_reentrant]
+   {
+      return false;
+   }
+
+   /** Return the number of blocks for the parallel evaluation of derivatives.
+    *
+    *  If a positive number is returned, \Ipopt calls get_derivative_blocks
+    *  to obtain the partition and then evaluates the derivatives by blocks.
+    *  The default implementation returns 0, i.e., the derivatives are
+    *  evaluated by eval_jac_g and eval_h.
+    */
+   // [TNLP_get_number_of_derivative_blocks]
+   virtual Index get_number_of_derivative_blocks()
+   // [TNLP_get_number_of_derivative_blocks]
+   {
+      return 0;
+   }
+
+   /** Return the partition of the constraints and the Hessian entries into blocks.
+    *
+    *  Block b consists of the constraints with positions
+    *  con_block_start[b], ..., con_block_start[b+1]-1 and of the Hessian
+    *  entries with positions hess_block_start[b], ..., hess_block_start[b+1]-1
+    *  in the sparsity structure returned by eval_h.  Positions are counted
+    *  from 0, independent of the index style.  Both arrays have length
+    *  num_blocks+1, must be nondecreasing, and start with 0.  The last entry
+    *  of con_block_start must be m and the last entry of hess_block_start
+    *  must be nele_hess.
+    *
+    *  The entries of the sparsity structure returned by eval_jac_g must
+    *  be ordered by blocks, i.e., all entries in constraints of block b must
+    *  come before the entries in constraints of block b+1.
+    *
+    *  @param num_blocks (in) the number of blocks as returned by get_number_of_derivative_blocks
+    *  @param m     (in) the number of constraints \f$g(x)\f$ in the problem
+    *  @param nele_hess (in) the number of nonzero elements in the Hessian
+    *  @param con_block_start (out) array of length num_blocks+1 for the first constraint of each block
+    *  @param hess_block_start (out) array of length num_blocks+1 for the first Hessian entry of each block
+    *
+    *  @return true if success, false otherwise.
+    */
+   // [TNLP_get_derivative_blocks]
+   virtual bool get_derivative_blocks(
+      Index  num_blocks,
+      Index  m,
+      Index  nele_hess,
+      Index* con_block_start,
+      Index* hess_block_start
+   )
+   // [TNLP_get_derivative_blocks]
+   {
+      (void) num_blocks;
+      (void) m;
+      (void) nele_hess;
+      (void) con_block_start;
+      (void) hess_block_start;
+      return false;
+   }
+
+   /** Method to request the values of the Jacobian entries of one block.
+    *
+    *  @param block (in) the number of the block, counted from 0
+    *  @param n     (in) the number of variables \f$x\f$ in the problem
+    *  @param x     (in) the values for the primal variables \f$x\f$ at which the Jacobian is to be evaluated
+    *  @param new_x (in) false if any evaluation method (`eval_*`) was previously called with the same values in x, true otherwise
+    *  @param m     (in) the number of constraints \f$g(x)\f$ in the problem
+    *  @param nele_jac_block (in) the number of Jacobian entries in the constraints of this block
+    *  @param values (out) array of length nele_jac_block to store the values of the Jacobian entries
+    *                      of this block, in the order of the sparsity structure returned by eval_jac_g
+    *
+    *  @return true if success, false otherwise.
+    */
+   // [TNLP_eval_jac_g_block]
+   virtual bool eval_jac_g_block(
+      Index         block,
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Index         m,
+      Index         nele_jac_block,
+      Number*       values
+   )
+   // [TNLP_eval_jac_g_block]
+   {
+      (void) block;
+      (void) n;
+      (void) x;
+      (void) new_x;
+      (void) m;
+      (void) nele_jac_block;
+      (void) values;
+      return false;
+   }
+
+   /** Method to request the values of the Hessian entries of one block.
+    *
+    *  The values are those of the Hessian of the Lagrangian, see eval_h,
+    *  i.e., they include the contributions of the objective function and of
+    *  all constraints to the entries of this block.
+    *
+    *  @param block (in) the number of the block, counted from 0
+    *  @param n     (in) the number of variables \f$x\f$ in the problem
+    *  @param x     (in) the values for the primal variables \f$x\f$ at which the Hessian is to be evaluated
+    *  @param new_x (in) false if any evaluation method (`eval_*`) was previously called with the same values in x, true otherwise
+    *  @param obj_factor (in) factor \f$\sigma_f\f$ in front of the objective term in the Hessian
+    *  @param m     (in) the number of constraints \f$g(x)\f$ in the problem
+    *  @param lambda (in) the values for the constraint multipliers \f$\lambda\f$ at which the Hessian is to be evaluated
+    *  @param new_lambda (in) false if any evaluation method was previously called with the same values in lambda, true otherwise
+    *  @param nele_hess_block (in) the number of Hessian entries of this block
+    *  @param values (out) array of length nele_hess_block to store the values of the Hessian entries
+    *                      of this block, in the order of the sparsity structure returned by eval_h
+    *
+    *  @return true if success, false otherwise.
+    */
+   // [TNLP_eval_h_block]
+   virtual bool eval_h_block(
+      Index         block,
+      Index         n,
+      const Number* x,
+      bool          new_x,
+      Number        obj_factor,
+      Index         m,
+      const Number* lambda,
+      bool          new_lambda,
+      Index         nele_hess_block,
+      Number*       values
+   )
+   // [TNLP_eval_h_block]
+   {
+      (void) block;
+      (void) n;
+      (void) x;
+      (void) new_x;
+      (void) obj_factor;
+      (void) m;
+      (void) lambda;
+      (void) new_lambda;
+      (void) nele_hess_block;
+      (void) values;
+      return false;
+   }
+   //@}
+
 private:
    /**@name Default Compiler Generated Methods
     * (Hidden to avoid implicit creation/calling).
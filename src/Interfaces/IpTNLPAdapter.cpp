@@ -15,7 +15,7 @@
 #include "IpSymTMatrix.hpp"
 #include "IpTDependencyDetector.hpp"
 #include "IpTSymDependencyDetector.hpp"
-#include "IpTripletToCSRConverter.hpp"
+#include "IpTripletHelper.hpp"
 
 #ifdef IPOPT_HAS_HSL
 #include "CoinHslConfig.h"
@@ -33,6 +33,7 @@
 # include "HSLLoader.h"
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
@@ -66,7 +67,12 @@ TNLPAdapter::TNLPAdapter(
      findiff_jac_ja_(NULL),
      findiff_jac_postriplet_(NULL),
      findiff_x_l_(NULL),
-     findiff_x_u_(NULL)
+     findiff_x_u_(NULL),
+     findiff_num_colors_(0),
+     findiff_color_ia_(NULL),
+     findiff_color_ja_(NULL),
+     findiff_hess_num_colors_(0),
+     num_deriv_blocks_(0)
 {
    ASSERT_EXCEPTION(IsValid(tnlp_), INVALID_TNLP, "The TNLP passed to TNLPAdapter is NULL. This MUST be a valid TNLP!");
 }
@@ -86,6 +92,8 @@ TNLPAdapter::~TNLPAdapter()
    delete[] findiff_jac_postriplet_;
    delete[] findiff_x_l_;
    delete[] findiff_x_u_;
+   delete[] findiff_color_ia_;
+   delete[] findiff_color_ja_;
 }
 
 void TNLPAdapter::RegisterOptions(
@@ -157,7 +165,8 @@ void TNLPAdapter::RegisterOptions(
       "If this is set to -2, then all derivatives are checked. "
       "Otherwise, for the first derivative test it specifies the first variable for which the test is done (counting starts at 0). "
       "For second derivatives, it specifies the first constraint for which the test is done; "
-      "counting of constraint indices starts at 0, and -1 refers to the objective function Hessian.");
+      "counting of constraint indices starts at 0, and -1 refers to the objective function Hessian. "
+      "This is ignored if derivative_test_mode is \"colored\".");
    roptions->AddLowerBoundedNumberOption(
       "derivative_test_perturbation",
       "Size of the finite difference perturbation in derivative test.",
@@ -178,6 +187,27 @@ void TNLPAdapter::RegisterOptions(
       "no", "Print only suspect derivatives",
       "yes", "Print all derivatives",
       "Determines verbosity of derivative checker.");
+   roptions->AddStringOption3(
+      "derivative_test_mode",
+      "Determines which derivatives are compared by the derivative checker.",
+      "all",
+      "all", "compare every derivative with a finite difference for each variable",
+      "sampled", "compare the derivatives for a random sample of variables and constraints and along a random direction",
+      "colored", "perturb groups of variables that do not share a constraint at once",
+      "For \"all\", one perturbed point is evaluated per variable (and per function for second derivatives). "
+      "For \"sampled\", the test is restricted to derivative_test_sample_size randomly chosen variables and constraints, "
+      "and the derivatives of all functions are additionally compared along a random direction. "
+      "For \"colored\", the variables are grouped such that the columns of the Jacobian (or the Hessian) of each group do not overlap, "
+      "so that all entries of a group can be checked with one perturbed point; "
+      "second derivatives are then checked for the Hessian of a Lagrangian with random multipliers, "
+      "and finite differences that cannot be attributed to an entry of the sparsity structure are reported for the group. "
+      "If the TNLP is reentrant, the perturbed points are evaluated in parallel.");
+   roptions->AddLowerBoundedIntegerOption(
+      "derivative_test_sample_size",
+      "Number of variables and constraints that are checked by the sampled derivative checker.",
+      1,
+      100,
+      "This is only used if derivative_test_mode is \"sampled\".");
    roptions->AddStringOption2(
       "jacobian_approximation",
       "Specifies technique to compute constraint Jacobian",
@@ -223,6 +253,9 @@ bool TNLPAdapter::ProcessOptions(
    options.GetNumericValue("derivative_test_tol", derivative_test_tol_, prefix);
    options.GetBoolValue("derivative_test_print_all", derivative_test_print_all_, prefix);
    options.GetIntegerValue("derivative_test_first_index", derivative_test_first_index_, prefix);
+   options.GetEnumValue("derivative_test_mode", enum_int, prefix);
+   derivative_test_mode_ = DerivativeTestModeEnum(enum_int);
+   options.GetIntegerValue("derivative_test_sample_size", derivative_test_sample_size_, prefix);
 
    // The option warm_start_same_structure is registered by OrigIpoptNLP
    options.GetBoolValue("warm_start_same_structure", warm_start_same_structure_, prefix);
@@ -234,6 +267,11 @@ bool TNLPAdapter::ProcessOptions(
    options.GetEnumValue("jacobian_approximation", enum_int, prefix);
    jacobian_approximation_ = JacobianApproxEnum(enum_int);
    options.GetNumericValue("findiff_perturbation", findiff_perturbation_, prefix);
+   if( hessian_approximation_ == FINDIFF_VALUES && jacobian_approximation_ != JAC_EXACT )
+   {
+      THROW_EXCEPTION(OPTION_INVALID,
+                      "The finite-difference approximation of the Hessian requires the exact Jacobian (jacobian_approximation = exact).");
+   }
 
    options.GetNumericValue("point_perturbation_radius", point_perturbation_radius_, prefix);
 
@@ -354,6 +392,7 @@ bool TNLPAdapter::GetSpaces(
       h_idx_map_ = NULL;
       delete[] x_fixed_map_;
       x_fixed_map_ = NULL;
+      num_deriv_blocks_ = 0;
    }
 
    // Get the full dimensions of the problem
@@ -478,7 +517,7 @@ bool TNLPAdapter::GetSpaces(
             {
                char string[128];
                Snprintf(string, 127,
-                        "There are inconsistent bounds on variable %d: lower = %25.16e and upper = %25.16e.", i, lower_bound,
+                        "There are inconsistent bounds on variable %" IPOPT_INDEX_FORMAT ": lower = %25.16e and upper = %25.16e.", i, lower_bound,
                         upper_bound);
                delete[] x_l;
                delete[] x_u;
@@ -570,7 +609,7 @@ bool TNLPAdapter::GetSpaces(
                delete[] d_u_map;
                char string[128];
                Snprintf(string, 127,
-                        "There are inconsistent bounds on constraint function %d: lower = %25.16e and upper = %25.16e.", i,
+                        "There are inconsistent bounds on constraint function %" IPOPT_INDEX_FORMAT ": lower = %25.16e and upper = %25.16e.", i,
                         lower_bound, upper_bound);
                THROW_EXCEPTION(INCONSISTENT_BOUNDS, string);
             }
@@ -600,7 +639,7 @@ bool TNLPAdapter::GetSpaces(
          {
             fixed_variable_treatment_ = RELAX_BOUNDS;
             jnlst_->Printf(J_WARNING, J_INITIALIZATION,
-                           "Too few degrees of freedom (n_x = %d, n_c = %d).\n  Trying fixed_variable_treatment = RELAX_BOUNDS\n\n",
+                           "Too few degrees of freedom (n_x = %" IPOPT_INDEX_FORMAT ", n_c = %" IPOPT_INDEX_FORMAT ").\n  Trying fixed_variable_treatment = RELAX_BOUNDS\n\n",
                            n_x_var, n_c);
          }
       } // while (!done)
@@ -701,7 +740,8 @@ bool TNLPAdapter::GetSpaces(
          if( c_deps.size() > 0 )
          {
             jnlst_->Printf(J_WARNING, J_INITIALIZATION,
-                           "\nDetected %d linearly dependent equality constraints; taking those out.\n\n", c_deps.size());
+                           "\nDetected %" IPOPT_INDEX_FORMAT " linearly dependent equality constraints; taking those out.\n\n",
+                          (Index) c_deps.size());
          }
          else
          {
@@ -713,7 +753,7 @@ bool TNLPAdapter::GetSpaces(
             int count = 0;
             for( std::list<Index>::iterator i = c_deps.begin(); i != c_deps.end(); i++ )
             {
-               jnlst_->Printf(J_DETAILED, J_INITIALIZATION, "c_dep[%d] = %d\n", count++, *i);
+               jnlst_->Printf(J_DETAILED, J_INITIALIZATION, "c_dep[%d] = %" IPOPT_INDEX_FORMAT "\n", count++, *i);
             }
             jnlst_->Printf(J_DETAILED, J_INITIALIZATION, "\n");
          }
@@ -1138,6 +1178,18 @@ bool TNLPAdapter::GetSpaces(
       {
          initialize_findiff_jac(g_iRow, g_jCol);
       }
+      if( hessian_approximation_ == FINDIFF_VALUES )
+      {
+         findiff_hess_jac_iRow_.resize(nz_full_jac_g_);
+         findiff_hess_jac_jCol_.resize(nz_full_jac_g_);
+         for( Index i = 0; i < nz_full_jac_g_; i++ )
+         {
+            findiff_hess_jac_iRow_[i] = g_iRow[i] - 1;
+            findiff_hess_jac_jCol_[i] = g_jCol[i] - 1;
+         }
+      }
+
+      initialize_derivative_blocks(g_iRow);
 
       // ... build the non-zero structure for jac_c
       // ... (the permutation from rows in jac_g to jac_c is
@@ -1263,7 +1315,7 @@ bool TNLPAdapter::GetSpaces(
       delete[] g_jCol;
       g_jCol = NULL;
 
-      if( hessian_approximation_ == EXACT )
+      if( hessian_approximation_ != LIMITED_MEMORY )
       {
          /** Create the matrix space for the hessian of the lagrangian */
          Index* full_h_iRow = new Index[nz_full_h_];
@@ -1308,6 +1360,11 @@ bool TNLPAdapter::GetSpaces(
          }
 #endif
 
+         if( hessian_approximation_ == FINDIFF_VALUES )
+         {
+            initialize_findiff_hess(full_h_iRow, full_h_jCol);
+         }
+
          current_nz = 0;
          if( IsValid(P_x_full_x_) )
          {
@@ -1375,11 +1432,11 @@ bool TNLPAdapter::GetSpaces(
 
    if( IsValid(jnlst_) )
    {
-      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in equality constraint Jacobian...:%9d\n",
+      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in equality constraint Jacobian...:%9" IPOPT_INDEX_FORMAT "\n",
                      nz_jac_c_);
-      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in inequality constraint Jacobian.:%9d\n",
+      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in inequality constraint Jacobian.:%9" IPOPT_INDEX_FORMAT "\n",
                      nz_jac_d_);
-      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in Lagrangian Hessian.............:%9d\n\n",
+      jnlst_->Printf(J_ITERSUMMARY, J_STATISTICS, "Number of nonzeros in Lagrangian Hessian.............:%9" IPOPT_INDEX_FORMAT "\n\n",
                      nz_h_);
    }
 
@@ -1530,7 +1587,7 @@ bool TNLPAdapter::GetBoundsInformation(
    }
 
    // In case we are doing finite differences, keep a copy of the bounds
-   if( jacobian_approximation_ != JAC_EXACT )
+   if( jacobian_approximation_ != JAC_EXACT || hessian_approximation_ == FINDIFF_VALUES )
    {
       delete[] findiff_x_l_;
       delete[] findiff_x_u_;
@@ -1770,23 +1827,7 @@ bool TNLPAdapter::Eval_c(
 
    if( internal_eval_g(new_x) )
    {
-      DenseVector* dc = static_cast<DenseVector*>(&c);
-      DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
-      Number* values = dc->Values();
-      const Index* c_pos = P_c_g_->ExpandedPosIndices();
-      Index n_c_no_fixed = P_c_g_->NCols();
-      for( Index i = 0; i < n_c_no_fixed; i++ )
-      {
-         values[i] = full_g_[c_pos[i]];
-         values[i] -= c_rhs_[i];
-      }
-      if( fixed_variable_treatment_ == MAKE_CONSTRAINT )
-      {
-         for( Index i = 0; i < n_x_fixed_; i++ )
-         {
-            values[n_c_no_fixed + i] = full_x_[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed + i];
-         }
-      }
+      ExtractC(full_g_, full_x_, c);
       return true;
    }
 
@@ -1836,16 +1877,9 @@ bool TNLPAdapter::Eval_d(
       new_x = true;
    }
 
-   DenseVector* dd = static_cast<DenseVector*>(&d);
-   DBG_ASSERT(dynamic_cast<DenseVector*>(&d));
-   Number* values = dd->Values();
    if( internal_eval_g(new_x) )
    {
-      const Index* d_pos = P_d_g_->ExpandedPosIndices();
-      for( Index i = 0; i < d.Dim(); i++ )
-      {
-         values[i] = full_g_[d_pos[i]];
-      }
+      ExtractD(full_g_, d);
       return true;
    }
 
@@ -1919,30 +1953,187 @@ bool TNLPAdapter::Eval_h(
    DBG_ASSERT(dynamic_cast<SymTMatrix*>(&h));
    Number* values = st_h->Values();
 
-   if( h_idx_map_ )
+   // If variables have been removed, evaluate the full Hessian into a
+   // temporary array first
+   Number* full_h = h_idx_map_ ? new Number[nz_full_h_] : values;
+
+   if( hessian_approximation_ == FINDIFF_VALUES )
    {
-      Number* full_h = new Number[nz_full_h_];
+      retval = eval_findiff_h(new_x, obj_factor, full_h);
+   }
+   else if( num_deriv_blocks_ > 0 )
+   {
+      retval = eval_h_blocks(deriv_block_hess_start_, n_full_x_, full_x_, new_x, obj_factor, n_full_g_, full_lambda_, new_y,
+                             full_h);
+   }
+   else
+   {
+      retval = tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_, full_lambda_, new_y, nz_full_h_, NULL,
+                             NULL, full_h);
+   }
 
-      if( tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_, full_lambda_, new_y, nz_full_h_, NULL, NULL,
-                        full_h) )
+   if( h_idx_map_ )
+   {
+      if( retval )
       {
          for( Index i = 0; i < nz_h_; i++ )
          {
             values[i] = full_h[h_idx_map_[i]];
          }
-         retval = true;
       }
       delete[] full_h;
    }
-   else
+
+   return retval;
+}
+
+bool TNLPAdapter::Eval_all(
+   const Vector& x,
+   Number*       f,
+   Vector*       g_f,
+   Vector*       c,
+   Vector*       d,
+   Matrix*       jac_c,
+   Matrix*       jac_d
+)
+{
+   bool new_x = false;
+   if( update_local_x(x) )
    {
-      retval = tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_, full_lambda_, new_y, nz_full_h_, NULL,
-                             NULL, values);
+      new_x = true;
+   }
+
+   // Request the constraint values and the Jacobian only if they are not
+   // available for this point yet.  A Jacobian that is approximated by
+   // finite differences or evaluated by blocks is computed below.
+   bool need_g = (c != NULL || d != NULL) && x_tag_for_g_ != x_tag_for_iterates_;
+   bool need_jac_g = (jac_c != NULL || jac_d != NULL) && x_tag_for_jac_g_ != x_tag_for_iterates_
+                     && jacobian_approximation_ == JAC_EXACT && num_deriv_blocks_ == 0;
+
+   Number* full_grad_f = NULL;
+   if( g_f != NULL )
+   {
+      DenseVector* dg_f = static_cast<DenseVector*>(g_f);
+      DBG_ASSERT(dynamic_cast<DenseVector*>(g_f));
+      if( IsValid(P_x_full_x_) )
+      {
+         full_grad_f = new Number[n_full_x_];
+      }
+      else
+      {
+         full_grad_f = dg_f->Values();
+      }
+   }
+
+   bool retval = tnlp_->eval_all(n_full_x_, full_x_, new_x, f, full_grad_f, n_full_g_, need_g ? full_g_ : NULL,
+                                 nz_full_jac_g_, need_jac_g ? jac_g_ : NULL);
+
+   if( g_f != NULL && IsValid(P_x_full_x_) )
+   {
+      if( retval )
+      {
+         Number* values = static_cast<DenseVector*>(g_f)->Values();
+         const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
+         for( Index i = 0; i < g_f->Dim(); i++ )
+         {
+            values[i] = full_grad_f[x_pos[i]];
+         }
+      }
+      delete[] full_grad_f;
+   }
+
+   if( !retval )
+   {
+      // The quantities are evaluated separately then.  If x has been
+      // passed as new_x, the TNLP may have ignored it, so it needs to see
+      // the next evaluation at x as new_x, too.
+      if( new_x )
+      {
+         x_tag_for_iterates_ = 0;
+      }
+      return false;
+   }
+
+   if( need_g )
+   {
+      x_tag_for_g_ = x_tag_for_iterates_;
+   }
+   if( need_jac_g )
+   {
+      x_tag_for_jac_g_ = x_tag_for_iterates_;
+   }
+
+   // Copy the values into the constraint vectors and Jacobians
+   if( c != NULL )
+   {
+      retval = Eval_c(x, *c);
+   }
+   if( retval && d != NULL )
+   {
+      retval = Eval_d(x, *d);
+   }
+   if( retval && jac_c != NULL )
+   {
+      retval = Eval_jac_c(x, *jac_c);
+   }
+   if( retval && jac_d != NULL )
+   {
+      retval = Eval_jac_d(x, *jac_d);
    }
 
    return retval;
 }
 
+bool TNLPAdapter::Eval_f_c_d_at_points(
+   Index                npoints,
+   const Vector* const* x,
+   Number*              f,
+   Vector* const*       c,
+   Vector* const*       d,
+   bool*                success
+)
+{
+   DBG_START_METH("TNLPAdapter::Eval_f_c_d_at_points", dbg_verbosity);
+
+   if( !tnlp_->is_reentrant() )
+   {
+      return false;
+   }
+
+   // Each thread works with its own copy of the TNLP variables and
+   // constraint values, so that the adapter's own copies are not touched
+   Index nthreads = IpNumThreadsForTasks(npoints);
+   Number* full_x_point = new Number[nthreads * n_full_x_];
+   Number* full_g_point = new Number[nthreads * n_full_g_];
+
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < npoints; i++ )
+   {
+      Number* x_orig = full_x_point + IpGetThreadNum() * n_full_x_;
+      Number* g_orig = full_g_point + IpGetThreadNum() * n_full_g_;
+      ResortX(*x[i], x_orig);
+      success[i] = tnlp_->eval_f(n_full_x_, x_orig, true, f[i]);
+      if( success[i] )
+      {
+         success[i] = tnlp_->eval_g(n_full_x_, x_orig, true, n_full_g_, g_orig);
+      }
+      if( success[i] )
+      {
+         ExtractC(g_orig, x_orig, *c[i]);
+         ExtractD(g_orig, *d[i]);
+      }
+   }
+
+   delete[] full_x_point;
+   delete[] full_g_point;
+
+   // The TNLP has been evaluated at the trial points last, so make sure
+   // that the next evaluation at the current point is flagged as new_x
+   x_tag_for_iterates_ = 0;
+
+   return true;
+}
+
 void TNLPAdapter::GetScalingParameters(
    const SmartPtr<const VectorSpace> x_space,
    const SmartPtr<const VectorSpace> c_space,
@@ -2647,6 +2838,46 @@ bool TNLPAdapter::internal_eval_g(
    return retval;
 }
 
+void TNLPAdapter::ExtractC(
+   const Number* g,
+   const Number* x_orig,
+   Vector&       c
+) const
+{
+   DenseVector* dc = static_cast<DenseVector*>(&c);
+   DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
+   Number* values = dc->Values();
+   const Index* c_pos = P_c_g_->ExpandedPosIndices();
+   Index n_c_no_fixed = P_c_g_->NCols();
+   for( Index i = 0; i < n_c_no_fixed; i++ )
+   {
+      values[i] = g[c_pos[i]];
+      values[i] -= c_rhs_[i];
+   }
+   if( fixed_variable_treatment_ == MAKE_CONSTRAINT )
+   {
+      for( Index i = 0; i < n_x_fixed_; i++ )
+      {
+         values[n_c_no_fixed + i] = x_orig[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed + i];
+      }
+   }
+}
+
+void TNLPAdapter::ExtractD(
+   const Number* g,
+   Vector&       d
+) const
+{
+   DenseVector* dd = static_cast<DenseVector*>(&d);
+   DBG_ASSERT(dynamic_cast<DenseVector*>(&d));
+   Number* values = dd->Values();
+   const Index* d_pos = P_d_g_->ExpandedPosIndices();
+   for( Index i = 0; i < d.Dim(); i++ )
+   {
+      values[i] = g[d_pos[i]];
+   }
+}
+
 bool TNLPAdapter::internal_eval_jac_g(
    bool new_x
 )
@@ -2662,7 +2893,7 @@ bool TNLPAdapter::internal_eval_jac_g(
    bool retval;
    if( jacobian_approximation_ == JAC_EXACT )
    {
-      retval = tnlp_->eval_jac_g(n_full_x_, full_x_, new_x, n_full_g_, nz_full_jac_g_, NULL, NULL, jac_g_);
+      retval = eval_jac_g_values(full_x_, new_x, jac_g_);
    }
    else
    {
@@ -2670,39 +2901,79 @@ bool TNLPAdapter::internal_eval_jac_g(
       retval = internal_eval_g(new_x);
       if( retval )
       {
-         Number* full_g_pert = new Number[n_full_g_];
-         Number* full_x_pert = new Number[n_full_x_];
-         IpBlasDcopy(n_full_x_, full_x_, 1, full_x_pert, 1);
-         // Compute the finite difference Jacobian
-         for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+         // Compute the finite difference Jacobian by perturbing all
+         // columns of one color at once.  The columns of one color have
+         // no row in common, so that each difference in g can be attributed
+         // to a single column.  If the TNLP is reentrant, the colors are
+         // evaluated concurrently, each thread with its own copy of x.
+         Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(findiff_num_colors_) : 1;
+         Number* full_g_pert = new Number[nthreads * n_full_g_];
+         Number* full_x_pert = new Number[nthreads * n_full_x_];
+         Number* perturbation = new Number[n_full_x_];
+         for( Index t = 0; t < nthreads; t++ )
          {
-            if( findiff_x_l_[ivar] < findiff_x_u_[ivar] )
+            IpBlasDcopy(n_full_x_, full_x_, 1, full_x_pert + t * n_full_x_, 1);
+         }
+         std::vector<char> success(findiff_num_colors_, 1);
+
+         IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+         for( Index color = 0; color < findiff_num_colors_; color++ )
+         {
+            Number* x_pert = full_x_pert + IpGetThreadNum() * n_full_x_;
+            Number* g_pert = full_g_pert + IpGetThreadNum() * n_full_g_;
+            bool perturbed = false;
+            for( Index k = findiff_color_ia_[color]; k < findiff_color_ia_[color + 1]; k++ )
             {
-               const Number xorig = full_x_pert[ivar];
-               Number this_perturbation = findiff_perturbation_ * Max(1., fabs(full_x_[ivar]));
-               full_x_pert[ivar] += this_perturbation;
-               if( full_x_pert[ivar] > findiff_x_u_[ivar] )
-               {
-                  // if at upper bound, then change direction towards lower bound
-                  this_perturbation = -this_perturbation;
-                  full_x_pert[ivar] = xorig + this_perturbation;
-               }
-               retval = tnlp_->eval_g(n_full_x_, full_x_pert, true, n_full_g_, full_g_pert);
-               if( !retval )
+               const Index ivar = findiff_color_ja_[k];
+               if( findiff_x_l_[ivar] < findiff_x_u_[ivar] )
                {
-                  break;
+                  Number this_perturbation = findiff_perturbation_ * Max(1., fabs(full_x_[ivar]));
+                  if( full_x_[ivar] + this_perturbation > findiff_x_u_[ivar] )
+                  {
+                     // if at upper bound, then change direction towards lower bound
+                     this_perturbation = -this_perturbation;
+                  }
+                  perturbation[ivar] = this_perturbation;
+                  x_pert[ivar] = full_x_[ivar] + this_perturbation;
+                  perturbed = true;
                }
-               for( Index i = findiff_jac_ia_[ivar]; i < findiff_jac_ia_[ivar + 1]; i++ )
+            }
+            if( !perturbed )
+            {
+               continue;
+            }
+
+            success[color] = tnlp_->eval_g(n_full_x_, x_pert, true, n_full_g_, g_pert);
+            for( Index k = findiff_color_ia_[color]; k < findiff_color_ia_[color + 1]; k++ )
+            {
+               const Index ivar = findiff_color_ja_[k];
+               if( findiff_x_l_[ivar] < findiff_x_u_[ivar] )
                {
-                  const Index& icon = findiff_jac_ja_[i];
-                  const Index& ipos = findiff_jac_postriplet_[i];
-                  jac_g_[ipos] = (full_g_pert[icon] - full_g_[icon]) / this_perturbation;
+                  if( success[color] )
+                  {
+                     for( Index i = findiff_jac_ia_[ivar]; i < findiff_jac_ia_[ivar + 1]; i++ )
+                     {
+                        const Index& icon = findiff_jac_ja_[i];
+                        const Index& ipos = findiff_jac_postriplet_[i];
+                        jac_g_[ipos] = (g_pert[icon] - full_g_[icon]) / perturbation[ivar];
+                     }
+                  }
+                  x_pert[ivar] = full_x_[ivar];
                }
-               full_x_pert[ivar] = xorig;
+            }
+         }
+
+         for( Index color = 0; color < findiff_num_colors_; color++ )
+         {
+            if( !success[color] )
+            {
+               retval = false;
+               break;
             }
          }
          delete[] full_g_pert;
          delete[] full_x_pert;
+         delete[] perturbation;
       }
    }
 
@@ -2714,34 +2985,107 @@ bool TNLPAdapter::internal_eval_jac_g(
    return retval;
 }
 
-void TNLPAdapter::initialize_findiff_jac(
-   const Index* iRow,
-   const Index* jCol
+/** Greedy coloring of the columns of a sparse matrix such that no two
+ *  columns of the same color have an entry in the same row (coloring of
+ *  the column intersection graph in the natural order, as proposed by
+ *  Curtis, Powell, and Reid).
+ *
+ *  The row indices of the entries in column j are
+ *  row[col_ia[j]], ..., row[col_ia[j+1]-1], counting from 0; duplicate
+ *  entries are allowed.  Columns without entries are not colored and
+ *  get color -1.
+ *
+ *  @return number of colors
+ */
+static Index ColorColumns(
+   Index        nrows,
+   Index        ncols,
+   const Index* col_ia,
+   const Index* row,
+   Index*       colors
 )
 {
+   // Row-wise structure
+   std::vector<Index> row_ia(nrows + 1, 0);
+   for( Index i = 0; i < col_ia[ncols]; i++ )
+   {
+      row_ia[row[i] + 1]++;
+   }
+   for( Index i = 0; i < nrows; i++ )
+   {
+      row_ia[i + 1] += row_ia[i];
+   }
+   std::vector<Index> row_ja(col_ia[ncols] + 1);
+   std::vector<Index> next(row_ia.begin(), row_ia.end() - 1);
+   for( Index j = 0; j < ncols; j++ )
+   {
+      for( Index i = col_ia[j]; i < col_ia[j + 1]; i++ )
+      {
+         row_ja[next[row[i]]++] = j;
+      }
+   }
 
-   SmartPtr<TripletToCSRConverter> findiff_jac_converter = new TripletToCSRConverter(0);
-   // construct structure of a sparse matrix with only Jacobian in it
-   // TODO: This could be done more efficiently without detour via
-   // symmetric matrix
-   Index* airn = new Index[nz_full_jac_g_];
-   Index* ajcn = new Index[nz_full_jac_g_];
-   for( Index i = 0; i < nz_full_jac_g_; i++ )
+   std::vector<Index> forbidden(ncols, -1);
+   for( Index j = 0; j < ncols; j++ )
+   {
+      colors[j] = -1;
+   }
+   Index ncolors = 0;
+   for( Index j = 0; j < ncols; j++ )
    {
-      airn[i] = jCol[i];
-      ajcn[i] = iRow[i] + n_full_x_;
+      if( col_ia[j] == col_ia[j + 1] )
+      {
+         continue;
+      }
+      for( Index i = col_ia[j]; i < col_ia[j + 1]; i++ )
+      {
+         for( Index k = row_ia[row[i]]; k < row_ia[row[i] + 1]; k++ )
+         {
+            if( colors[row_ja[k]] >= 0 )
+            {
+               forbidden[colors[row_ja[k]]] = j;
+            }
+         }
+      }
+      Index color = 0;
+      while( forbidden[color] == j )
+      {
+         ++color;
+      }
+      colors[j] = color;
+      ncolors = Max(ncolors, color + 1);
    }
-   // Get the column ordered sparse representation
-   findiff_jac_nnz_ = findiff_jac_converter->InitializeConverter(n_full_g_ + n_full_x_, nz_full_jac_g_, airn, ajcn);
-   delete[] airn;
-   delete[] ajcn;
-   if( findiff_jac_nnz_ != nz_full_jac_g_ )
+
+   return ncolors;
+}
+
+void TNLPAdapter::initialize_findiff_jac(
+   const Index* iRow,
+   const Index* jCol
+)
+{
+   // Get the column ordered sparse representation of the Jacobian
+   std::vector<Index> start;
+   std::vector<Index> pos;
+   std::vector<Index> row;
+   TripletHelper::CompressTriplets(n_full_x_, nz_full_jac_g_, jCol, iRow, false, start, pos, row);
+
+   // Check that no position appears more than once within a column
+   std::vector<Index> last_col(n_full_g_, -1);
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
    {
-      THROW_EXCEPTION(INVALID_TNLP,
-                      "Sparsity structure of Jacobian has multiple occurrences of the same position.  This is not allowed for finite differences.");
+      for( Index i = start[ivar]; i < start[ivar + 1]; i++ )
+      {
+         if( last_col[row[i]] == ivar )
+         {
+            THROW_EXCEPTION(INVALID_TNLP,
+                            "Sparsity structure of Jacobian has multiple occurrences of the same position.  This is not allowed for finite differences.");
+         }
+         last_col[row[i]] = ivar;
+      }
    }
+   findiff_jac_nnz_ = nz_full_jac_g_;
 
-   // Finally, get the right numbers out of the converter object
    delete[] findiff_jac_ia_;
    delete[] findiff_jac_ja_;
    delete[] findiff_jac_postriplet_;
@@ -2751,56 +3095,1528 @@ void TNLPAdapter::initialize_findiff_jac(
    findiff_jac_ia_ = new Index[n_full_x_ + 1];
    findiff_jac_ja_ = new Index[findiff_jac_nnz_];
    findiff_jac_postriplet_ = new Index[findiff_jac_nnz_];
-   const Index* ia = findiff_jac_converter->IA();
    for( Index i = 0; i < n_full_x_ + 1; i++ )
    {
-      findiff_jac_ia_[i] = ia[i];
+      findiff_jac_ia_[i] = start[i];
    }
-   const Index* ja = findiff_jac_converter->JA();
    for( Index i = 0; i < findiff_jac_nnz_; i++ )
    {
-      findiff_jac_ja_[i] = ja[i] - n_full_x_;
+      findiff_jac_ja_[i] = row[i];
+      findiff_jac_postriplet_[i] = pos[i];
    }
-   const Index* postrip = findiff_jac_converter->iPosFirst();
-   for( Index i = 0; i < findiff_jac_nnz_; i++ )
+
+   // Color the columns of the Jacobian such that no two columns of the
+   // same color have a nonzero in the same row.  Columns without nonzeros
+   // are not colored.
+   Index* colors = new Index[n_full_x_];
+   findiff_num_colors_ = ColorColumns(n_full_g_, n_full_x_, findiff_jac_ia_, findiff_jac_ja_, colors);
+
+   delete[] findiff_color_ia_;
+   delete[] findiff_color_ja_;
+   findiff_color_ia_ = new Index[findiff_num_colors_ + 1];
+   for( Index color = 0; color <= findiff_num_colors_; color++ )
+   {
+      findiff_color_ia_[color] = 0;
+   }
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      if( colors[ivar] >= 0 )
+      {
+         findiff_color_ia_[colors[ivar] + 1]++;
+      }
+   }
+   for( Index color = 0; color < findiff_num_colors_; color++ )
    {
-      findiff_jac_postriplet_[i] = postrip[i];
+      findiff_color_ia_[color + 1] += findiff_color_ia_[color];
    }
+   findiff_color_ja_ = new Index[findiff_color_ia_[findiff_num_colors_]];
+   Index* next = new Index[findiff_num_colors_ + 1];
+   for( Index color = 0; color < findiff_num_colors_; color++ )
+   {
+      next[color] = findiff_color_ia_[color];
+   }
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      if( colors[ivar] >= 0 )
+      {
+         findiff_color_ja_[next[colors[ivar]]++] = ivar;
+      }
+   }
+   delete[] next;
+   delete[] colors;
 
+   if( IsValid(jnlst_) )
+   {
+      jnlst_->Printf(J_DETAILED, J_INITIALIZATION,
+                     "Finite difference Jacobian uses %" IPOPT_INDEX_FORMAT " evaluations of g for %" IPOPT_INDEX_FORMAT " variables.\n", findiff_num_colors_,
+                     n_full_x_);
+   }
 }
 
-bool TNLPAdapter::CheckDerivatives(
-   TNLPAdapter::DerivativeTestEnum deriv_test,
-   Index                           deriv_test_start_index
+void TNLPAdapter::initialize_derivative_blocks(
+   const Index* iRow
 )
 {
-   if( deriv_test == NO_TEST )
+   num_deriv_blocks_ = compute_derivative_blocks(n_full_g_, nz_full_jac_g_, nz_full_h_, iRow, 1, deriv_block_jac_start_,
+                       deriv_block_hess_start_);
+
+   if( num_deriv_blocks_ > 0 && IsValid(jnlst_) )
    {
-      return true;
+      jnlst_->Printf(J_DETAILED, J_INITIALIZATION,
+                     "Evaluating derivatives in %" IPOPT_INDEX_FORMAT " blocks on up to %" IPOPT_INDEX_FORMAT " threads.\n", num_deriv_blocks_,
+                     Min(IpGetNumThreads(), num_deriv_blocks_));
    }
+}
 
-   Index nerrors = 0;
+Index TNLPAdapter::compute_derivative_blocks(
+   Index               ng,
+   Index               nz_jac_g,
+   Index               nz_hess_lag,
+   const Index*        iRow,
+   Index               offset,
+   std::vector<Index>& jac_block_start,
+   std::vector<Index>& hess_block_start
+)
+{
+   jac_block_start.clear();
+   hess_block_start.clear();
 
-   ASSERT_EXCEPTION(IsValid(jnlst_), ERROR_IN_TNLP_DERIVATIVE_TEST,
-                    "No Journalist given to TNLPAdapter.  Need Journalist, otherwise can't produce any output in DerivativeChecker!");
+   Index num_blocks = tnlp_->get_number_of_derivative_blocks();
+   if( num_blocks <= 0 )
+   {
+      return 0;
+   }
 
-   bool retval = true;
-   // Since this method should be independent of all other internal
-   // data (so that it can be called indpenendent of GetSpace etc),
-   // we are not using any internal fields
+   std::vector<Index> con_start(num_blocks + 1);
+   std::vector<Index> hess_start(num_blocks + 1);
+   bool retval = tnlp_->get_derivative_blocks(num_blocks, ng, nz_hess_lag, &con_start[0], &hess_start[0]);
+   ASSERT_EXCEPTION(retval, INVALID_TNLP, "get_derivative_blocks returned false");
+   ASSERT_EXCEPTION(con_start[0] == 0 && con_start[num_blocks] == ng, INVALID_TNLP,
+                    "get_derivative_blocks: con_block_start does not start with 0 and end with m");
+   ASSERT_EXCEPTION(hess_start[0] == 0 && hess_start[num_blocks] == nz_hess_lag, INVALID_TNLP,
+                    "get_derivative_blocks: hess_block_start does not start with 0 and end with nele_hess");
+   for( Index b = 0; b < num_blocks; b++ )
+   {
+      ASSERT_EXCEPTION(con_start[b] <= con_start[b + 1] && hess_start[b] <= hess_start[b + 1], INVALID_TNLP,
+                       "get_derivative_blocks: block starts are not nondecreasing");
+   }
 
-   // Obtain the problem size
-   Index nx; // number of variables
-   Index ng; // number of constriants
-   Index nz_jac_g; // number of nonzeros in constraint Jacobian
-   Index nz_hess_lag; // number of nonzeros in Lagrangian Hessian
-   TNLP::IndexStyleEnum index_style;
-   retval = tnlp_->get_nlp_info(nx, ng, nz_jac_g, nz_hess_lag, index_style);
-   ASSERT_EXCEPTION(retval, INVALID_TNLP, "get_nlp_info returned false for derivative checker");
+   // Determine the range of the Jacobian entries for each block.  The
+   // entries have to be ordered by blocks, so that each block can write
+   // into its own part of the values.
+   jac_block_start.resize(num_blocks + 1);
+   jac_block_start[0] = 0;
+   Index block = 0;
+   for( Index i = 0; i < nz_jac_g; i++ )
+   {
+      const Index row = iRow[i] - offset;
+      while( row >= con_start[block + 1] )
+      {
+         ++block;
+         jac_block_start[block] = i;
+      }
+      if( row < con_start[block] )
+      {
+         THROW_EXCEPTION(INVALID_TNLP,
+                         "Sparsity structure of Jacobian is not ordered by the blocks returned by get_derivative_blocks.");
+      }
+   }
+   while( block < num_blocks )
+   {
+      ++block;
+      jac_block_start[block] = nz_jac_g;
+   }
 
-   // Obtain starting point as reference point at which derivative
-   // test should be performed
-   Number* xref = new Number[nx];
+   hess_block_start = hess_start;
+
+   return num_blocks;
+}
+
+bool TNLPAdapter::eval_jac_g_blocks(
+   const std::vector<Index>& jac_block_start,
+   Index                     n,
+   const Number*             x,
+   bool                      new_x,
+   Index                     m,
+   Number*                   values
+)
+{
+   // Each block writes into its own part of values
+   const Index num_blocks = static_cast<Index>(jac_block_start.size()) - 1;
+   std::vector<char> success(num_blocks);
+   Index nthreads = IpNumThreadsForTasks(num_blocks);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index b = 0; b < num_blocks; b++ )
+   {
+      const Index start = jac_block_start[b];
+      success[b] = tnlp_->eval_jac_g_block(b, n, x, new_x, m, jac_block_start[b + 1] - start, values + start);
+   }
+
+   for( Index b = 0; b < num_blocks; b++ )
+   {
+      if( !success[b] )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+bool TNLPAdapter::eval_jac_g_values(
+   const Number* x,
+   bool          new_x,
+   Number*       values
+)
+{
+   if( num_deriv_blocks_ > 0 )
+   {
+      return eval_jac_g_blocks(deriv_block_jac_start_, n_full_x_, x, new_x, n_full_g_, values);
+   }
+   return tnlp_->eval_jac_g(n_full_x_, x, new_x, n_full_g_, nz_full_jac_g_, NULL, NULL, values);
+}
+
+bool TNLPAdapter::eval_h_blocks(
+   const std::vector<Index>& hess_block_start,
+   Index                     n,
+   const Number*             x,
+   bool                      new_x,
+   Number                    obj_factor,
+   Index                     m,
+   const Number*             lambda,
+   bool                      new_lambda,
+   Number*                   values
+)
+{
+   // Each block writes into its own part of values
+   const Index num_blocks = static_cast<Index>(hess_block_start.size()) - 1;
+   std::vector<char> success(num_blocks);
+   Index nthreads = IpNumThreadsForTasks(num_blocks);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index b = 0; b < num_blocks; b++ )
+   {
+      const Index start = hess_block_start[b];
+      success[b] = tnlp_->eval_h_block(b, n, x, new_x, obj_factor, m, lambda, new_lambda,
+                                       hess_block_start[b + 1] - start, values + start);
+   }
+
+   for( Index b = 0; b < num_blocks; b++ )
+   {
+      if( !success[b] )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+void TNLPAdapter::initialize_findiff_hess(
+   const Index* iRow,
+   const Index* jCol
+)
+{
+   // Set up the adjacency structure of the Hessian (without diagonal),
+   // removing duplicate entries
+   std::vector<Index> adj_ia(n_full_x_ + 1, 0);
+   std::vector<char> used(n_full_x_, 0);
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      const Index row = iRow[i] - 1;
+      const Index col = jCol[i] - 1;
+      used[row] = 1;
+      used[col] = 1;
+      if( row != col )
+      {
+         adj_ia[row + 1]++;
+         adj_ia[col + 1]++;
+      }
+   }
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      adj_ia[ivar + 1] += adj_ia[ivar];
+   }
+   std::vector<Index> adj_ja(adj_ia[n_full_x_]);
+   std::vector<Index> next(adj_ia.begin(), adj_ia.end() - 1);
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      const Index row = iRow[i] - 1;
+      const Index col = jCol[i] - 1;
+      if( row != col )
+      {
+         adj_ja[next[row]++] = col;
+         adj_ja[next[col]++] = row;
+      }
+   }
+   std::vector<Index> mark(n_full_x_, -1);
+   Index nadj = 0;
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      const Index start = adj_ia[ivar];
+      adj_ia[ivar] = nadj;
+      for( Index k = start; k < next[ivar]; k++ )
+      {
+         if( mark[adj_ja[k]] != ivar )
+         {
+            mark[adj_ja[k]] = ivar;
+            adj_ja[nadj++] = adj_ja[k];
+         }
+      }
+   }
+   adj_ia[n_full_x_] = nadj;
+
+   // Greedy star coloring in the natural order: a distance-1 coloring in
+   // which every path on four vertices uses at least three colors.  When
+   // coloring v, the colors of x are forbidden for all paths v-w-x-y and
+   // u-v-w-x where the path would otherwise be bicolored.
+   std::vector<Index> color(n_full_x_, -1);
+   std::vector<Index> forbidden(n_full_x_, -1);
+   std::vector<Index> count(n_full_x_, 0);
+   std::vector<Index> count_mark(n_full_x_, -1);
+   findiff_hess_num_colors_ = 0;
+   for( Index v = 0; v < n_full_x_; v++ )
+   {
+      if( !used[v] )
+      {
+         continue;
+      }
+      for( Index k = adj_ia[v]; k < adj_ia[v + 1]; k++ )
+      {
+         const Index cw = color[adj_ja[k]];
+         if( cw >= 0 )
+         {
+            forbidden[cw] = v;
+            if( count_mark[cw] != v )
+            {
+               count_mark[cw] = v;
+               count[cw] = 0;
+            }
+            count[cw]++;
+         }
+      }
+      for( Index k = adj_ia[v]; k < adj_ia[v + 1]; k++ )
+      {
+         const Index w = adj_ja[k];
+         const Index cw = color[w];
+         if( cw < 0 )
+         {
+            continue;
+         }
+         for( Index l = adj_ia[w]; l < adj_ia[w + 1]; l++ )
+         {
+            const Index x = adj_ja[l];
+            if( x == v || color[x] < 0 || forbidden[color[x]] == v )
+            {
+               continue;
+            }
+            if( count[cw] >= 2 )
+            {
+               // u-v-w-x with color[u] == color[w]
+               forbidden[color[x]] = v;
+               continue;
+            }
+            for( Index m = adj_ia[x]; m < adj_ia[x + 1]; m++ )
+            {
+               const Index y = adj_ja[m];
+               if( y != w && color[y] == cw )
+               {
+                  // v-w-x-y with color[y] == color[w]
+                  forbidden[color[x]] = v;
+                  break;
+               }
+            }
+         }
+      }
+      Index c = 0;
+      while( forbidden[c] == v )
+      {
+         ++c;
+      }
+      color[v] = c;
+      findiff_hess_num_colors_ = Max(findiff_hess_num_colors_, c + 1);
+   }
+
+   // Columns of each color
+   findiff_hess_color_ia_.assign(findiff_hess_num_colors_ + 1, 0);
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      if( color[ivar] >= 0 )
+      {
+         findiff_hess_color_ia_[color[ivar] + 1]++;
+      }
+   }
+   for( Index c = 0; c < findiff_hess_num_colors_; c++ )
+   {
+      findiff_hess_color_ia_[c + 1] += findiff_hess_color_ia_[c];
+   }
+   findiff_hess_color_ja_.resize(findiff_hess_color_ia_[findiff_hess_num_colors_]);
+   next.assign(findiff_hess_color_ia_.begin(), findiff_hess_color_ia_.end() - 1);
+   for( Index ivar = 0; ivar < n_full_x_; ivar++ )
+   {
+      if( color[ivar] >= 0 )
+      {
+         findiff_hess_color_ja_[next[color[ivar]]++] = ivar;
+      }
+   }
+
+   // Determine for each Hessian entry (i,j) from which gradient difference
+   // it is recovered.  If j is the only neighbor of i with color[j], the
+   // entry is the i-th entry of the difference for color[j]; otherwise,
+   // by the star coloring, i is the only neighbor of j with color[i].
+   // Duplicate entries in the structure are set to zero.
+   std::vector<std::pair<std::pair<Index, Index>, Index> > entries(nz_full_h_);
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      const Index row = iRow[i] - 1;
+      const Index col = jCol[i] - 1;
+      entries[i] = std::make_pair(std::make_pair(Max(row, col), Min(row, col)), i);
+   }
+   std::sort(entries.begin(), entries.end());
+   std::vector<Index> entry_color(nz_full_h_, -1);
+   std::vector<Index> entry_row(nz_full_h_);
+   std::vector<Index> entry_col(nz_full_h_);
+   for( Index k = 0; k < nz_full_h_; k++ )
+   {
+      if( k > 0 && entries[k].first == entries[k - 1].first )
+      {
+         continue;
+      }
+      const Index i = entries[k].first.first;
+      const Index j = entries[k].first.second;
+      const Index pos = entries[k].second;
+      bool unique = true;
+      if( i != j )
+      {
+         Index num = 0;
+         for( Index l = adj_ia[i]; l < adj_ia[i + 1]; l++ )
+         {
+            if( color[adj_ja[l]] == color[j] )
+            {
+               ++num;
+            }
+         }
+         unique = (num == 1);
+      }
+      if( unique )
+      {
+         entry_color[pos] = color[j];
+         entry_row[pos] = i;
+         entry_col[pos] = j;
+      }
+      else
+      {
+         entry_color[pos] = color[i];
+         entry_row[pos] = j;
+         entry_col[pos] = i;
+      }
+   }
+
+   // Hessian entries obtained from each color
+   findiff_hess_entry_ia_.assign(findiff_hess_num_colors_ + 1, 0);
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      if( entry_color[i] >= 0 )
+      {
+         findiff_hess_entry_ia_[entry_color[i] + 1]++;
+      }
+   }
+   for( Index c = 0; c < findiff_hess_num_colors_; c++ )
+   {
+      findiff_hess_entry_ia_[c + 1] += findiff_hess_entry_ia_[c];
+   }
+   const Index nentries = findiff_hess_entry_ia_[findiff_hess_num_colors_];
+   findiff_hess_entry_pos_.resize(nentries);
+   findiff_hess_entry_row_.resize(nentries);
+   findiff_hess_entry_col_.resize(nentries);
+   next.assign(findiff_hess_entry_ia_.begin(), findiff_hess_entry_ia_.end() - 1);
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      if( entry_color[i] >= 0 )
+      {
+         const Index k = next[entry_color[i]]++;
+         findiff_hess_entry_pos_[k] = i;
+         findiff_hess_entry_row_[k] = entry_row[i];
+         findiff_hess_entry_col_[k] = entry_col[i];
+      }
+   }
+
+   if( IsValid(jnlst_) )
+   {
+      jnlst_->Printf(J_DETAILED, J_INITIALIZATION,
+                     "Finite difference Hessian uses %" IPOPT_INDEX_FORMAT " gradient evaluations for %" IPOPT_INDEX_FORMAT " variables.\n",
+                     findiff_hess_num_colors_ + 1, n_full_x_);
+   }
+}
+
+bool TNLPAdapter::eval_grad_lagrangian(
+   const Number* x,
+   bool          new_x,
+   Number        obj_factor,
+   Number*       grad,
+   Number*       jac_values
+)
+{
+   if( obj_factor != 0. )
+   {
+      if( !tnlp_->eval_grad_f(n_full_x_, x, new_x, grad) )
+      {
+         return false;
+      }
+      new_x = false;
+      IpBlasDscal(n_full_x_, obj_factor, grad, 1);
+   }
+   else
+   {
+      for( Index i = 0; i < n_full_x_; i++ )
+      {
+         grad[i] = 0.;
+      }
+   }
+
+   if( nz_full_jac_g_ > 0 )
+   {
+      if( !eval_jac_g_values(x, new_x, jac_values) )
+      {
+         return false;
+      }
+      for( Index i = 0; i < nz_full_jac_g_; i++ )
+      {
+         grad[findiff_hess_jac_jCol_[i]] += full_lambda_[findiff_hess_jac_iRow_[i]] * jac_values[i];
+      }
+   }
+
+   return true;
+}
+
+bool TNLPAdapter::eval_findiff_h(
+   bool    new_x,
+   Number  obj_factor,
+   Number* values
+)
+{
+   for( Index i = 0; i < nz_full_h_; i++ )
+   {
+      values[i] = 0.;
+   }
+
+   // Gradient of the Lagrangian at the current point
+   Number* grad = new Number[n_full_x_];
+   Number* jac_values = new Number[nz_full_jac_g_];
+   bool retval = eval_grad_lagrangian(full_x_, new_x, obj_factor, grad, jac_values);
+   delete[] jac_values;
+   if( !retval )
+   {
+      delete[] grad;
+      return false;
+   }
+
+   // Perturb all columns of one color at once.  If the TNLP is
+   // reentrant, the colors are evaluated concurrently, each thread with
+   // its own copy of x and work space.
+   Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(findiff_hess_num_colors_) : 1;
+   Number* full_x_pert = new Number[nthreads * n_full_x_];
+   Number* full_grad_pert = new Number[nthreads * n_full_x_];
+   Number* full_jac_pert = new Number[nthreads * nz_full_jac_g_];
+   Number* perturbation = new Number[n_full_x_];
+   for( Index t = 0; t < nthreads; t++ )
+   {
+      IpBlasDcopy(n_full_x_, full_x_, 1, full_x_pert + t * n_full_x_, 1);
+   }
+   std::vector<char> success(findiff_hess_num_colors_);
+
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index color = 0; color < findiff_hess_num_colors_; color++ )
+   {
+      Number* x_pert = full_x_pert + IpGetThreadNum() * n_full_x_;
+      Number* grad_pert = full_grad_pert + IpGetThreadNum() * n_full_x_;
+      Number* jac_pert = full_jac_pert + IpGetThreadNum() * nz_full_jac_g_;
+      for( Index k = findiff_hess_color_ia_[color]; k < findiff_hess_color_ia_[color + 1]; k++ )
+      {
+         const Index ivar = findiff_hess_color_ja_[k];
+         Number this_perturbation = findiff_perturbation_ * Max(1., fabs(full_x_[ivar]));
+         if( full_x_[ivar] + this_perturbation > findiff_x_u_[ivar] )
+         {
+            // if at upper bound, then change direction towards lower bound
+            this_perturbation = -this_perturbation;
+         }
+         perturbation[ivar] = this_perturbation;
+         x_pert[ivar] = full_x_[ivar] + this_perturbation;
+      }
+
+      success[color] = eval_grad_lagrangian(x_pert, true, obj_factor, grad_pert, jac_pert);
+      if( success[color] )
+      {
+         for( Index k = findiff_hess_entry_ia_[color]; k < findiff_hess_entry_ia_[color + 1]; k++ )
+         {
+            const Index row = findiff_hess_entry_row_[k];
+            values[findiff_hess_entry_pos_[k]] = (grad_pert[row] - grad[row])
+                                                 / perturbation[findiff_hess_entry_col_[k]];
+         }
+      }
+
+      for( Index k = findiff_hess_color_ia_[color]; k < findiff_hess_color_ia_[color + 1]; k++ )
+      {
+         const Index ivar = findiff_hess_color_ja_[k];
+         x_pert[ivar] = full_x_[ivar];
+      }
+   }
+
+   for( Index color = 0; color < findiff_hess_num_colors_; color++ )
+   {
+      if( !success[color] )
+      {
+         retval = false;
+         break;
+      }
+   }
+   delete[] grad;
+   delete[] full_x_pert;
+   delete[] full_grad_pert;
+   delete[] full_jac_pert;
+   delete[] perturbation;
+
+   // The TNLP has been evaluated at perturbed points last, so make sure
+   // that the next evaluation at the current point is flagged as new_x
+   x_tag_for_iterates_ = 0;
+
+   return retval;
+}
+
+/** Reference point of the derivative test.
+ *
+ *  All indices are counted from 0.  The Hessian structure is only
+ *  available for the test of second derivatives.
+ */
+struct TNLPAdapter::DerivativeTestPoint
+{
+   Index nx;
+   Index ng;
+   Index nz_jac_g;
+   Index nz_hess_lag;
+   /** Offset that is added to indices when printing */
+   Index index_correction;
+   const Number* x;
+   Number f;
+   const Number* g;
+   const Number* grad_f;
+   const Index* jac_iRow;
+   const Index* jac_jCol;
+   const Number* jac_values;
+   const Index* h_iRow;
+   const Index* h_jCol;
+   /** First Jacobian entry of each derivative block and one past the last (empty if the TNLP has no blocks) */
+   std::vector<Index> jac_block_start;
+   /** First Hessian entry of each derivative block and one past the last (empty if the TNLP has no blocks) */
+   std::vector<Index> hess_block_start;
+};
+
+/** Select min(size, last-first) of the indices first, ..., last-1 at
+ *  random and return them in increasing order.
+ */
+static void SampleIndices(
+   Index               first,
+   Index               last,
+   Index               size,
+   std::vector<Index>& indices
+)
+{
+   indices.clear();
+   for( Index i = first; i < last; i++ )
+   {
+      indices.push_back(i);
+   }
+   const Index n = static_cast<Index>(indices.size());
+   if( size >= n )
+   {
+      return;
+   }
+   // Partial Fisher-Yates shuffle
+   for( Index k = 0; k < size; k++ )
+   {
+      const Index j = Min(n - 1, k + static_cast<Index>(IpRandom01() * (n - k)));
+      std::swap(indices[k], indices[j]);
+   }
+   indices.resize(size);
+   std::sort(indices.begin(), indices.end());
+}
+
+/** Compute for each column of a sparse matrix in triplet format (counting
+ *  from 0) the row indices and the positions of its entries.
+ *
+ *  This is the column-wise view of TripletHelper::CompressTriplets, which
+ *  expects indices that count from 1.
+ */
+static void ColumnEntries(
+   Index               ncols,
+   Index               nnz,
+   const Index*        iRow,
+   const Index*        jCol,
+   bool                symmetric,
+   std::vector<Index>& col_ia,
+   std::vector<Index>& row,
+   std::vector<Index>& pos
+)
+{
+   std::vector<Index> iRow1(nnz + 1);
+   std::vector<Index> jCol1(nnz + 1);
+   for( Index i = 0; i < nnz; i++ )
+   {
+      iRow1[i] = iRow[i] + 1;
+      jCol1[i] = jCol[i] + 1;
+   }
+   TripletHelper::CompressTriplets(ncols, nnz, &jCol1[0], &iRow1[0], symmetric, col_ia, pos, row);
+}
+
+/** Color the columns of a sparse matrix given by ColumnEntries for the
+ *  derivative test and return the variables of each color in
+ *  color_ia/color_ja.  Columns without entries are put into the first
+ *  color.
+ */
+static void ColorColumnsForTest(
+   Index                     nrows,
+   Index                     ncols,
+   const std::vector<Index>& col_ia,
+   const std::vector<Index>& row,
+   std::vector<Index>&       color_ia,
+   std::vector<Index>&       color_ja
+)
+{
+   std::vector<Index> colors(ncols + 1);
+   const Index ncolors = Max(1, ColorColumns(nrows, ncols, &col_ia[0], row.empty() ? NULL : &row[0], &colors[0]));
+   color_ia.assign(ncolors + 1, 0);
+   for( Index j = 0; j < ncols; j++ )
+   {
+      colors[j] = Max(0, colors[j]);
+      color_ia[colors[j] + 1]++;
+   }
+   for( Index c = 0; c < ncolors; c++ )
+   {
+      color_ia[c + 1] += color_ia[c];
+   }
+   color_ja.resize(ncols);
+   std::vector<Index> next(color_ia.begin(), color_ia.end() - 1);
+   for( Index j = 0; j < ncols; j++ )
+   {
+      color_ja[next[colors[j]]++] = j;
+   }
+}
+
+/** Compare an exact derivative with its finite difference estimate.
+ *
+ *  @return '*' if the relative deviation rel_error is not below tol, ' ' otherwise
+ */
+static char CompareDerivatives(
+   Number  deriv_exact,
+   Number  deriv_approx,
+   Number  tol,
+   Number& rel_error
+)
+{
+   rel_error = fabs(deriv_approx - deriv_exact) / Max(fabs(deriv_approx), 1.);
+   return rel_error >= tol ? '*' : ' ';
+}
+
+Index TNLPAdapter::check_first_derivatives(
+   const DerivativeTestPoint& ref,
+   const std::vector<Index>&  vars
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+   const Index nvars = static_cast<Index>(vars.size());
+   const Index index_correction = ref.index_correction;
+
+   std::vector<Index> col_ia;
+   std::vector<Index> col_row;
+   std::vector<Index> col_pos;
+   ColumnEntries(nx, ref.nz_jac_g, ref.jac_iRow, ref.jac_jCol, false, col_ia, col_row, col_pos);
+
+   // The variables are perturbed in chunks of nthreads, each with its own
+   // work space; the results are printed in order afterwards
+   const Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(nvars) : 1;
+   std::vector<Number> xpert(nthreads * nx);
+   for( Index t = 0; t < nthreads; t++ )
+   {
+      IpBlasDcopy(nx, ref.x, 1, &xpert[t * nx], 1);
+   }
+   std::vector<Number> gpert(nthreads * ng + 1);
+   std::vector<Number> fpert(nthreads);
+   std::vector<Number> perturbation(nthreads);
+   std::vector<char> failed(nthreads);
+
+   std::vector<Number> jac_col(ng, 0.);
+   std::vector<char> found(ng, 0);
+
+   Index nerrors = 0;
+   for( Index start = 0; start < nvars; start += nthreads )
+   {
+      const Index nchunk = Min(nthreads, nvars - start);
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         const Index ivar = vars[start + t];
+         Number* x = &xpert[t * nx];
+         perturbation[t] = derivative_test_perturbation_ * Max(1., fabs(ref.x[ivar]));
+         x[ivar] = ref.x[ivar] + perturbation[t];
+         failed[t] = 0;
+         if( !tnlp_->eval_f(nx, x, true, fpert[t]) )
+         {
+            failed[t] = 'f';
+         }
+         else if( ng > 0 && !tnlp_->eval_g(nx, x, nthreads > 1, ng, &gpert[t * ng]) )
+         {
+            failed[t] = 'g';
+         }
+         x[ivar] = ref.x[ivar];
+      }
+
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         ASSERT_EXCEPTION(failed[t] != 'f', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                          "In TNLP derivative test: f could not be evaluated at perturbed point.");
+         ASSERT_EXCEPTION(failed[t] != 'g', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                          "In TNLP derivative test: g could not be evaluated at perturbed point.");
+
+         const Index ivar = vars[start + t];
+         Number deriv_approx = (fpert[t] - ref.f) / perturbation[t];
+         Number deriv_exact = ref.grad_f[ivar];
+         Number rel_error;
+         char cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+         if( cflag != ' ' )
+         {
+            nerrors++;
+         }
+         if( cflag != ' ' || derivative_test_print_all_ )
+         {
+            jnlst_->Printf(J_WARNING, J_NLP, "%c grad_f[      %5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                           ivar + index_correction, deriv_exact, deriv_approx, rel_error);
+         }
+
+         if( ng == 0 )
+         {
+            continue;
+         }
+         for( Index k = col_ia[ivar]; k < col_ia[ivar + 1]; k++ )
+         {
+            jac_col[col_row[k]] += ref.jac_values[col_pos[k]];
+            found[col_row[k]] = 1;
+         }
+         const Number* g = &gpert[t * ng];
+         for( Index icon = 0; icon < ng; icon++ )
+         {
+            deriv_approx = (g[icon] - ref.g[icon]) / perturbation[t];
+            deriv_exact = jac_col[icon];
+            cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+            if( cflag != ' ' )
+            {
+               nerrors++;
+            }
+            char sflag = found[icon] ? 'v' : ' ';
+            if( cflag != ' ' || derivative_test_print_all_ )
+            {
+               jnlst_->Printf(J_WARNING, J_NLP, "%c jac_g [%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
+                              icon + index_correction, ivar + index_correction, deriv_exact, sflag, deriv_approx, rel_error);
+            }
+         }
+         for( Index k = col_ia[ivar]; k < col_ia[ivar + 1]; k++ )
+         {
+            jac_col[col_row[k]] = 0.;
+            found[col_row[k]] = 0;
+         }
+      }
+   }
+
+   return nerrors;
+}
+
+Index TNLPAdapter::check_first_derivatives_colored(
+   const DerivativeTestPoint& ref
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+   const Index index_correction = ref.index_correction;
+
+   // Group the variables such that no two variables of a group appear in
+   // the same constraint
+   std::vector<Index> col_ia;
+   std::vector<Index> col_row;
+   std::vector<Index> col_pos;
+   ColumnEntries(nx, ref.nz_jac_g, ref.jac_iRow, ref.jac_jCol, false, col_ia, col_row, col_pos);
+   std::vector<Index> color_ia;
+   std::vector<Index> color_ja;
+   ColorColumnsForTest(ng, nx, col_ia, col_row, color_ia, color_ja);
+   const Index ncolors = static_cast<Index>(color_ia.size()) - 1;
+   jnlst_->Printf(J_DETAILED, J_NLP, "Checking first derivatives with %" IPOPT_INDEX_FORMAT " perturbed points.\n\n", ncolors);
+
+   std::vector<Number> perturbation(nx);
+   for( Index ivar = 0; ivar < nx; ivar++ )
+   {
+      perturbation[ivar] = derivative_test_perturbation_ * Max(1., fabs(ref.x[ivar]));
+   }
+
+   const Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(ncolors) : 1;
+   std::vector<Number> xpert(nthreads * nx);
+   for( Index t = 0; t < nthreads; t++ )
+   {
+      IpBlasDcopy(nx, ref.x, 1, &xpert[t * nx], 1);
+   }
+   std::vector<Number> gpert(nthreads * ng + 1);
+   std::vector<Number> fpert(nthreads);
+   std::vector<char> failed(nthreads);
+
+   std::vector<Number> jac_col(ng, 0.);
+   std::vector<Index> found_var(ng, -1);
+
+   Index nerrors = 0;
+   for( Index start = 0; start < ncolors; start += nthreads )
+   {
+      const Index nchunk = Min(nthreads, ncolors - start);
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         const Index color = start + t;
+         Number* x = &xpert[t * nx];
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            x[color_ja[k]] += perturbation[color_ja[k]];
+         }
+         failed[t] = 0;
+         if( !tnlp_->eval_f(nx, x, true, fpert[t]) )
+         {
+            failed[t] = 'f';
+         }
+         else if( ng > 0 && !tnlp_->eval_g(nx, x, nthreads > 1, ng, &gpert[t * ng]) )
+         {
+            failed[t] = 'g';
+         }
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            x[color_ja[k]] = ref.x[color_ja[k]];
+         }
+      }
+
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         ASSERT_EXCEPTION(failed[t] != 'f', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                          "In TNLP derivative test: f could not be evaluated at perturbed point.");
+         ASSERT_EXCEPTION(failed[t] != 'g', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                          "In TNLP derivative test: g could not be evaluated at perturbed point.");
+
+         // The objective depends on all variables, so only its derivative
+         // along the perturbation of the group can be checked
+         const Index color = start + t;
+         Number max_perturbation = 0.;
+         Number deriv_exact = 0.;
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            const Index ivar = color_ja[k];
+            max_perturbation = Max(max_perturbation, perturbation[ivar]);
+            deriv_exact += ref.grad_f[ivar] * perturbation[ivar];
+         }
+         deriv_exact /= max_perturbation;
+         Number deriv_approx = (fpert[t] - ref.f) / max_perturbation;
+         Number rel_error;
+         char cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+         if( cflag != ' ' )
+         {
+            nerrors++;
+         }
+         if( cflag != ' ' || derivative_test_print_all_ )
+         {
+            jnlst_->Printf(J_WARNING, J_NLP, "%c grad_f[color %5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                           color, deriv_exact, deriv_approx, rel_error);
+         }
+
+         if( ng == 0 )
+         {
+            continue;
+         }
+         // Each constraint depends on at most one variable of the group
+         // according to the sparsity structure
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            const Index ivar = color_ja[k];
+            for( Index i = col_ia[ivar]; i < col_ia[ivar + 1]; i++ )
+            {
+               jac_col[col_row[i]] += ref.jac_values[col_pos[i]];
+               found_var[col_row[i]] = ivar;
+            }
+         }
+         const Number* g = &gpert[t * ng];
+         for( Index icon = 0; icon < ng; icon++ )
+         {
+            const Index ivar = found_var[icon];
+            if( ivar >= 0 )
+            {
+               deriv_approx = (g[icon] - ref.g[icon]) / perturbation[ivar];
+               deriv_exact = jac_col[icon];
+            }
+            else
+            {
+               deriv_approx = (g[icon] - ref.g[icon]) / max_perturbation;
+               deriv_exact = 0.;
+            }
+            cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+            if( cflag != ' ' )
+            {
+               nerrors++;
+            }
+            if( cflag == ' ' && !derivative_test_print_all_ )
+            {
+               continue;
+            }
+            if( ivar >= 0 )
+            {
+               jnlst_->Printf(J_WARNING, J_NLP, "%c jac_g [%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e v  ~ %23.16e  [%10.3e]\n", cflag,
+                              icon + index_correction, ivar + index_correction, deriv_exact, deriv_approx, rel_error);
+            }
+            else
+            {
+               jnlst_->Printf(J_WARNING, J_NLP, "%c jac_g [%5" IPOPT_INDEX_FORMAT ",color %5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                              icon + index_correction, color, deriv_exact, deriv_approx, rel_error);
+            }
+         }
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            const Index ivar = color_ja[k];
+            for( Index i = col_ia[ivar]; i < col_ia[ivar + 1]; i++ )
+            {
+               jac_col[col_row[i]] = 0.;
+               found_var[col_row[i]] = -1;
+            }
+         }
+      }
+   }
+
+   return nerrors;
+}
+
+Index TNLPAdapter::check_first_directional_derivatives(
+   const DerivativeTestPoint& ref
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+
+   // Random direction, scaled like the perturbations of single variables
+   std::vector<Number> direction(nx);
+   std::vector<Number> xpert(nx);
+   for( Index ivar = 0; ivar < nx; ivar++ )
+   {
+      direction[ivar] = (2. * IpRandom01() - 1.) * Max(1., fabs(ref.x[ivar]));
+      xpert[ivar] = ref.x[ivar] + derivative_test_perturbation_ * direction[ivar];
+   }
+
+   Number fpert;
+   bool retval = tnlp_->eval_f(nx, &xpert[0], true, fpert);
+   ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                    "In TNLP derivative test: f could not be evaluated at perturbed point.");
+   std::vector<Number> gpert(ng + 1);
+   if( ng > 0 )
+   {
+      retval = tnlp_->eval_g(nx, &xpert[0], false, ng, &gpert[0]);
+      ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                       "In TNLP derivative test: g could not be evaluated at perturbed point.");
+   }
+
+   Index nerrors = 0;
+   Number deriv_exact = IpBlasDdot(nx, ref.grad_f, 1, &direction[0], 1);
+   Number deriv_approx = (fpert - ref.f) / derivative_test_perturbation_;
+   Number rel_error;
+   char cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+   if( cflag != ' ' )
+   {
+      nerrors++;
+   }
+   if( cflag != ' ' || derivative_test_print_all_ )
+   {
+      jnlst_->Printf(J_WARNING, J_NLP, "%c grad_f*d           = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                     deriv_exact, deriv_approx, rel_error);
+   }
+
+   std::vector<Number> jac_d(ng, 0.);
+   for( Index i = 0; i < ref.nz_jac_g; i++ )
+   {
+      jac_d[ref.jac_iRow[i]] += ref.jac_values[i] * direction[ref.jac_jCol[i]];
+   }
+   for( Index icon = 0; icon < ng; icon++ )
+   {
+      deriv_approx = (gpert[icon] - ref.g[icon]) / derivative_test_perturbation_;
+      cflag = CompareDerivatives(jac_d[icon], deriv_approx, derivative_test_tol_, rel_error);
+      if( cflag != ' ' )
+      {
+         nerrors++;
+      }
+      if( cflag != ' ' || derivative_test_print_all_ )
+      {
+         jnlst_->Printf(J_WARNING, J_NLP, "%c jac_g*d[     %5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                        icon + ref.index_correction, jac_d[icon], deriv_approx, rel_error);
+      }
+   }
+
+   return nerrors;
+}
+
+Index TNLPAdapter::check_second_derivatives(
+   const DerivativeTestPoint& ref,
+   const std::vector<Index>&  cons,
+   const std::vector<Index>&  vars
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+   const Index nvars = static_cast<Index>(vars.size());
+   const Index index_correction = ref.index_correction;
+
+   std::vector<Index> jac_col_ia;
+   std::vector<Index> jac_col_row;
+   std::vector<Index> jac_col_pos;
+   ColumnEntries(nx, ref.nz_jac_g, ref.jac_iRow, ref.jac_jCol, false, jac_col_ia, jac_col_row, jac_col_pos);
+   std::vector<Index> h_col_ia;
+   std::vector<Index> h_col_row;
+   std::vector<Index> h_col_pos;
+   ColumnEntries(nx, ref.nz_hess_lag, ref.h_iRow, ref.h_jCol, true, h_col_ia, h_col_row, h_col_pos);
+
+   const Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(nvars) : 1;
+   std::vector<Number> xpert(nthreads * nx);
+   for( Index t = 0; t < nthreads; t++ )
+   {
+      IpBlasDcopy(nx, ref.x, 1, &xpert[t * nx], 1);
+   }
+   std::vector<Number> gradpert(nthreads * nx); // gradient of objective or constraint at perturbed point
+   std::vector<Number> jacpert(nthreads * ref.nz_jac_g + 1);
+   std::vector<Number> perturbation(nthreads);
+   std::vector<char> failed(nthreads);
+
+   std::vector<Number> lambda(ng + 1, 0.);
+   std::vector<Number> gradref(nx); // gradient of objective or constraint at reference point
+   std::vector<Number> h_values(ref.nz_hess_lag + 1);
+   std::vector<Number> hess_col(nx, 0.);
+   std::vector<char> found(nx, 0);
+
+   Index nerrors = 0;
+   for( std::vector<Index>::const_iterator it = cons.begin(); it != cons.end(); ++it )
+   {
+      const Index icon = *it;
+      Number objfact = 0.;
+      if( icon == -1 )
+      {
+         objfact = 1.;
+         IpBlasDcopy(nx, ref.grad_f, 1, &gradref[0], 1);
+      }
+      else
+      {
+         lambda[icon] = 1.;
+         std::fill(gradref.begin(), gradref.end(), 0.);
+         for( Index i = 0; i < ref.nz_jac_g; i++ )
+         {
+            if( ref.jac_iRow[i] == icon )
+            {
+               gradref[ref.jac_jCol[i]] += ref.jac_values[i];
+            }
+         }
+      }
+      // Hessian at reference point
+      bool retval = eval_h_for_test(ref, ref.x, objfact, ng > 0 ? &lambda[0] : NULL, &h_values[0]);
+      ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                       "In TNLP derivative test: Hessian could not be evaluated at reference point.");
+
+      for( Index start = 0; start < nvars; start += nthreads )
+      {
+         const Index nchunk = Min(nthreads, nvars - start);
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index t = 0; t < nchunk; t++ )
+         {
+            const Index ivar = vars[start + t];
+            Number* x = &xpert[t * nx];
+            Number* grad = &gradpert[t * nx];
+            perturbation[t] = derivative_test_perturbation_ * Max(1., fabs(ref.x[ivar]));
+            x[ivar] = ref.x[ivar] + perturbation[t];
+            if( icon == -1 )
+            {
+               // we are looking at the objective function
+               failed[t] = tnlp_->eval_grad_f(nx, x, true, grad) ? 0 : 'f';
+            }
+            else
+            {
+               // this is the icon-th constraint; filter its gradient from the Jacobian
+               Number* jac = &jacpert[t * ref.nz_jac_g];
+               failed[t] = eval_jac_g_for_test(ref, x, true, jac) ? 0 : 'g';
+               for( Index i = 0; i < nx; i++ )
+               {
+                  grad[i] = 0.;
+               }
+               for( Index i = 0; i < ref.nz_jac_g; i++ )
+               {
+                  if( ref.jac_iRow[i] == icon )
+                  {
+                     grad[ref.jac_jCol[i]] += jac[i];
+                  }
+               }
+            }
+            x[ivar] = ref.x[ivar];
+         }
+
+         for( Index t = 0; t < nchunk; t++ )
+         {
+            ASSERT_EXCEPTION(failed[t] != 'f', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                             "In TNLP derivative test: grad_f could not be evaluated at perturbed point.");
+            ASSERT_EXCEPTION(failed[t] != 'g', ERROR_IN_TNLP_DERIVATIVE_TEST,
+                             "In TNLP derivative test: Jacobian values could not be evaluated at perturbed point.");
+
+            const Index ivar = vars[start + t];
+            for( Index k = h_col_ia[ivar]; k < h_col_ia[ivar + 1]; k++ )
+            {
+               hess_col[h_col_row[k]] += h_values[h_col_pos[k]];
+               found[h_col_row[k]] = 1;
+            }
+            const Number* grad = &gradpert[t * nx];
+            for( Index ivar2 = 0; ivar2 < nx; ivar2++ )
+            {
+               Number deriv_approx = (grad[ivar2] - gradref[ivar2]) / perturbation[t];
+               Number deriv_exact = hess_col[ivar2];
+               Number rel_error;
+               char cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+               if( cflag != ' ' )
+               {
+                  nerrors++;
+               }
+               char sflag = found[ivar2] ? 'v' : ' ';
+               if( cflag != ' ' || derivative_test_print_all_ )
+               {
+                  if( icon == -1 )
+                  {
+                     jnlst_->Printf(J_WARNING, J_NLP,
+                                    "%c             obj_hess[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
+                                    ivar + index_correction, ivar2 + index_correction, deriv_exact, sflag, deriv_approx, rel_error);
+                  }
+                  else
+                  {
+                     jnlst_->Printf(J_WARNING, J_NLP,
+                                    "%c %5" IPOPT_INDEX_FORMAT "-th constr_hess[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
+                                    icon + index_correction, ivar + index_correction, ivar2 + index_correction, deriv_exact, sflag,
+                                    deriv_approx, rel_error);
+                  }
+               }
+            }
+            for( Index k = h_col_ia[ivar]; k < h_col_ia[ivar + 1]; k++ )
+            {
+               hess_col[h_col_row[k]] = 0.;
+               found[h_col_row[k]] = 0;
+            }
+         }
+      }
+
+      if( icon >= 0 )
+      {
+         lambda[icon] = 0.;
+      }
+   }
+
+   return nerrors;
+}
+
+bool TNLPAdapter::eval_grad_lagrangian_for_test(
+   const DerivativeTestPoint& ref,
+   const Number*              x,
+   bool                       new_x,
+   const Number*              lambda,
+   Number*                    grad,
+   Number*                    jac_values
+)
+{
+   if( !tnlp_->eval_grad_f(ref.nx, x, new_x, grad) )
+   {
+      return false;
+   }
+   if( ref.ng == 0 )
+   {
+      return true;
+   }
+   if( !eval_jac_g_for_test(ref, x, new_x, jac_values) )
+   {
+      return false;
+   }
+   for( Index i = 0; i < ref.nz_jac_g; i++ )
+   {
+      grad[ref.jac_jCol[i]] += lambda[ref.jac_iRow[i]] * jac_values[i];
+   }
+   return true;
+}
+
+bool TNLPAdapter::eval_jac_g_for_test(
+   const DerivativeTestPoint& ref,
+   const Number*              x,
+   bool                       new_x,
+   Number*                    values
+)
+{
+   if( !ref.jac_block_start.empty() )
+   {
+      return eval_jac_g_blocks(ref.jac_block_start, ref.nx, x, new_x, ref.ng, values);
+   }
+   return tnlp_->eval_jac_g(ref.nx, x, new_x, ref.ng, ref.nz_jac_g, NULL, NULL, values);
+}
+
+bool TNLPAdapter::eval_h_for_test(
+   const DerivativeTestPoint& ref,
+   const Number*              x,
+   Number                     obj_factor,
+   const Number*              lambda,
+   Number*                    values
+)
+{
+   if( !ref.hess_block_start.empty() )
+   {
+      return eval_h_blocks(ref.hess_block_start, ref.nx, x, true, obj_factor, ref.ng, lambda, true, values);
+   }
+   return tnlp_->eval_h(ref.nx, x, true, obj_factor, ref.ng, lambda, true, ref.nz_hess_lag, NULL, NULL, values);
+}
+
+Index TNLPAdapter::check_second_derivatives_colored(
+   const DerivativeTestPoint& ref
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+   const Index index_correction = ref.index_correction;
+
+   // Lagrangian with random multipliers, so that all Hessians are checked at once
+   std::vector<Number> lambda(ng + 1);
+   for( Index icon = 0; icon < ng; icon++ )
+   {
+      lambda[icon] = 2. * IpRandom01() - 1.;
+   }
+   std::vector<Number> h_values(ref.nz_hess_lag + 1);
+   bool retval = eval_h_for_test(ref, ref.x, 1., ng > 0 ? &lambda[0] : NULL, &h_values[0]);
+   ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                    "In TNLP derivative test: Hessian could not be evaluated at reference point.");
+   std::vector<Number> gradref(nx);
+   IpBlasDcopy(nx, ref.grad_f, 1, &gradref[0], 1);
+   for( Index i = 0; i < ref.nz_jac_g; i++ )
+   {
+      gradref[ref.jac_jCol[i]] += lambda[ref.jac_iRow[i]] * ref.jac_values[i];
+   }
+
+   // Coloring the columns of the full symmetric Hessian such that no two
+   // columns of the same color share a row gives groups of variables for
+   // which each Hessian entry can be recovered directly
+   std::vector<Index> col_ia;
+   std::vector<Index> col_row;
+   std::vector<Index> col_pos;
+   ColumnEntries(nx, ref.nz_hess_lag, ref.h_iRow, ref.h_jCol, true, col_ia, col_row, col_pos);
+   std::vector<Index> color_ia;
+   std::vector<Index> color_ja;
+   ColorColumnsForTest(nx, nx, col_ia, col_row, color_ia, color_ja);
+   const Index ncolors = static_cast<Index>(color_ia.size()) - 1;
+   jnlst_->Printf(J_DETAILED, J_NLP, "Checking second derivatives with %" IPOPT_INDEX_FORMAT " perturbed points.\n\n", ncolors);
+
+   std::vector<Number> perturbation(nx);
+   for( Index ivar = 0; ivar < nx; ivar++ )
+   {
+      perturbation[ivar] = derivative_test_perturbation_ * Max(1., fabs(ref.x[ivar]));
+   }
+
+   const Index nthreads = tnlp_->is_reentrant() ? IpNumThreadsForTasks(ncolors) : 1;
+   std::vector<Number> xpert(nthreads * nx);
+   for( Index t = 0; t < nthreads; t++ )
+   {
+      IpBlasDcopy(nx, ref.x, 1, &xpert[t * nx], 1);
+   }
+   std::vector<Number> gradpert(nthreads * nx);
+   std::vector<Number> jacpert(nthreads * ref.nz_jac_g + 1);
+   std::vector<char> failed(nthreads);
+
+   std::vector<Number> hess_col(nx, 0.);
+   std::vector<Index> found_var(nx, -1);
+
+   Index nerrors = 0;
+   for( Index start = 0; start < ncolors; start += nthreads )
+   {
+      const Index nchunk = Min(nthreads, ncolors - start);
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         const Index color = start + t;
+         Number* x = &xpert[t * nx];
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            x[color_ja[k]] += perturbation[color_ja[k]];
+         }
+         failed[t] = !eval_grad_lagrangian_for_test(ref, x, true, &lambda[0], &gradpert[t * nx],
+                     &jacpert[t * ref.nz_jac_g]);
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            x[color_ja[k]] = ref.x[color_ja[k]];
+         }
+      }
+
+      for( Index t = 0; t < nchunk; t++ )
+      {
+         ASSERT_EXCEPTION(!failed[t], ERROR_IN_TNLP_DERIVATIVE_TEST,
+                          "In TNLP derivative test: gradient of Lagrangian could not be evaluated at perturbed point.");
+
+         const Index color = start + t;
+         Number max_perturbation = 0.;
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            const Index ivar = color_ja[k];
+            max_perturbation = Max(max_perturbation, perturbation[ivar]);
+            for( Index i = col_ia[ivar]; i < col_ia[ivar + 1]; i++ )
+            {
+               hess_col[col_row[i]] += h_values[col_pos[i]];
+               found_var[col_row[i]] = ivar;
+            }
+         }
+         const Number* grad = &gradpert[t * nx];
+         for( Index ivar2 = 0; ivar2 < nx; ivar2++ )
+         {
+            const Index ivar = found_var[ivar2];
+            Number deriv_approx;
+            Number deriv_exact;
+            if( ivar >= 0 )
+            {
+               deriv_approx = (grad[ivar2] - gradref[ivar2]) / perturbation[ivar];
+               deriv_exact = hess_col[ivar2];
+            }
+            else
+            {
+               deriv_approx = (grad[ivar2] - gradref[ivar2]) / max_perturbation;
+               deriv_exact = 0.;
+            }
+            Number rel_error;
+            char cflag = CompareDerivatives(deriv_exact, deriv_approx, derivative_test_tol_, rel_error);
+            if( cflag != ' ' )
+            {
+               nerrors++;
+            }
+            if( cflag == ' ' && !derivative_test_print_all_ )
+            {
+               continue;
+            }
+            if( ivar >= 0 )
+            {
+               jnlst_->Printf(J_WARNING, J_NLP, "%c             lag_hess[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e v  ~ %23.16e  [%10.3e]\n",
+                              cflag, ivar + index_correction, ivar2 + index_correction, deriv_exact, deriv_approx, rel_error);
+            }
+            else
+            {
+               jnlst_->Printf(J_WARNING, J_NLP, "%c       lag_hess[color %5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n",
+                              cflag, color, ivar2 + index_correction, deriv_exact, deriv_approx, rel_error);
+            }
+         }
+         for( Index k = color_ia[color]; k < color_ia[color + 1]; k++ )
+         {
+            const Index ivar = color_ja[k];
+            for( Index i = col_ia[ivar]; i < col_ia[ivar + 1]; i++ )
+            {
+               hess_col[col_row[i]] = 0.;
+               found_var[col_row[i]] = -1;
+            }
+         }
+      }
+   }
+
+   return nerrors;
+}
+
+Index TNLPAdapter::check_second_directional_derivatives(
+   const DerivativeTestPoint& ref
+)
+{
+   const Index nx = ref.nx;
+   const Index ng = ref.ng;
+
+   std::vector<Number> lambda(ng + 1);
+   for( Index icon = 0; icon < ng; icon++ )
+   {
+      lambda[icon] = 2. * IpRandom01() - 1.;
+   }
+   std::vector<Number> direction(nx);
+   std::vector<Number> xpert(nx);
+   for( Index ivar = 0; ivar < nx; ivar++ )
+   {
+      direction[ivar] = (2. * IpRandom01() - 1.) * Max(1., fabs(ref.x[ivar]));
+      xpert[ivar] = ref.x[ivar] + derivative_test_perturbation_ * direction[ivar];
+   }
+
+   std::vector<Number> h_values(ref.nz_hess_lag + 1);
+   bool retval = eval_h_for_test(ref, ref.x, 1., ng > 0 ? &lambda[0] : NULL, &h_values[0]);
+   ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                    "In TNLP derivative test: Hessian could not be evaluated at reference point.");
+   std::vector<Number> hess_d(nx, 0.);
+   for( Index i = 0; i < ref.nz_hess_lag; i++ )
+   {
+      hess_d[ref.h_iRow[i]] += h_values[i] * direction[ref.h_jCol[i]];
+      if( ref.h_iRow[i] != ref.h_jCol[i] )
+      {
+         hess_d[ref.h_jCol[i]] += h_values[i] * direction[ref.h_iRow[i]];
+      }
+   }
+
+   std::vector<Number> gradref(nx);
+   IpBlasDcopy(nx, ref.grad_f, 1, &gradref[0], 1);
+   for( Index i = 0; i < ref.nz_jac_g; i++ )
+   {
+      gradref[ref.jac_jCol[i]] += lambda[ref.jac_iRow[i]] * ref.jac_values[i];
+   }
+   std::vector<Number> gradpert(nx);
+   std::vector<Number> jacpert(ref.nz_jac_g + 1);
+   retval = eval_grad_lagrangian_for_test(ref, &xpert[0], true, &lambda[0], &gradpert[0], &jacpert[0]);
+   ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                    "In TNLP derivative test: gradient of Lagrangian could not be evaluated at perturbed point.");
+
+   Index nerrors = 0;
+   for( Index ivar = 0; ivar < nx; ivar++ )
+   {
+      Number deriv_approx = (gradpert[ivar] - gradref[ivar]) / derivative_test_perturbation_;
+      Number rel_error;
+      char cflag = CompareDerivatives(hess_d[ivar], deriv_approx, derivative_test_tol_, rel_error);
+      if( cflag != ' ' )
+      {
+         nerrors++;
+      }
+      if( cflag != ' ' || derivative_test_print_all_ )
+      {
+         jnlst_->Printf(J_WARNING, J_NLP, "%c           lag_hess*d[%5" IPOPT_INDEX_FORMAT "] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
+                        ivar + ref.index_correction, hess_d[ivar], deriv_approx, rel_error);
+      }
+   }
+
+   return nerrors;
+}
+
+bool TNLPAdapter::CheckDerivatives(
+   TNLPAdapter::DerivativeTestEnum deriv_test,
+   Index                           deriv_test_start_index
+)
+{
+   if( deriv_test == NO_TEST )
+   {
+      return true;
+   }
+
+   Index nerrors = 0;
+
+   ASSERT_EXCEPTION(IsValid(jnlst_), ERROR_IN_TNLP_DERIVATIVE_TEST,
+                    "No Journalist given to TNLPAdapter.  Need Journalist, otherwise can't produce any output in DerivativeChecker!");
+
+   bool retval = true;
+   // Since this method should be independent of all other internal
+   // data (so that it can be called indpenendent of GetSpace etc),
+   // we are not using any internal fields
+
+   // Obtain the problem size
+   Index nx; // number of variables
+   Index ng; // number of constriants
+   Index nz_jac_g; // number of nonzeros in constraint Jacobian
+   Index nz_hess_lag; // number of nonzeros in Lagrangian Hessian
+   TNLP::IndexStyleEnum index_style;
+   retval = tnlp_->get_nlp_info(nx, ng, nz_jac_g, nz_hess_lag, index_style);
+   ASSERT_EXCEPTION(retval, INVALID_TNLP, "get_nlp_info returned false for derivative checker");
+
+   // Obtain starting point as reference point at which derivative
+   // test should be performed
+   Number* xref = new Number[nx];
    tnlp_->get_starting_point(nx, true, xref, false, NULL, NULL, ng, false, NULL);
 
    // Perform a random perturbation.  We need the bounds to make sure
@@ -2853,6 +4669,11 @@ bool TNLPAdapter::CheckDerivatives(
    Index* g_iRow = NULL;
    Index* g_jCol = NULL;
    Number* jac_g = NULL;
+   DerivativeTestPoint ref;
+   ref.nx = nx;
+   ref.ng = ng;
+   ref.nz_jac_g = nz_jac_g;
+   ref.nz_hess_lag = nz_hess_lag;
    if( ng > 0 )
    {
       // Obtain constraint Jacobian at reference point (including structure)
@@ -2886,22 +4707,18 @@ bool TNLPAdapter::CheckDerivatives(
          }
       }
 #endif
-      // Obtain values at reference pont
-      jac_g = new Number[nz_jac_g];
-      retval = tnlp_->eval_jac_g(nx, xref, new_x, ng, nz_jac_g, NULL, NULL, jac_g);
-      ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                       "In TNLP derivative test: Jacobian values could not be evaluated at reference point.");
    }
 
-   // Space for the perturbed point
-   Number* xpert = new Number[nx];
-   IpBlasDcopy(nx, xref, 1, xpert, 1);
+   // Evaluate the derivatives by blocks if the TNLP provides them
+   compute_derivative_blocks(ng, nz_jac_g, nz_hess_lag, g_iRow, 0, ref.jac_block_start, ref.hess_block_start);
 
-   // Space for constraints at perturbed point
-   Number* gpert = NULL;
    if( ng > 0 )
    {
-      gpert = new Number[ng];
+      // Obtain values at reference pont
+      jac_g = new Number[nz_jac_g];
+      retval = eval_jac_g_for_test(ref, xref, new_x, jac_g);
+      ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
+                       "In TNLP derivative test: Jacobian values could not be evaluated at reference point.");
    }
 
    Index index_correction = 0;
@@ -2910,83 +4727,40 @@ bool TNLPAdapter::CheckDerivatives(
       index_correction = 1;
    }
 
+   ref.index_correction = index_correction;
+   ref.x = xref;
+   ref.f = fref;
+   ref.g = gref;
+   ref.grad_f = grad_f;
+   ref.jac_iRow = g_iRow;
+   ref.jac_jCol = g_jCol;
+   ref.jac_values = jac_g;
+   ref.h_iRow = NULL;
+   ref.h_jCol = NULL;
+
+   std::vector<Index> vars;
+   std::vector<Index> cons;
    if( deriv_test == FIRST_ORDER_TEST || deriv_test == SECOND_ORDER_TEST )
    {
       jnlst_->Printf(J_SUMMARY, J_NLP, "Starting derivative checker for first derivatives.\n\n");
 
-      // Now go through all variables and check the partial derivatives
       const Index ivar_first = Max(0, deriv_test_start_index);
-      for( Index ivar = ivar_first; ivar < nx; ivar++ )
+      switch( derivative_test_mode_ )
       {
-         Number this_perturbation = derivative_test_perturbation_ * Max(1., fabs(xref[ivar]));
-         xpert[ivar] = xref[ivar] + this_perturbation;
-
-         Number fpert;
-         new_x = true;
-         retval = tnlp_->eval_f(nx, xpert, new_x, fpert);
-         ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                          "In TNLP derivative test: f could not be evaluated at perturbed point.");
-         new_x = false;
-
-         Number deriv_approx = (fpert - fref) / this_perturbation;
-         Number deriv_exact = grad_f[ivar];
-         Number rel_error = fabs(deriv_approx - deriv_exact) / Max(fabs(deriv_approx), 1.);
-         char cflag = ' ';
-         if( rel_error >= derivative_test_tol_ )
-         {
-            cflag = '*';
-            nerrors++;
-         }
-         if( cflag != ' ' || derivative_test_print_all_ )
-         {
-            jnlst_->Printf(J_WARNING, J_NLP, "%c grad_f[      %5d] = %23.16e    ~ %23.16e  [%10.3e]\n", cflag,
-                           ivar + index_correction, deriv_exact, deriv_approx, rel_error);
-         }
-
-         if( ng > 0 )
-         {
-            retval = tnlp_->eval_g(nx, xpert, new_x, ng, gpert);
-            ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                             "In TNLP derivative test: g could not be evaluated at reference point.");
-            for( Index icon = 0; icon < ng; icon++ )
-            {
-               deriv_approx = (gpert[icon] - gref[icon]) / this_perturbation;
-               deriv_exact = 0.;
-               bool found = false;
-               for( Index i = 0; i < nz_jac_g; i++ )
-               {
-                  if( g_iRow[i] == icon && g_jCol[i] == ivar )
-                  {
-                     found = true;
-                     deriv_exact += jac_g[i];
-                  }
-               }
-
-               rel_error = fabs(deriv_approx - deriv_exact) / Max(fabs(deriv_approx), 1.);
-               cflag = ' ';
-               if( rel_error >= derivative_test_tol_ )
-               {
-                  cflag = '*';
-                  nerrors++;
-               }
-               char sflag = ' ';
-               if( found )
-               {
-                  sflag = 'v';
-               }
-               if( cflag != ' ' || derivative_test_print_all_ )
-               {
-                  jnlst_->Printf(J_WARNING, J_NLP, "%c jac_g [%5d,%5d] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
-                                 icon + index_correction, ivar + index_correction, deriv_exact, sflag, deriv_approx, rel_error);
-               }
-            }
-         }
-
-         xpert[ivar] = xref[ivar];
+         case ALL_ENTRIES_TEST:
+            SampleIndices(ivar_first, nx, nx, vars);
+            nerrors += check_first_derivatives(ref, vars);
+            break;
+         case SAMPLED_TEST:
+            SampleIndices(ivar_first, nx, derivative_test_sample_size_, vars);
+            nerrors += check_first_derivatives(ref, vars);
+            nerrors += check_first_directional_derivatives(ref);
+            break;
+         case COLORED_TEST:
+            nerrors += check_first_derivatives_colored(ref);
+            break;
       }
-
    }
-   const Number zero = 0.;
    if( deriv_test == SECOND_ORDER_TEST || deriv_test == ONLY_SECOND_ORDER_TEST )
    {
       jnlst_->Printf(J_SUMMARY, J_NLP, "Starting derivative checker for second derivatives.\n\n");
@@ -3022,152 +4796,43 @@ bool TNLPAdapter::CheckDerivatives(
          }
       }
 #endif
-      Number* h_values = new Number[nz_hess_lag];
-
-      Number* lambda = NULL;
-      if( ng > 0 )
-      {
-         lambda = new Number[ng];
-         IpBlasDcopy(ng, &zero, 0, lambda, 1);
-      }
-      Number* gradref = new Number[nx]; // gradient of objective or constraint at reference point
-      Number* gradpert = new Number[nx]; // gradient of objective or constraint at perturbed point
-      Number* jacpert = new Number[nz_jac_g];
+      ref.h_iRow = h_iRow;
+      ref.h_jCol = h_jCol;
 
-      // Check all Hessians
+      // Check the Hessians of the objective (-1) and the constraints
       const Index icon_first = Max(-1, deriv_test_start_index);
-      for( Index icon = icon_first; icon < ng; icon++ )
+      switch( derivative_test_mode_ )
       {
-         Number objfact = 0.;
-         if( icon == -1 )
-         {
-            objfact = 1.;
-            IpBlasDcopy(nx, grad_f, 1, gradref, 1);
-         }
-         else
-         {
-            lambda[icon] = 1.;
-            IpBlasDcopy(nx, &zero, 0, gradref, 1);
-            for( Index i = 0; i < nz_jac_g; i++ )
-            {
-               if( g_iRow[i] == icon )
-               {
-                  gradref[g_jCol[i]] += jac_g[i];
-               }
-            }
-         }
-         // Hessian at reference point
-         new_x = true;
-         bool new_y = true;
-         retval = tnlp_->eval_h(nx, xref, new_x, objfact, ng, lambda, new_y, nz_hess_lag, NULL, NULL, h_values);
-         new_x = false;
-         new_y = false;
-         ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                          "In TNLP derivative test: Hessian could not be evaluated at reference point.");
-
-         for( Index ivar = 0; ivar < nx; ivar++ )
-         {
-            Number this_perturbation = derivative_test_perturbation_ * Max(1., fabs(xref[ivar]));
-            xpert[ivar] = xref[ivar] + this_perturbation;
-
-            new_x = true;
-            if( icon == -1 )
-            {
-               // we are looking at the objective function
-               retval = tnlp_->eval_grad_f(nx, xpert, new_x, gradpert);
-               ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                                "In TNLP derivative test: grad_f could not be evaluated at perturbed point.");
-            }
-            else
-            {
-               // this is the icon-th constraint
-               retval = tnlp_->eval_jac_g(nx, xpert, new_x, ng, nz_jac_g, NULL, NULL, jacpert);
-               ASSERT_EXCEPTION(retval, ERROR_IN_TNLP_DERIVATIVE_TEST,
-                                "In TNLP derivative test: Jacobian values could not be evaluated at reference point.");
-               // ok, now we need to filter the gradient of the icon-th constraint
-               IpBlasDcopy(nx, &zero, 0, gradpert, 1);
-               IpBlasDcopy(nx, &zero, 0, gradref, 1);
-               for( Index i = 0; i < nz_jac_g; i++ )
-               {
-                  if( g_iRow[i] == icon )
-                  {
-                     gradpert[g_jCol[i]] += jacpert[i];
-                     gradref[g_jCol[i]] += jac_g[i];
-                  }
-               }
-            }
-            new_x = false;
-
-            for( Index ivar2 = 0; ivar2 < nx; ivar2++ )
+         case ALL_ENTRIES_TEST:
+            SampleIndices(icon_first, ng, ng + 1, cons);
+            SampleIndices(0, nx, nx, vars);
+            nerrors += check_second_derivatives(ref, cons, vars);
+            break;
+         case SAMPLED_TEST:
+            SampleIndices(Max(0, icon_first), ng, derivative_test_sample_size_, cons);
+            if( icon_first == -1 )
             {
-               Number deriv_approx = (gradpert[ivar2] - gradref[ivar2]) / this_perturbation;
-               Number deriv_exact = 0.;
-               bool found = false;
-               for( Index i = 0; i < nz_hess_lag; i++ )
-               {
-                  if( (h_iRow[i] == ivar && h_jCol[i] == ivar2) || (h_jCol[i] == ivar && h_iRow[i] == ivar2) )
-                  {
-                     deriv_exact += h_values[i];
-                     found = true;
-                  }
-               }
-               Number rel_error = fabs(deriv_approx - deriv_exact) / Max(fabs(deriv_approx), 1.);
-               char cflag = ' ';
-               if( rel_error >= derivative_test_tol_ )
-               {
-                  cflag = '*';
-                  nerrors++;
-               }
-               char sflag = ' ';
-               if( found )
-               {
-                  sflag = 'v';
-               }
-               if( cflag != ' ' || derivative_test_print_all_ )
-               {
-                  if( icon == -1 )
-                  {
-                     jnlst_->Printf(J_WARNING, J_NLP,
-                                    "%c             obj_hess[%5d,%5d] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
-                                    ivar + index_correction, ivar2 + index_correction, deriv_exact, sflag, deriv_approx, rel_error);
-                  }
-                  else
-                  {
-                     jnlst_->Printf(J_WARNING, J_NLP,
-                                    "%c %5d-th constr_hess[%5d,%5d] = %23.16e %c  ~ %23.16e  [%10.3e]\n", cflag,
-                                    icon + index_correction, ivar + index_correction, ivar2 + index_correction, deriv_exact, sflag,
-                                    deriv_approx, rel_error);
-                  }
-               }
-
+               cons.insert(cons.begin(), -1);
             }
-
-            xpert[ivar] = xref[ivar];
-         }
-
-         if( icon >= 0 )
-         {
-            lambda[icon] = 0.;
-         }
+            SampleIndices(0, nx, derivative_test_sample_size_, vars);
+            nerrors += check_second_derivatives(ref, cons, vars);
+            nerrors += check_second_directional_derivatives(ref);
+            break;
+         case COLORED_TEST:
+            nerrors += check_second_derivatives_colored(ref);
+            break;
       }
 
       delete[] h_iRow;
       delete[] h_jCol;
-      delete[] h_values;
-      delete[] lambda;
-      delete[] gradref;
-      delete[] gradpert;
-      delete[] jacpert;
    }
 
    delete[] xref;
    delete[] gref;
    delete[] grad_f;
-   delete[] xpert;
    delete[] g_iRow;
    delete[] g_jCol;
    delete[] jac_g;
-   delete[] gpert;
 
    if( nerrors == 0 )
    {
@@ -3175,7 +4840,7 @@ bool TNLPAdapter::CheckDerivatives(
    }
    else
    {
-      jnlst_->Printf(J_WARNING, J_NLP, "\nDerivative checker detected %d error(s).\n\n", nerrors);
+      jnlst_->Printf(J_WARNING, J_NLP, "\nDerivative checker detected %" IPOPT_INDEX_FORMAT " error(s).\n\n", nerrors);
    }
 
    return retval;
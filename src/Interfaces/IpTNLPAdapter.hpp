@@ -11,6 +11,7 @@
 #include "IpTNLP.hpp"
 #include "IpOrigIpoptNLP.hpp"
 #include <list>
+#include <vector>
 
 namespace Ipopt
 {
@@ -150,6 +151,30 @@ public:
       SymMatrix&    h
    );
 
+   virtual bool Eval_all(
+      const Vector& x,
+      Number*       f,
+      Vector*       g_f,
+      Vector*       c,
+      Vector*       d,
+      Matrix*       jac_c,
+      Matrix*       jac_d
+   );
+
+   /** Evaluate the objective and constraints at several points.
+    *
+    *  This is only supported if the TNLP is reentrant; the points are then
+    *  evaluated concurrently.
+    */
+   virtual bool Eval_f_c_d_at_points(
+      Index                npoints,
+      const Vector* const* x,
+      Number*              f,
+      Vector* const*       c,
+      Vector* const*       d,
+      bool*                success
+   );
+
    virtual void GetScalingParameters(
       const SmartPtr<const VectorSpace> x_space,
       const SmartPtr<const VectorSpace> c_space,
@@ -217,6 +242,14 @@ public:
       ONLY_SECOND_ORDER_TEST
    };
 
+   /** Enum for specifying which derivatives are compared by the derivative test. */
+   enum DerivativeTestModeEnum
+   {
+      ALL_ENTRIES_TEST = 0,
+      SAMPLED_TEST,
+      COLORED_TEST
+   };
+
    /** Enum for specifying technique for computing Jacobian */
    enum JacobianApproxEnum
    {
@@ -339,6 +372,10 @@ private:
    bool derivative_test_print_all_;
    /** Index of first quantity to be checked. */
    Index derivative_test_first_index_;
+   /** Which derivatives are compared in the derivative test */
+   DerivativeTestModeEnum derivative_test_mode_;
+   /** Number of variables and constraints to be checked in the sampled derivative test */
+   Index derivative_test_sample_size_;
    /** Flag indicating whether the TNLP with identical structure has already been solved before. */
    bool warm_start_same_structure_;
    /** Flag indicating what Hessian information is to be used. */
@@ -432,12 +469,115 @@ private:
    //@{
    bool internal_eval_g(bool new_x);
    bool internal_eval_jac_g(bool new_x);
+
+   /** Copy the values of the equality constraints from the values g of
+    *  all constraints at the point x_orig.
+    */
+   void ExtractC(
+      const Number* g,
+      const Number* x_orig,
+      Vector&       c
+   ) const;
+
+   /** Copy the values of the inequality constraints from the values g of
+    *  all constraints.
+    */
+   void ExtractD(
+      const Number* g,
+      Vector&       d
+   ) const;
    //@}
 
    /** @name Internal methods for dealing with finite difference approximation */
    //@{
-   /** Initialize sparsity structure for finite difference Jacobian */
+   /** Initialize sparsity structure and column coloring for finite difference Jacobian */
    void initialize_findiff_jac(const Index* iRow, const Index* jCol);
+
+   /** Initialize star coloring of the (1-based) Hessian structure for finite difference Hessian */
+   void initialize_findiff_hess(const Index* iRow, const Index* jCol);
+
+   /** Compute the gradient of the Lagrangian at x, using jac_values as work space for the Jacobian */
+   bool eval_grad_lagrangian(const Number* x, bool new_x, Number obj_factor, Number* grad, Number* jac_values);
+
+   /** Evaluate the Hessian of the Lagrangian into values by finite differences of its gradient */
+   bool eval_findiff_h(bool new_x, Number obj_factor, Number* values);
+   //@}
+
+   /** @name Internal methods for the evaluation of derivatives by blocks */
+   //@{
+   /** Obtain the blocks for the parallel evaluation of derivatives from
+    *  the TNLP and the positions of the Jacobian entries of each block
+    *  from the (1-based) row indices iRow of the Jacobian structure.
+    */
+   void initialize_derivative_blocks(const Index* iRow);
+
+   /** Obtain the blocks for the parallel evaluation of derivatives from
+    *  the TNLP for a problem with ng constraints.
+    *
+    *  jac_block_start and hess_block_start receive the first Jacobian and
+    *  Hessian entry of each block and one past the last entry.  The row
+    *  indices iRow of the Jacobian structure are counted from offset.
+    *  Returns the number of blocks, which is 0 if the TNLP does not
+    *  provide blocks.
+    */
+   Index compute_derivative_blocks(Index ng, Index nz_jac_g, Index nz_hess_lag, const Index* iRow, Index offset,
+                                   std::vector<Index>& jac_block_start, std::vector<Index>& hess_block_start);
+
+   /** Evaluate the values of the Jacobian of g at x by the blocks given by jac_block_start */
+   bool eval_jac_g_blocks(const std::vector<Index>& jac_block_start, Index n, const Number* x, bool new_x, Index m,
+                          Number* values);
+
+   /** Evaluate the values of the Jacobian of g at x, by blocks if the
+    *  TNLP provides derivative blocks.
+    */
+   bool eval_jac_g_values(const Number* x, bool new_x, Number* values);
+
+   /** Evaluate the Hessian of the Lagrangian into values by the blocks given by hess_block_start */
+   bool eval_h_blocks(const std::vector<Index>& hess_block_start, Index n, const Number* x, bool new_x,
+                      Number obj_factor, Index m, const Number* lambda, bool new_lambda, Number* values);
+   //@}
+
+   /** @name Internal methods for the derivative test
+    *
+    *  Each method returns the number of errors it detected.  The
+    *  perturbed points are evaluated in parallel if the TNLP is reentrant.
+    */
+   //@{
+   /** Reference point and derivatives of the derivative test */
+   struct DerivativeTestPoint;
+
+   /** Check the gradient of f and the columns of the Jacobian for the given variables */
+   Index check_first_derivatives(const DerivativeTestPoint& ref, const std::vector<Index>& vars);
+
+   /** Check the gradient of f and the Jacobian by perturbing groups of variables that do not share a constraint */
+   Index check_first_derivatives_colored(const DerivativeTestPoint& ref);
+
+   /** Check the derivatives of f and g along a random direction */
+   Index check_first_directional_derivatives(const DerivativeTestPoint& ref);
+
+   /** Check the columns of the Hessians of the given functions (-1 for the objective) for the given variables */
+   Index check_second_derivatives(const DerivativeTestPoint& ref, const std::vector<Index>& cons,
+                                  const std::vector<Index>& vars);
+
+   /** Check the Hessian of a Lagrangian with random multipliers by perturbing groups of variables */
+   Index check_second_derivatives_colored(const DerivativeTestPoint& ref);
+
+   /** Check the Hessian of a Lagrangian with random multipliers along a random direction */
+   Index check_second_directional_derivatives(const DerivativeTestPoint& ref);
+
+   /** Evaluate the gradient of the Lagrangian with objective factor 1 and
+    *  multipliers lambda at x for the derivative test, using jac_values as
+    *  work space for the Jacobian */
+   bool eval_grad_lagrangian_for_test(const DerivativeTestPoint& ref, const Number* x, bool new_x,
+                                      const Number* lambda, Number* grad, Number* jac_values);
+
+   /** Evaluate the values of the Jacobian at x for the derivative test, by blocks if the TNLP provides them */
+   bool eval_jac_g_for_test(const DerivativeTestPoint& ref, const Number* x, bool new_x, Number* values);
+
+   /** Evaluate the values of the Hessian of the Lagrangian at x for the
+    *  derivative test, by blocks if the TNLP provides them */
+   bool eval_h_for_test(const DerivativeTestPoint& ref, const Number* x, Number obj_factor, const Number* lambda,
+                        Number* values);
    //@}
 
    /**@name Internal Permutation Spaces and matrices
@@ -484,6 +624,41 @@ private:
    Number* findiff_x_l_;
    /** Copy of the upper bounds */
    Number* findiff_x_u_;
+   /** Number of colors of the columns of the Jacobian */
+   Index findiff_num_colors_;
+   /** Start position for the columns of each color in findiff_color_ja_ */
+   Index* findiff_color_ia_;
+   /** Ordered by colors, the columns of each color */
+   Index* findiff_color_ja_;
+
+   /** Row indices of the Jacobian structure (counted from 0) for the gradient of the Lagrangian */
+   std::vector<Index> findiff_hess_jac_iRow_;
+   /** Column indices of the Jacobian structure (counted from 0) for the gradient of the Lagrangian */
+   std::vector<Index> findiff_hess_jac_jCol_;
+   /** Number of colors of the columns of the Hessian */
+   Index findiff_hess_num_colors_;
+   /** Start position for the columns of each color in findiff_hess_color_ja_ */
+   std::vector<Index> findiff_hess_color_ia_;
+   /** Ordered by colors, the columns of each color */
+   std::vector<Index> findiff_hess_color_ja_;
+   /** Start position for the Hessian entries obtained from each color in findiff_hess_entry_pos_ */
+   std::vector<Index> findiff_hess_entry_ia_;
+   /** Ordered by colors, the position of each Hessian entry in the triplet structure */
+   std::vector<Index> findiff_hess_entry_pos_;
+   /** Entry of the gradient difference from which a Hessian entry is obtained */
+   std::vector<Index> findiff_hess_entry_row_;
+   /** Variable whose perturbation the gradient difference is divided by */
+   std::vector<Index> findiff_hess_entry_col_;
+   //@}
+
+   /** @name Data for the evaluation of derivatives by blocks */
+   //@{
+   /** Number of blocks, 0 if the derivatives are not evaluated by blocks */
+   Index num_deriv_blocks_;
+   /** Start position of the Jacobian entries of each block in jac_g_ */
+   std::vector<Index> deriv_block_jac_start_;
+   /** Start position of the Hessian entries of each block */
+   std::vector<Index> deriv_block_hess_start_;
    //@}
 };
 
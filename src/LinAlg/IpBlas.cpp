@@ -160,6 +160,44 @@ extern "C"
       int           transa_len,
       int           diag_len
    );
+
+   /** BLAS Fortran subroutine SGEMM */
+   void IPOPT_BLAS_FUNC(sgemm, SGEMM)(
+      char*        transa,
+      char*        transb,
+      ipfint*      m,
+      ipfint*      n,
+      ipfint*      k,
+      const float* alpha,
+      const float* a,
+      ipfint*      lda,
+      const float* b,
+      ipfint*      ldb,
+      const float* beta,
+      float*       c,
+      ipfint*      ldc,
+      int          transa_len,
+      int          transb_len
+   );
+
+   /** BLAS Fortran subroutine STRSM */
+   void IPOPT_BLAS_FUNC(strsm, STRSM)(
+      char*        side,
+      char*        uplo,
+      char*        transa,
+      char*        diag,
+      ipfint*      m,
+      ipfint*      n,
+      const float* alpha,
+      const float* a,
+      ipfint*      lda,
+      const float* b,
+      ipfint*      ldb,
+      int          side_len,
+      int          uplo_len,
+      int          transa_len,
+      int          diag_len
+   );
 }
 
 namespace Ipopt
@@ -313,7 +351,7 @@ void IpBlasDgemv(
    Index         incY
 )
 {
-   ipfint M = nCols, N = nRows, LDA = ldA, INCX = incX, INCY = incY;
+   ipfint M = nRows, N = nCols, LDA = ldA, INCX = incX, INCY = incY;
 
    char TRANS;
    if( trans )
@@ -444,4 +482,73 @@ void IpBlasDtrsm(
    IPOPT_BLAS_FUNC(dtrsm, DTRSM)(&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &alpha, A, &LDA, B, &LDB, 1, 1, 1, 1);
 }
 
+void IpBlasSgemm(
+   bool         transa,
+   bool         transb,
+   Index        m,
+   Index        n,
+   Index        k,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   const float* B,
+   Index        ldB,
+   float        beta,
+   float*       C,
+   Index        ldC
+)
+{
+   ipfint M = m, N = n, K = k, LDA = ldA, LDB = ldB, LDC = ldC;
+
+   char TRANSA;
+   if( transa )
+   {
+      TRANSA = 'T';
+   }
+   else
+   {
+      TRANSA = 'N';
+   }
+   char TRANSB;
+   if( transb )
+   {
+      TRANSB = 'T';
+   }
+   else
+   {
+      TRANSB = 'N';
+   }
+
+   IPOPT_BLAS_FUNC(sgemm, SGEMM)(&TRANSA, &TRANSB, &M, &N, &K, &alpha, A, &LDA, B, &LDB, &beta, C, &LDC, 1, 1);
+}
+
+void IpBlasStrsm(
+   bool         trans,
+   Index        ndim,
+   Index        nrhs,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   float*       B,
+   Index        ldB
+)
+{
+   ipfint M = ndim, N = nrhs, LDA = ldA, LDB = ldB;
+
+   char SIDE = 'L';
+   char UPLO = 'L';
+   char TRANSA;
+   if( trans )
+   {
+      TRANSA = 'T';
+   }
+   else
+   {
+      TRANSA = 'N';
+   }
+   char DIAG = 'N';
+
+   IPOPT_BLAS_FUNC(strsm, STRSM)(&SIDE, &UPLO, &TRANSA, &DIAG, &M, &N, &alpha, A, &LDA, B, &LDB, 1, 1, 1, 1);
+}
+
 } // namespace Ipopt
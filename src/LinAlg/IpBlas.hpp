@@ -47,7 +47,7 @@ IPOPTLIB_EXPORT Number IpBlasDasum(
  *
  * Compute index for largest absolute element of vector x.
  */
-IPOPTLIB_EXPORT int IpBlasIdamax(
+IPOPTLIB_EXPORT Index IpBlasIdamax(
    Index         size,
    const Number* x,
    Index         incX
@@ -174,6 +174,41 @@ IPOPTLIB_EXPORT void IpBlasDtrsm(
    Index         ldB
 );
 
+/** Wrapper for BLAS subroutine SGEMM.
+ *
+ * Multiplying two matrices in single precision.
+ */
+IPOPTLIB_EXPORT void IpBlasSgemm(
+   bool         transa,
+   bool         transb,
+   Index        m,
+   Index        n,
+   Index        k,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   const float* B,
+   Index        ldB,
+   float        beta,
+   float*       C,
+   Index        ldC
+);
+
+/** Wrapper for BLAS subroutine STRSM.
+ *
+ * Backsolve for a lower triangular matrix in single precision.
+ */
+IPOPTLIB_EXPORT void IpBlasStrsm(
+   bool         trans,
+   Index        ndim,
+   Index        nrhs,
+   float        alpha,
+   const float* A,
+   Index        ldA,
+   float*       B,
+   Index        ldB
+);
+
 } // namespace Ipopt
 
 #endif
@@ -9,6 +9,7 @@
 #include "IpCompoundVector.hpp"
 
 #include <cstdio>
+#include <vector>
 
 #define ALLOW_NESTED
 
@@ -136,35 +137,42 @@ void CompoundMatrix::MultVectorImpl(
       y.Set(0.0);  // In case y hasn't been initialized yet
    }
 
+   std::vector<SmartPtr<Vector> > y_comps(NComps_Rows());
    for( Index irow = 0; irow < NComps_Rows(); irow++ )
    {
-      SmartPtr<Vector> y_i;
       if( comp_y )
       {
-         y_i = comp_y->GetCompNonConst(irow);
+         y_comps[irow] = comp_y->GetCompNonConst(irow);
       }
       else
       {
-         y_i = &y;
+         y_comps[irow] = &y;
       }
-      DBG_ASSERT(IsValid(y_i));
+      DBG_ASSERT(IsValid(y_comps[irow]));
+   }
+   std::vector<SmartPtr<const Vector> > x_comps(NComps_Cols());
+   for( Index jcol = 0; jcol < NComps_Cols(); jcol++ )
+   {
+      if( comp_x )
+      {
+         x_comps[jcol] = comp_x->GetComp(jcol);
+      }
+      else if( NComps_Cols() == 1 )
+      {
+         x_comps[jcol] = &x;
+      }
+   }
 
+   const Index nthreads = NumThreadsForBlockRows(false, x.Dim() + y.Dim(), x_comps, y_comps);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index irow = 0; irow < NComps_Rows(); irow++ )
+   {
       for( Index jcol = 0; jcol < NComps_Cols(); jcol++ )
       {
-         if( (owner_space_->Diagonal() && irow == jcol) || (!owner_space_->Diagonal() && ConstComp(irow, jcol)) )
+         if( HasBlock(irow, jcol) )
          {
-            SmartPtr<const Vector> x_j;
-            if( comp_x )
-            {
-               x_j = comp_x->GetComp(jcol);
-            }
-            else if( NComps_Cols() == 1 )
-            {
-               x_j = &x;
-            }
-            DBG_ASSERT(IsValid(x_j));
-
-            ConstComp(irow, jcol)->MultVector(alpha, *x_j, 1., *y_i);
+            DBG_ASSERT(IsValid(x_comps[jcol]));
+            ConstComp(irow, jcol)->MultVector(alpha, *x_comps[jcol], 1., *y_comps[irow]);
          }
       }
    }
@@ -232,38 +240,82 @@ void CompoundMatrix::TransMultVectorImpl(
       y.Set(0.0);  // In case y hasn't been initialized yet
    }
 
+   std::vector<SmartPtr<Vector> > y_comps(NComps_Cols());
    for( Index irow = 0; irow < NComps_Cols(); irow++ )
    {
-      SmartPtr<Vector> y_i;
       if( comp_y )
       {
-         y_i = comp_y->GetCompNonConst(irow);
+         y_comps[irow] = comp_y->GetCompNonConst(irow);
+      }
+      else
+      {
+         y_comps[irow] = &y;
+      }
+      DBG_ASSERT(IsValid(y_comps[irow]));
+   }
+   std::vector<SmartPtr<const Vector> > x_comps(NComps_Rows());
+   for( Index jcol = 0; jcol < NComps_Rows(); jcol++ )
+   {
+      if( comp_x )
+      {
+         x_comps[jcol] = comp_x->GetComp(jcol);
       }
       else
       {
-         y_i = &y;
+         x_comps[jcol] = &x;
       }
-      DBG_ASSERT(IsValid(y_i));
+   }
 
+   const Index nthreads = NumThreadsForBlockRows(true, x.Dim() + y.Dim(), x_comps, y_comps);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index irow = 0; irow < NComps_Cols(); irow++ )
+   {
       for( Index jcol = 0; jcol < NComps_Rows(); jcol++ )
       {
-         if( (owner_space_->Diagonal() && irow == jcol) || (!owner_space_->Diagonal() && ConstComp(jcol, irow)) )
+         if( HasBlock(jcol, irow) )
          {
-            SmartPtr<const Vector> x_j;
-            if( comp_x )
-            {
-               x_j = comp_x->GetComp(jcol);
-            }
-            else
-            {
-               x_j = &x;
-            }
-            DBG_ASSERT(IsValid(x_j));
+            DBG_ASSERT(IsValid(x_comps[jcol]));
+            ConstComp(jcol, irow)->TransMultVector(alpha, *x_comps[jcol], 1., *y_comps[irow]);
+         }
+      }
+   }
+}
+
+Index CompoundMatrix::NumThreadsForBlockRows(
+   bool                                        trans,
+   Index                                       dim,
+   const std::vector<SmartPtr<const Vector> >& x_comps,
+   const std::vector<SmartPtr<Vector> >&       y_comps
+) const
+{
+   const Index nblocks = (Index) y_comps.size();
+   Index nthreads = IpNumThreadsForBlocks(nblocks, dim);
+   if( nthreads == 1 )
+   {
+      return 1;
+   }
 
-            ConstComp(jcol, irow)->TransMultVector(alpha, *x_j, 1., *y_i);
+   // every vector and matrix may only be used for one block of y
+   std::vector<std::pair<const void*, Index> > objects;
+   for( Index i = 0; i < nblocks; i++ )
+   {
+      objects.push_back(std::make_pair((const void*) GetRawPtr(y_comps[i]), i));
+      for( Index j = 0; j < (Index) x_comps.size(); j++ )
+      {
+         Index irow = trans ? j : i;
+         Index jcol = trans ? i : j;
+         if( HasBlock(irow, jcol) )
+         {
+            objects.push_back(std::make_pair((const void*) GetRawPtr(x_comps[j]), i));
+            objects.push_back(std::make_pair((const void*) ConstComp(irow, jcol), i));
          }
       }
    }
+   if( !IpBlocksDisjoint(objects) )
+   {
+      return 1;
+   }
+   return nthreads;
 }
 
 // Specialized method (overloaded from IpMatrix)
@@ -344,7 +396,7 @@ void CompoundMatrix::AddMSinvZImpl(
 
       for( Index jcol = 0; jcol < NComps_Cols(); jcol++ )
       {
-         if( (owner_space_->Diagonal() && irow == jcol) || (!owner_space_->Diagonal() && ConstComp(irow, jcol)) )
+         if( HasBlock(irow, jcol) )
          {
             SmartPtr<const Vector> S_j;
             if( comp_S )
@@ -591,7 +643,7 @@ bool CompoundMatrix::HasValidNumbersImpl() const
    {
       for( Index jcol = 0; jcol < NComps_Cols(); jcol++ )
       {
-         if( (owner_space_->Diagonal() && irow == jcol) || (!owner_space_->Diagonal() && ConstComp(irow, jcol)) )
+         if( HasBlock(irow, jcol) )
          {
             if( !ConstComp(irow, jcol)->HasValidNumbers() )
             {
@@ -727,18 +779,18 @@ void CompoundMatrix::PrintImpl(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sCompoundMatrix \"%s\" with %d row and %d columns components:\n", prefix.c_str(), name.c_str(), NComps_Rows(), NComps_Cols());
+                        "%sCompoundMatrix \"%s\" with %" IPOPT_INDEX_FORMAT " row and %" IPOPT_INDEX_FORMAT " columns components:\n", prefix.c_str(), name.c_str(), NComps_Rows(), NComps_Cols());
    for( Index irow = 0; irow < NComps_Rows(); irow++ )
    {
       for( Index jcol = 0; jcol < NComps_Cols(); jcol++ )
       {
          jnlst.PrintfIndented(level, category, indent,
-                              "%sComponent for row %d and column %d:\n", prefix.c_str(), irow, jcol);
+                              "%sComponent for row %" IPOPT_INDEX_FORMAT " and column %" IPOPT_INDEX_FORMAT ":\n", prefix.c_str(), irow, jcol);
          if( ConstComp(irow, jcol) )
          {
             DBG_ASSERT(name.size() < 200);
             char buffer[256];
-            Snprintf(buffer, 255, "%s[%2d][%2d]", name.c_str(), irow, jcol);
+            Snprintf(buffer, 255, "%s[%2" IPOPT_INDEX_FORMAT "][%2" IPOPT_INDEX_FORMAT "]", name.c_str(), irow, jcol);
             std::string term_name = buffer;
             ConstComp(irow, jcol)->Print(&jnlst, level, category, term_name, indent + 1, prefix);
          }
@@ -212,6 +212,25 @@ private:
       Index irow,
       Index jcol
    );
+
+   /** Whether the block (irow,jcol) takes part in matrix-vector products */
+   inline bool HasBlock(
+      Index irow,
+      Index jcol
+   ) const;
+
+   /** Number of threads for a matrix-vector product that processes
+    *  the blocks of y_comps in parallel.
+    *
+    *  This is 1 if a vector or matrix would be used for more than one
+    *  block of y_comps.
+    */
+   Index NumThreadsForBlockRows(
+      bool                                        trans,
+      Index                                       dim,
+      const std::vector<SmartPtr<const Vector> >& x_comps,
+      const std::vector<SmartPtr<Vector> >&       y_comps
+   ) const;
 };
 
 /** This is the matrix space for CompoundMatrix.  Before a CompoundMatrix
@@ -409,6 +428,14 @@ inline const Matrix* CompoundMatrix::ConstComp(
    return NULL;
 }
 
+inline bool CompoundMatrix::HasBlock(
+   Index irow,
+   Index jcol
+) const
+{
+   return (owner_space_->Diagonal() && irow == jcol) || (!owner_space_->Diagonal() && ConstComp(irow, jcol));
+}
+
 inline Matrix* CompoundMatrix::Comp(
    Index irow,
    Index jcol
@@ -10,6 +10,7 @@
 #include <cmath>
 #include <cstdio>
 #include <limits>
+#include <vector>
 
 namespace Ipopt
 {
@@ -90,9 +91,11 @@ void CompoundVector::CopyImpl(
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
 
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->Copy(*comp_x->GetComp(i));
+      Comp(i)->Copy(*comp_x->ConstComp(i));
    }
 }
 
@@ -102,6 +105,8 @@ void CompoundVector::ScalImpl(
 {
    DBG_START_METH("CompoundVector::ScalImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       DBG_ASSERT(Comp(i));
@@ -120,10 +125,12 @@ void CompoundVector::AxpyImpl(
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
 
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       DBG_ASSERT(Comp(i));
-      Comp(i)->Axpy(alpha, *comp_x->GetComp(i));
+      Comp(i)->Axpy(alpha, *comp_x->ConstComp(i));
    }
 }
 
@@ -136,11 +143,20 @@ Number CompoundVector::DotImpl(
    const CompoundVector* comp_x = static_cast<const CompoundVector*>(&x);
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
    DBG_ASSERT(NComps() == comp_x->NComps());
-   Number dot = 0.;
+   // the results of the components are summed up in a fixed order,
+   // so that the result does not depend on the number of threads
+   std::vector<Number> dots(NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       DBG_ASSERT(ConstComp(i));
-      dot += ConstComp(i)->Dot(*comp_x->GetComp(i));
+      dots[i] = ConstComp(i)->Dot(*comp_x->ConstComp(i));
+   }
+   Number dot = 0.;
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      dot += dots[i];
    }
    return dot;
 }
@@ -149,11 +165,17 @@ Number CompoundVector::Nrm2Impl() const
 {
    DBG_START_METH("CompoundVector::Nrm2Impl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   std::vector<Number> nrm2s(NComps());
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      nrm2s[i] = ConstComp(i)->Nrm2();
+   }
    Number sum = 0.;
    for( Index i = 0; i < NComps(); i++ )
    {
-      Number nrm2 = ConstComp(i)->Nrm2();
-      sum += nrm2 * nrm2;
+      sum += nrm2s[i] * nrm2s[i];
    }
    return sqrt(sum);
 }
@@ -162,10 +184,17 @@ Number CompoundVector::AsumImpl() const
 {
    DBG_START_METH("CompoundVector::AsumImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   std::vector<Number> asums(NComps());
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      asums[i] = ConstComp(i)->Asum();
+   }
    Number sum = 0.;
    for( Index i = 0; i < NComps(); i++ )
    {
-      sum += ConstComp(i)->Asum();
+      sum += asums[i];
    }
    return sum;
 }
@@ -175,9 +204,15 @@ Number CompoundVector::AmaxImpl() const
    DBG_START_METH("CompoundVector::AmaxImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
    Number max = 0.;
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      max = Ipopt::Max(max, ConstComp(i)->Amax());
+      Number amax = ConstComp(i)->Amax();
+#ifdef _OPENMP
+      #pragma omp critical(IpoptCompoundVectorReduce)
+#endif
+      max = Ipopt::Max(max, amax);
    }
    return max;
 }
@@ -188,6 +223,8 @@ void CompoundVector::SetImpl(
 {
    DBG_START_METH("CompoundVector::SetImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->Set(value);
@@ -203,9 +240,11 @@ void CompoundVector::ElementWiseDivideImpl(
    const CompoundVector* comp_x = static_cast<const CompoundVector*>(&x);
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->ElementWiseDivide(*comp_x->GetComp(i));
+      Comp(i)->ElementWiseDivide(*comp_x->ConstComp(i));
    }
 }
 
@@ -218,9 +257,11 @@ void CompoundVector::ElementWiseMultiplyImpl(
    const CompoundVector* comp_x = static_cast<const CompoundVector*>(&x);
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->ElementWiseMultiply(*comp_x->GetComp(i));
+      Comp(i)->ElementWiseMultiply(*comp_x->ConstComp(i));
    }
 }
 
@@ -233,9 +274,11 @@ void CompoundVector::ElementWiseMaxImpl(
    const CompoundVector* comp_x = static_cast<const CompoundVector*>(&x);
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->ElementWiseMax(*comp_x->GetComp(i));
+      Comp(i)->ElementWiseMax(*comp_x->ConstComp(i));
    }
 }
 
@@ -248,9 +291,11 @@ void CompoundVector::ElementWiseMinImpl(
    const CompoundVector* comp_x = static_cast<const CompoundVector*>(&x);
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&x));
    DBG_ASSERT(NComps() == comp_x->NComps());
+   const Index nthreads = NumThreadsForComps(comp_x);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->ElementWiseMin(*comp_x->GetComp(i));
+      Comp(i)->ElementWiseMin(*comp_x->ConstComp(i));
    }
 }
 
@@ -258,6 +303,8 @@ void CompoundVector::ElementWiseReciprocalImpl()
 {
    DBG_START_METH("CompoundVector::ElementWiseReciprocalImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->ElementWiseReciprocal();
@@ -268,6 +315,8 @@ void CompoundVector::ElementWiseAbsImpl()
 {
    DBG_START_METH("CompoundVector::ElementWiseAbsImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->ElementWiseAbs();
@@ -278,6 +327,8 @@ void CompoundVector::ElementWiseSqrtImpl()
 {
    DBG_START_METH("CompoundVector::ElementWiseSqrtImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->ElementWiseSqrt();
@@ -290,6 +341,8 @@ void CompoundVector::AddScalarImpl(
 {
    DBG_START_METH("CompoundVector::AddScalarImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->AddScalar(scalar);
@@ -302,11 +355,17 @@ Number CompoundVector::MaxImpl() const
    DBG_ASSERT(vectors_valid_);
    DBG_ASSERT(NComps() > 0 && Dim() > 0 && "There is no Max of a zero length vector (no reasonable default can be returned)");
    Number max = -std::numeric_limits<Number>::max();
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       if( ConstComp(i)->Dim() != 0 )
       {
-         max = Ipopt::Max(max, ConstComp(i)->Max());
+         Number max_i = ConstComp(i)->Max();
+#ifdef _OPENMP
+         #pragma omp critical(IpoptCompoundVectorReduce)
+#endif
+         max = Ipopt::Max(max, max_i);
       }
    }
    return max;
@@ -318,11 +377,17 @@ Number CompoundVector::MinImpl() const
    DBG_ASSERT(vectors_valid_);
    DBG_ASSERT(NComps() > 0 && Dim() > 0 && "There is no Min of a zero length vector (no reasonable default can be returned)");
    Number min = std::numeric_limits<Number>::max();
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       if( ConstComp(i)->Dim() != 0 )
       {
-         min = Ipopt::Min(min, ConstComp(i)->Min());
+         Number min_i = ConstComp(i)->Min();
+#ifdef _OPENMP
+         #pragma omp critical(IpoptCompoundVectorReduce)
+#endif
+         min = Ipopt::Min(min, min_i);
       }
    }
    return min;
@@ -332,10 +397,17 @@ Number CompoundVector::SumImpl() const
 {
    DBG_START_METH("CompoundVector::SumImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   std::vector<Number> sums(NComps());
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      sums[i] = ConstComp(i)->Sum();
+   }
    Number sum = 0.;
    for( Index i = 0; i < NComps(); i++ )
    {
-      sum += ConstComp(i)->Sum();
+      sum += sums[i];
    }
    return sum;
 }
@@ -344,10 +416,17 @@ Number CompoundVector::SumLogsImpl() const
 {
    DBG_START_METH("CompoundVector::SumLogsImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   std::vector<Number> sums(NComps());
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      sums[i] = ConstComp(i)->SumLogs();
+   }
    Number sum = 0.;
    for( Index i = 0; i < NComps(); i++ )
    {
-      sum += ConstComp(i)->SumLogs();
+      sum += sums[i];
    }
    return sum;
 }
@@ -356,6 +435,8 @@ void CompoundVector::ElementWiseSgnImpl()
 {
    DBG_START_METH("CompoundVector::ElementWiseSgnImpl", dbg_verbosity);
    DBG_ASSERT(vectors_valid_);
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
       Comp(i)->ElementWiseSgn();
@@ -379,9 +460,11 @@ void CompoundVector::AddTwoVectorsImpl(
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&v2));
    DBG_ASSERT(NComps() == comp_v2->NComps());
 
+   const Index nthreads = NumThreadsForComps(comp_v1, comp_v2);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->AddTwoVectors(a, *comp_v1->GetComp(i), b, *comp_v2->GetComp(i), c);
+      Comp(i)->AddTwoVectors(a, *comp_v1->ConstComp(i), b, *comp_v2->ConstComp(i), c);
    }
 }
 
@@ -396,9 +479,15 @@ Number CompoundVector::FracToBoundImpl(
    DBG_ASSERT(NComps() == comp_delta->NComps());
 
    Number alpha = 1.;
+   const Index nthreads = NumThreadsForComps(comp_delta);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      alpha = Ipopt::Min(alpha, ConstComp(i)->FracToBound(*comp_delta->GetComp(i), tau));
+      Number alpha_i = ConstComp(i)->FracToBound(*comp_delta->ConstComp(i), tau);
+#ifdef _OPENMP
+      #pragma omp critical(IpoptCompoundVectorReduce)
+#endif
+      alpha = Ipopt::Min(alpha, alpha_i);
    }
    return alpha;
 }
@@ -418,18 +507,50 @@ void CompoundVector::AddVectorQuotientImpl(
    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&s));
    DBG_ASSERT(NComps() == comp_s->NComps());
 
+   const Index nthreads = NumThreadsForComps(comp_z, comp_s);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      Comp(i)->AddVectorQuotient(a, *comp_z->GetComp(i), *comp_s->GetComp(i), c);
+      Comp(i)->AddVectorQuotient(a, *comp_z->ConstComp(i), *comp_s->ConstComp(i), c);
+   }
+}
+
+void CompoundVector::AddVectorProductImpl(
+   Number        a,
+   const Vector& z,
+   const Vector& s,
+   Number        c
+)
+{
+   DBG_ASSERT(vectors_valid_);
+   const CompoundVector* comp_z = static_cast<const CompoundVector*>(&z);
+   DBG_ASSERT(dynamic_cast<const CompoundVector*>(&z));
+   DBG_ASSERT(NComps() == comp_z->NComps());
+   const CompoundVector* comp_s = static_cast<const CompoundVector*>(&s);
+   DBG_ASSERT(dynamic_cast<const CompoundVector*>(&s));
+   DBG_ASSERT(NComps() == comp_s->NComps());
+
+   const Index nthreads = NumThreadsForComps(comp_z, comp_s);
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      Comp(i)->AddVectorProduct(a, *comp_z->ConstComp(i), *comp_s->ConstComp(i), c);
    }
 }
 
 bool CompoundVector::HasValidNumbersImpl() const
 {
    DBG_ASSERT(vectors_valid_);
+   std::vector<int> valid(NComps());
+   const Index nthreads = NumThreadsForComps();
+   IPOPT_OMP_PARFOR_DYNAMIC(nthreads)
    for( Index i = 0; i < NComps(); i++ )
    {
-      if( !ConstComp(i)->HasValidNumbers() )
+      valid[i] = ConstComp(i)->HasValidNumbers();
+   }
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      if( !valid[i] )
       {
          return false;
       }
@@ -450,29 +571,61 @@ void CompoundVector::PrintImpl(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sCompoundVector \"%s\" with %d components:\n", prefix.c_str(), name.c_str(), NComps());
+                        "%sCompoundVector \"%s\" with %" IPOPT_INDEX_FORMAT " components:\n", prefix.c_str(), name.c_str(), NComps());
    for( Index i = 0; i < NComps(); i++ )
    {
       jnlst.Printf(level, category,
                    "\n");
       jnlst.PrintfIndented(level, category, indent,
-                           "%sComponent %d:\n", prefix.c_str(), i + 1);
+                           "%sComponent %" IPOPT_INDEX_FORMAT ":\n", prefix.c_str(), i + 1);
       if( ConstComp(i) )
       {
          DBG_ASSERT(name.size() < 200);
          char buffer[256];
-         Snprintf(buffer, 255, "%s[%2d]", name.c_str(), i);
+         Snprintf(buffer, 255, "%s[%2" IPOPT_INDEX_FORMAT "]", name.c_str(), i);
          std::string term_name = buffer;
          ConstComp(i)->Print(&jnlst, level, category, term_name, indent + 1, prefix);
       }
       else
       {
          jnlst.PrintfIndented(level, category, indent,
-                              "%sComponent %d is not yet set!\n", prefix.c_str(), i + 1);
+                              "%sComponent %" IPOPT_INDEX_FORMAT " is not yet set!\n", prefix.c_str(), i + 1);
       }
    }
 }
 
+Index CompoundVector::NumThreadsForComps(
+   const CompoundVector* v1,
+   const CompoundVector* v2
+) const
+{
+   Index nthreads = IpNumThreadsForBlocks(NComps(), Dim());
+   if( nthreads == 1 )
+   {
+      return 1;
+   }
+
+   std::vector<std::pair<const void*, Index> > objects;
+   objects.reserve(3 * NComps());
+   for( Index i = 0; i < NComps(); i++ )
+   {
+      objects.push_back(std::make_pair((const void*) ConstComp(i), i));
+      if( v1 != NULL )
+      {
+         objects.push_back(std::make_pair((const void*) v1->ConstComp(i), i));
+      }
+      if( v2 != NULL )
+      {
+         objects.push_back(std::make_pair((const void*) v2->ConstComp(i), i));
+      }
+   }
+   if( !IpBlocksDisjoint(objects) )
+   {
+      return 1;
+   }
+   return nthreads;
+}
+
 bool CompoundVector::VectorsValid()
 {
    bool retVal = true;
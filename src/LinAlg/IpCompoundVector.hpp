@@ -204,6 +204,13 @@ protected:
       const Vector& s,
       Number        c
    );
+
+   void AddVectorProductImpl(
+      Number        a,
+      const Vector& z,
+      const Vector& s,
+      Number        c
+   );
    //@}
 
    /** Method for determining if all stored numbers are valid (i.e., no Inf or Nan). */
@@ -265,6 +272,19 @@ private:
    inline Vector* Comp(
       Index i
    );
+
+   /** Number of threads for processing the components of this vector
+    *  together with the corresponding components of v1 and v2 (if not NULL).
+    *
+    *  This is 1 if a vector is a component at more than one position,
+    *  since the operations on vectors update the caches and observers of
+    *  their arguments, and can therefore not be done concurrently on the
+    *  same vector.
+    */
+   Index NumThreadsForComps(
+      const CompoundVector* v1 = NULL,
+      const CompoundVector* v2 = NULL
+   ) const;
 };
 
 /** This vectors space is the vector space for CompoundVector.
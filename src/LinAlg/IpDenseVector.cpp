@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace Ipopt
 {
@@ -105,7 +106,15 @@ void DenseVector::CopyImpl(
    }
    else
    {
-      IpBlasDcopy(Dim(), dense_x->values_, 1, values_allocated(), 1);
+      Number* vals = values_allocated();
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index b = 0; b < nthreads; b++ )
+      {
+         Index start, end;
+         IpBlockRange(Dim(), nthreads, b, start, end);
+         IpBlasDcopy(end - start, dense_x->values_ + start, 1, vals + start, 1);
+      }
    }
    initialized_ = true;
 }
@@ -121,7 +130,14 @@ void DenseVector::ScalImpl(
    }
    else
    {
-      IpBlasDscal(Dim(), alpha, values_, 1);
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index b = 0; b < nthreads; b++ )
+      {
+         Index start, end;
+         IpBlockRange(Dim(), nthreads, b, start, end);
+         IpBlasDscal(end - start, alpha, values_ + start, 1);
+      }
    }
 }
 
@@ -136,6 +152,7 @@ void DenseVector::AxpyImpl(
 
    DBG_ASSERT(dense_x->initialized_);
    DBG_ASSERT(Dim() == dense_x->Dim());
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_x->homogeneous_ )
@@ -146,6 +163,7 @@ void DenseVector::AxpyImpl(
       {
          homogeneous_ = false;
          Number* vals = values_allocated();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             vals[i] = scalar_ + alpha * dense_x->values_[i];
@@ -158,12 +176,24 @@ void DenseVector::AxpyImpl(
       {
          if( dense_x->scalar_ != 0. )
          {
-            IpBlasDaxpy(Dim(), alpha, &dense_x->scalar_, 0, values_, 1);
+            IPOPT_OMP_PARFOR(nthreads)
+            for( Index b = 0; b < nthreads; b++ )
+            {
+               Index start, end;
+               IpBlockRange(Dim(), nthreads, b, start, end);
+               IpBlasDaxpy(end - start, alpha, &dense_x->scalar_, 0, values_ + start, 1);
+            }
          }
       }
       else
       {
-         IpBlasDaxpy(Dim(), alpha, dense_x->values_, 1, values_, 1);
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            Index start, end;
+            IpBlockRange(Dim(), nthreads, b, start, end);
+            IpBlasDaxpy(end - start, alpha, dense_x->values_ + start, 1, values_ + start, 1);
+         }
       }
    }
 }
@@ -192,7 +222,33 @@ Number DenseVector::DotImpl(
    }
    else
    {
-      if( dense_x->homogeneous_ )
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      if( nthreads > 1 )
+      {
+         // the partial sums are added up in a fixed order, so that the
+         // result does not depend on the scheduling of the threads
+         std::vector<Number> partial(nthreads);
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            Index start, end;
+            IpBlockRange(Dim(), nthreads, b, start, end);
+            if( dense_x->homogeneous_ )
+            {
+               partial[b] = IpBlasDdot(end - start, &dense_x->scalar_, 0, values_ + start, 1);
+            }
+            else
+            {
+               partial[b] = IpBlasDdot(end - start, dense_x->values_ + start, 1, values_ + start, 1);
+            }
+         }
+         retValue = 0.;
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            retValue += partial[b];
+         }
+      }
+      else if( dense_x->homogeneous_ )
       {
          retValue = IpBlasDdot(Dim(), &dense_x->scalar_, 0, values_, 1);
       }
@@ -276,6 +332,7 @@ void DenseVector::ElementWiseDivideImpl(
    DBG_ASSERT(dense_x->initialized_);
    const Number* values_x = dense_x->values_;
    DBG_ASSERT(Dim() == dense_x->Dim());
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_x->homogeneous_ )
@@ -286,6 +343,7 @@ void DenseVector::ElementWiseDivideImpl(
       {
          homogeneous_ = false;
          Number* vals = values_allocated();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             vals[i] = scalar_ / values_x[i];
@@ -296,6 +354,7 @@ void DenseVector::ElementWiseDivideImpl(
    {
       if( dense_x->homogeneous_ )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] /= dense_x->scalar_;
@@ -303,6 +362,7 @@ void DenseVector::ElementWiseDivideImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] /= values_x[i];
@@ -322,6 +382,7 @@ void DenseVector::ElementWiseMultiplyImpl(
    DBG_ASSERT(dense_x->initialized_);
    const Number* values_x = dense_x->values_;
    DBG_ASSERT(Dim() == dense_x->Dim());
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_x->homogeneous_ )
@@ -332,6 +393,7 @@ void DenseVector::ElementWiseMultiplyImpl(
       {
          homogeneous_ = false;
          Number* vals = values_allocated();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             vals[i] = scalar_ * values_x[i];
@@ -344,6 +406,7 @@ void DenseVector::ElementWiseMultiplyImpl(
       {
          if( dense_x->scalar_ != 1.0 )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] *= dense_x->scalar_;
@@ -352,6 +415,7 @@ void DenseVector::ElementWiseMultiplyImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] *= values_x[i];
@@ -371,6 +435,7 @@ void DenseVector::ElementWiseMaxImpl(
    DBG_ASSERT(dense_x->initialized_);
    const Number* values_x = dense_x->values_;
    DBG_ASSERT(Dim() == dense_x->Dim());
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_x->homogeneous_ )
@@ -381,6 +446,7 @@ void DenseVector::ElementWiseMaxImpl(
       {
          homogeneous_ = false;
          Number* vals = values_allocated();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             vals[i] = Ipopt::Max(scalar_, values_x[i]);
@@ -391,6 +457,7 @@ void DenseVector::ElementWiseMaxImpl(
    {
       if( dense_x->homogeneous_ )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = Ipopt::Max(values_[i], dense_x->scalar_);
@@ -398,6 +465,7 @@ void DenseVector::ElementWiseMaxImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = Ipopt::Max(values_[i], values_x[i]);
@@ -417,6 +485,7 @@ void DenseVector::ElementWiseMinImpl(
    DBG_ASSERT(dense_x->initialized_);
    const Number* values_x = dense_x->values_;
    DBG_ASSERT(Dim() == dense_x->Dim());
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_x->homogeneous_ )
@@ -427,6 +496,7 @@ void DenseVector::ElementWiseMinImpl(
       {
          homogeneous_ = false;
          Number* vals = values_allocated();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             vals[i] = Ipopt::Min(scalar_, values_x[i]);
@@ -437,6 +507,7 @@ void DenseVector::ElementWiseMinImpl(
    {
       if( dense_x->homogeneous_ )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = Ipopt::Min(values_[i], dense_x->scalar_);
@@ -444,6 +515,7 @@ void DenseVector::ElementWiseMinImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = Ipopt::Min(values_[i], values_x[i]);
@@ -455,12 +527,14 @@ void DenseVector::ElementWiseMinImpl(
 void DenseVector::ElementWiseReciprocalImpl()
 {
    DBG_ASSERT(initialized_);
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       scalar_ = 1.0 / scalar_;
    }
    else
    {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
       for( Index i = 0; i < Dim(); i++ )
       {
          values_[i] = 1.0 / values_[i];
@@ -471,12 +545,14 @@ void DenseVector::ElementWiseReciprocalImpl()
 void DenseVector::ElementWiseAbsImpl()
 {
    DBG_ASSERT(initialized_);
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       scalar_ = fabs(scalar_);
    }
    else
    {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
       for( Index i = 0; i < Dim(); i++ )
       {
          values_[i] = fabs(values_[i]);
@@ -487,12 +563,14 @@ void DenseVector::ElementWiseAbsImpl()
 void DenseVector::ElementWiseSqrtImpl()
 {
    DBG_ASSERT(initialized_);
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       scalar_ = sqrt(scalar_);
    }
    else
    {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
       for( Index i = 0; i < Dim(); i++ )
       {
          values_[i] = sqrt(values_[i]);
@@ -511,7 +589,14 @@ void DenseVector::AddScalarImpl(
    }
    else
    {
-      IpBlasDaxpy(Dim(), 1., &scalar, 0, values_, 1);
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      IPOPT_OMP_PARFOR(nthreads)
+      for( Index b = 0; b < nthreads; b++ )
+      {
+         Index start, end;
+         IpBlockRange(Dim(), nthreads, b, start, end);
+         IpBlasDaxpy(end - start, 1., &scalar, 0, values_ + start, 1);
+      }
    }
 }
 
@@ -531,6 +616,8 @@ Number DenseVector::MaxImpl() const
    else
    {
       max = values_[0];
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      IPOPT_OMP_PARFOR_MAX(nthreads, max)
       for( Index i = 1; i < Dim(); i++ )
       {
          max = Ipopt::Max(values_[i], max);
@@ -555,6 +642,8 @@ Number DenseVector::MinImpl() const
    else
    {
       min = values_[0];
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      IPOPT_OMP_PARFOR_MIN(nthreads, min)
       for( Index i = 1; i < Dim(); i++ )
       {
          min = Ipopt::Min(values_[i], min);
@@ -574,9 +663,35 @@ Number DenseVector::SumImpl() const
    else
    {
       sum = 0.;
-      for( Index i = 0; i < Dim(); i++ )
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      if( nthreads > 1 )
       {
-         sum += values_[i];
+         // the partial sums are added up in a fixed order, so that the
+         // result does not depend on the scheduling of the threads
+         std::vector<Number> partial(nthreads);
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            Index start, end;
+            IpBlockRange(Dim(), nthreads, b, start, end);
+            Number psum = 0.;
+            for( Index i = start; i < end; i++ )
+            {
+               psum += values_[i];
+            }
+            partial[b] = psum;
+         }
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            sum += partial[b];
+         }
+      }
+      else
+      {
+         for( Index i = 0; i < Dim(); i++ )
+         {
+            sum += values_[i];
+         }
       }
    }
    return sum;
@@ -593,9 +708,35 @@ Number DenseVector::SumLogsImpl() const
    else
    {
       sum = 0.0;
-      for( Index i = 0; i < Dim(); i++ )
+      const Index nthreads = IpNumThreadsForDim(Dim());
+      if( nthreads > 1 )
       {
-         sum += log(values_[i]);
+         // the partial sums are added up in a fixed order, so that the
+         // result does not depend on the scheduling of the threads
+         std::vector<Number> partial(nthreads);
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            Index start, end;
+            IpBlockRange(Dim(), nthreads, b, start, end);
+            Number psum = 0.;
+            for( Index i = start; i < end; i++ )
+            {
+               psum += log(values_[i]);
+            }
+            partial[b] = psum;
+         }
+         for( Index b = 0; b < nthreads; b++ )
+         {
+            sum += partial[b];
+         }
+      }
+      else
+      {
+         for( Index i = 0; i < Dim(); i++ )
+         {
+            sum += log(values_[i]);
+         }
       }
    }
    return sum;
@@ -604,6 +745,7 @@ Number DenseVector::SumLogsImpl() const
 void DenseVector::ElementWiseSgnImpl()
 {
    DBG_ASSERT(initialized_);
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( scalar_ > 0. )
@@ -621,6 +763,7 @@ void DenseVector::ElementWiseSgnImpl()
    }
    else
    {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
       for( Index i = 0; i < Dim(); i++ )
       {
          if( values_[i] > 0. )
@@ -710,6 +853,8 @@ void DenseVector::AddTwoVectorsImpl(
       return;
    }
 
+   const Index nthreads = IpNumThreadsForDim(Dim());
+
    // I guess I'm going over board here, but it might be best to
    // capture all cases for a, b, and c separately...
    if( c == 0 )
@@ -722,6 +867,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + values_v2[i];
@@ -729,6 +875,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] - values_v2[i];
@@ -736,6 +883,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + b * values_v2[i];
@@ -746,6 +894,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i];
@@ -753,6 +902,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + values_v2[i];
@@ -760,6 +910,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] - values_v2[i];
@@ -767,6 +918,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + b * values_v2[i];
@@ -782,13 +934,11 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
-            for( Index i = 0; i < Dim(); i++ )
-            {
-               IpBlasDcopy(Dim(), values_v2, 1, values_, 1);
-            }
+            IpBlasDcopy(Dim(), values_v2, 1, values_, 1);
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v2[i];
@@ -796,6 +946,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = b * values_v2[i];
@@ -806,6 +957,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i];
@@ -813,6 +965,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + values_v2[i];
@@ -820,6 +973,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] - values_v2[i];
@@ -827,6 +981,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + b * values_v2[i];
@@ -844,6 +999,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += values_v1[i] + values_v2[i];
@@ -851,6 +1007,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += values_v1[i] - values_v2[i];
@@ -858,6 +1015,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += values_v1[i] + b * values_v2[i];
@@ -872,6 +1030,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += -values_v1[i] + values_v2[i];
@@ -879,6 +1038,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += -values_v1[i] - values_v2[i];
@@ -886,6 +1046,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += -values_v1[i] + b * values_v2[i];
@@ -900,10 +1061,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
-            for( Index i = 0; i < Dim(); i++ )
-            {
-               IpBlasDaxpy(Dim(), 1., values_v2, 1, values_, 1);
-            }
+            IpBlasDaxpy(Dim(), 1., values_v2, 1, values_, 1);
          }
          else if( b == -1. )
          {
@@ -922,6 +1080,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += a * values_v1[i] + values_v2[i];
@@ -929,6 +1088,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += a * values_v1[i] - values_v2[i];
@@ -936,6 +1096,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] += a * values_v1[i] + b * values_v2[i];
@@ -949,6 +1110,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] - values_[i];
@@ -956,6 +1118,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + values_v2[i] - values_[i];
@@ -963,6 +1126,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] - values_v2[i] - values_[i];
@@ -970,6 +1134,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + b * values_v2[i] - values_[i];
@@ -980,6 +1145,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] - values_[i];
@@ -987,6 +1153,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + values_v2[i] - values_[i];
@@ -994,6 +1161,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] - values_v2[i] - values_[i];
@@ -1001,6 +1169,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + b * values_v2[i] - values_[i];
@@ -1015,6 +1184,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v2[i] - values_[i];
@@ -1022,6 +1192,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v2[i] - values_[i];
@@ -1029,6 +1200,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = b * values_v2[i] - values_[i];
@@ -1039,6 +1211,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] - values_[i];
@@ -1046,6 +1219,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + values_v2[i] - values_[i];
@@ -1053,6 +1227,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] - values_v2[i] - values_[i];
@@ -1060,6 +1235,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + b * values_v2[i] - values_[i];
@@ -1073,6 +1249,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + c * values_[i];
@@ -1080,6 +1257,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + values_v2[i] + c * values_[i];
@@ -1087,6 +1265,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] - values_v2[i] + c * values_[i];
@@ -1094,6 +1273,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v1[i] + b * values_v2[i] + c * values_[i];
@@ -1104,6 +1284,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + c * values_[i];
@@ -1111,6 +1292,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + values_v2[i] + c * values_[i];
@@ -1118,6 +1300,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] - values_v2[i] + c * values_[i];
@@ -1125,6 +1308,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v1[i] + b * values_v2[i] + c * values_[i];
@@ -1139,6 +1323,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = values_v2[i] + c * values_[i];
@@ -1146,6 +1331,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = -values_v2[i] + c * values_[i];
@@ -1153,6 +1339,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = b * values_v2[i] + c * values_[i];
@@ -1163,6 +1350,7 @@ void DenseVector::AddTwoVectorsImpl(
       {
          if( b == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + c * values_[i];
@@ -1170,6 +1358,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + values_v2[i] + c * values_[i];
@@ -1177,6 +1366,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else if( b == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] - values_v2[i] + c * values_[i];
@@ -1184,6 +1374,7 @@ void DenseVector::AddTwoVectorsImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = a * values_v1[i] + b * values_v2[i] + c * values_[i];
@@ -1207,6 +1398,7 @@ Number DenseVector::FracToBoundImpl(
    Number alpha = 1.;
    Number* values_x = values_;
    Number* values_delta = dense_delta->values_;
+   const Index nthreads = IpNumThreadsForDim(Dim());
    if( homogeneous_ )
    {
       if( dense_delta->homogeneous_ )
@@ -1218,6 +1410,7 @@ Number DenseVector::FracToBoundImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_MIN(nthreads, alpha)
          for( Index i = 0; i < Dim(); i++ )
          {
             if( values_delta[i] < 0. )
@@ -1233,6 +1426,7 @@ Number DenseVector::FracToBoundImpl(
       {
          if( dense_delta->scalar_ < 0. )
          {
+            IPOPT_OMP_PARFOR_MIN(nthreads, alpha)
             for( Index i = 0; i < Dim(); i++ )
             {
                alpha = Ipopt::Min(alpha, -tau / dense_delta->scalar_ * values_x[i]);
@@ -1241,6 +1435,7 @@ Number DenseVector::FracToBoundImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_MIN(nthreads, alpha)
          for( Index i = 0; i < Dim(); i++ )
          {
             if( values_delta[i] < 0. )
@@ -1302,12 +1497,14 @@ void DenseVector::AddVectorQuotientImpl(
 
    Number* values_z = dense_z->values_;
    Number* values_s = dense_s->values_;
+   const Index nthreads = IpNumThreadsForDim(Dim());
 
    if( c == 0. )
    {
       if( homogeneous_z )
       {
          // then s is not homogeneous
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = a * dense_z->scalar_ / values_s[i];
@@ -1316,6 +1513,7 @@ void DenseVector::AddVectorQuotientImpl(
       else if( homogeneous_s )
       {
          // then z is not homogeneous
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = values_z[i] * a / dense_s->scalar_;
@@ -1323,6 +1521,7 @@ void DenseVector::AddVectorQuotientImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = a * values_z[i] / values_s[i];
@@ -1335,6 +1534,7 @@ void DenseVector::AddVectorQuotientImpl(
       if( homogeneous_z )
       {
          // then s is not homogeneous
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = val + a * dense_z->scalar_ / values_s[i];
@@ -1343,6 +1543,7 @@ void DenseVector::AddVectorQuotientImpl(
       else if( homogeneous_s )
       {
          // then z is not homogeneous
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = val + values_z[i] * a / dense_s->scalar_;
@@ -1350,6 +1551,7 @@ void DenseVector::AddVectorQuotientImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < Dim(); i++ )
          {
             values_[i] = val + a * values_z[i] / values_s[i];
@@ -1363,6 +1565,7 @@ void DenseVector::AddVectorQuotientImpl(
       {
          if( homogeneous_s )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = c * values_[i] + a * dense_z->scalar_ / dense_s->scalar_;
@@ -1370,6 +1573,7 @@ void DenseVector::AddVectorQuotientImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = c * values_[i] + a * dense_z->scalar_ / values_s[i];
@@ -1380,6 +1584,7 @@ void DenseVector::AddVectorQuotientImpl(
       {
          if( homogeneous_s )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = c * values_[i] + values_z[i] * a / dense_s->scalar_;
@@ -1387,6 +1592,7 @@ void DenseVector::AddVectorQuotientImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < Dim(); i++ )
             {
                values_[i] = c * values_[i] + a * values_z[i] / values_s[i];
@@ -1399,6 +1605,83 @@ void DenseVector::AddVectorQuotientImpl(
    homogeneous_ = false;
 }
 
+void DenseVector::AddVectorProductImpl(
+   Number        a,
+   const Vector& z,
+   const Vector& s,
+   Number        c
+)
+{
+   DBG_ASSERT(Dim() == z.Dim());
+   DBG_ASSERT(Dim() == s.Dim());
+   const DenseVector* dense_z = static_cast<const DenseVector*>(&z);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&z));
+   const DenseVector* dense_s = static_cast<const DenseVector*>(&s);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&s));
+
+   DBG_ASSERT(dense_z->initialized_);
+   DBG_ASSERT(dense_s->initialized_);
+
+   DBG_ASSERT(c == 0. || initialized_);
+   bool homogeneous_z = dense_z->homogeneous_;
+   bool homogeneous_s = dense_s->homogeneous_;
+
+   if( (c == 0. || homogeneous_) && homogeneous_z && homogeneous_s )
+   {
+      if( c == 0. )
+      {
+         scalar_ = a * dense_z->scalar_ * dense_s->scalar_;
+      }
+      else
+      {
+         scalar_ = c * scalar_ + a * dense_z->scalar_ * dense_s->scalar_;
+      }
+      initialized_ = true;
+      homogeneous_ = true;
+      if( values_ )
+      {
+         owner_space_->FreeInternalStorage(values_);
+         values_ = NULL;
+      }
+      return;
+   }
+
+   // The fused loops below are only for the case that all vectors
+   // involved store their elements explicitly
+   if( homogeneous_z || homogeneous_s || (c != 0. && homogeneous_) )
+   {
+      Vector::AddVectorProductImpl(a, z, s, c);
+      return;
+   }
+
+   // Make sure we have memory to store a non-homogeneous vector
+   values_allocated();
+
+   const Number* values_z = dense_z->values_;
+   const Number* values_s = dense_s->values_;
+   const Index nthreads = IpNumThreadsForDim(Dim());
+
+   if( c == 0. )
+   {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
+      for( Index i = 0; i < Dim(); i++ )
+      {
+         values_[i] = a * values_z[i] * values_s[i];
+      }
+   }
+   else
+   {
+      IPOPT_OMP_PARFOR_SIMD(nthreads)
+      for( Index i = 0; i < Dim(); i++ )
+      {
+         values_[i] = c * values_[i] + a * values_z[i] * values_s[i];
+      }
+   }
+
+   initialized_ = true;
+   homogeneous_ = false;
+}
+
 void DenseVector::CopyToPos(
    Index         Pos,
    const Vector& x
@@ -1456,7 +1739,7 @@ void DenseVector::PrintImplOffset(
 ) const
 {
    jnlst.PrintfIndented(level, category, indent,
-                        "%sDenseVector \"%s\" with %d elements:\n", prefix.c_str(),
+                        "%sDenseVector \"%s\" with %" IPOPT_INDEX_FORMAT " elements:\n", prefix.c_str(),
                         name.c_str(), Dim());
 
    if( initialized_ )
@@ -1475,7 +1758,7 @@ void DenseVector::PrintImplOffset(
             for( Index i = 0; i < Dim(); i++ )
             {
                jnlst.PrintfIndented(level, category, indent,
-                                    "%s%s[%5d]{%s}=%23.16e\n", prefix.c_str(), name.c_str(),
+                                    "%s%s[%5" IPOPT_INDEX_FORMAT "]{%s}=%23.16e\n", prefix.c_str(), name.c_str(),
                                     i + offset, idx_names[i].c_str(), values_[i]);
             }
          }
@@ -1484,7 +1767,7 @@ void DenseVector::PrintImplOffset(
             for( Index i = 0; i < Dim(); i++ )
             {
                jnlst.PrintfIndented(level, category, indent,
-                                    "%s%s[%5d]=%23.16e\n", prefix.c_str(), name.c_str(),
+                                    "%s%s[%5" IPOPT_INDEX_FORMAT "]=%23.16e\n", prefix.c_str(), name.c_str(),
                                     i + offset, values_[i]);
             }
          }
@@ -1497,4 +1780,94 @@ void DenseVector::PrintImplOffset(
    }
 }
 
+DenseVectorSpace::~DenseVectorSpace()
+{
+   ReleasePooledStorage();
+}
+
+Number* DenseVectorSpace::AllocateInternalStorage() const
+{
+   if( Dim() == 0 )
+   {
+      return NULL;
+   }
+
+   Number* values = NULL;
+   // vectors of the same space may be created by different threads
+   // if the blocks of a compound vector are processed in parallel
+#ifdef _OPENMP
+   #pragma omp critical(IpoptDenseVectorPool)
+#endif
+   {
+      if( !free_storage_.empty() )
+      {
+         values = free_storage_.back();
+         free_storage_.pop_back();
+         pool_hits_++;
+      }
+      else
+      {
+         pool_misses_++;
+      }
+      num_used_storage_++;
+   }
+
+   if( values == NULL )
+   {
+      values = new Number[Dim()];
+   }
+   return values;
+}
+
+void DenseVectorSpace::FreeInternalStorage(
+   Number* values
+) const
+{
+   if( values == NULL )
+   {
+      return;
+   }
+
+   // keep the array only while the pool is smaller than the number of
+   // arrays in use, so that a peak in the number of vectors does not
+   // hold on to its memory until the space is destroyed
+   bool keep = false;
+#ifdef _OPENMP
+   #pragma omp critical(IpoptDenseVectorPool)
+#endif
+   {
+      num_used_storage_--;
+      if( pool_storage_ && (Index) free_storage_.size() < num_used_storage_ )
+      {
+         free_storage_.push_back(values);
+         keep = true;
+      }
+   }
+
+   if( !keep )
+   {
+      delete[] values;
+   }
+}
+
+void DenseVectorSpace::SetPoolStorage(
+   bool pool_storage
+)
+{
+   pool_storage_ = pool_storage;
+   if( !pool_storage_ )
+   {
+      ReleasePooledStorage();
+   }
+}
+
+void DenseVectorSpace::ReleasePooledStorage() const
+{
+   for( std::vector<Number*>::iterator it = free_storage_.begin(); it != free_storage_.end(); ++it )
+   {
+      delete[] *it;
+   }
+   free_storage_.clear();
+}
+
 } // namespace Ipopt
@@ -10,6 +10,7 @@
 #include "IpUtils.hpp"
 #include "IpVector.hpp"
 #include <map>
+#include <vector>
 
 namespace Ipopt
 {
@@ -230,6 +231,14 @@ protected:
       const Vector& s,
       Number        c
    );
+
+   /** Add the element-wise product of two vectors, y = a * z.*s + c * y. */
+   void AddVectorProductImpl(
+      Number        a,
+      const Vector& z,
+      const Vector& s,
+      Number        c
+   );
    //@}
 
    /** @name Output methods */
@@ -335,12 +344,15 @@ public:
    DenseVectorSpace(
       Index dim
    )
-      : VectorSpace(dim)
+      : VectorSpace(dim),
+        pool_storage_(true),
+        pool_hits_(0),
+        pool_misses_(0),
+        num_used_storage_(0)
    { }
 
    /** Destructor */
-   ~DenseVectorSpace()
-   { }
+   ~DenseVectorSpace();
    //@}
 
    /** Method for creating a new vector of this specific type. */
@@ -356,19 +368,61 @@ public:
 
    /**@name Methods called by DenseVector for memory management.
     *
-    * This could allow to have sophisticated memory management in the
-    * VectorSpace.
+    * Since all vectors of this space have the same dimension, arrays
+    * that are returned by FreeInternalStorage are kept in a free-list
+    * and handed out again by the next call to AllocateInternalStorage,
+    * instead of being deleted and reallocated.
+    * The free-list never holds more arrays than are currently in use,
+    * so that it shrinks again after a peak in the number of vectors.
     */
    //@{
    /** Allocate internal storage for the DenseVector */
-   inline Number* AllocateInternalStorage() const;
+   Number* AllocateInternalStorage() const;
 
    /** Deallocate internal storage for the DenseVector */
-   inline void FreeInternalStorage(
+   void FreeInternalStorage(
       Number* values
    ) const;
    //@}
 
+   /**@name Methods for controlling the storage pool */
+   //@{
+   /** Enable or disable the reuse of freed arrays (enabled by default).
+    *
+    *  Disabling the pool also releases all arrays that are currently in it.
+    */
+   void SetPoolStorage(
+      bool pool_storage
+   );
+
+   /** Whether freed arrays are kept for reuse */
+   bool PoolStorage() const
+   {
+      return pool_storage_;
+   }
+
+   /** Delete all arrays that are currently kept in the pool */
+   void ReleasePooledStorage() const;
+
+   /** Number of allocations that have been served from the pool */
+   Index PoolHits() const
+   {
+      return pool_hits_;
+   }
+
+   /** Number of allocations that required a new array */
+   Index PoolMisses() const
+   {
+      return pool_misses_;
+   }
+
+   /** Number of arrays that are currently kept in the pool */
+   Index PoolSize() const
+   {
+      return (Index) free_storage_.size();
+   }
+   //@}
+
    /**@name Methods for dealing with meta data on the vector
     */
    //@{
@@ -438,6 +492,24 @@ private:
    StringMetaDataMapType string_meta_data_;
    IntegerMetaDataMapType integer_meta_data_;
    NumericMetaDataMapType numeric_meta_data_;
+
+   /**@name Storage pool */
+   //@{
+   /** Whether freed arrays are kept for reuse */
+   bool pool_storage_;
+
+   /** Arrays of length Dim() that are currently not used by any vector */
+   mutable std::vector<Number*> free_storage_;
+
+   /** Number of allocations served from free_storage_ */
+   mutable Index pool_hits_;
+
+   /** Number of allocations that required a new array */
+   mutable Index pool_misses_;
+
+   /** Number of arrays that are currently used by vectors of this space */
+   mutable Index num_used_storage_;
+   //@}
 };
 
 // inline functions
@@ -474,26 +546,6 @@ inline Number* DenseVector::values_allocated()
    return values_;
 }
 
-inline Number* DenseVectorSpace::AllocateInternalStorage() const
-{
-   if( Dim() > 0 )
-   {
-      return new Number[Dim()];
-   }
-   else
-   {
-      return NULL;
-   }
-}
-
-inline
-void DenseVectorSpace::FreeInternalStorage(
-   Number* values
-) const
-{
-   delete[] values;
-}
-
 inline SmartPtr<DenseVector> DenseVector::MakeNewDenseVector() const
 {
    return owner_space_->MakeNewDenseVector();
@@ -196,7 +196,9 @@ void ExpansionMatrix::AddMSinvZImpl(
       return;
    }
 
+   // the expansion is injective, so the loops below can be run in parallel
    const Index* exp_pos = ExpandedPosIndices();
+   const Index nthreads = IpNumThreadsForDim(NCols());
    const Number* vals_S = dense_S->Values();
    Number* vals_X = dense_X->Values();
 
@@ -205,6 +207,7 @@ void ExpansionMatrix::AddMSinvZImpl(
       Number val = alpha * dense_Z->Scalar();
       if( val != 0. )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < NCols(); i++ )
          {
             vals_X[exp_pos[i]] += val / vals_S[i];
@@ -216,6 +219,7 @@ void ExpansionMatrix::AddMSinvZImpl(
       const Number* vals_Z = dense_Z->Values();
       if( alpha == 1. )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < NCols(); i++ )
          {
             vals_X[exp_pos[i]] += vals_Z[i] / vals_S[i];
@@ -223,6 +227,7 @@ void ExpansionMatrix::AddMSinvZImpl(
       }
       else if( alpha == -1. )
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < NCols(); i++ )
          {
             vals_X[exp_pos[i]] -= vals_Z[i] / vals_S[i];
@@ -230,6 +235,7 @@ void ExpansionMatrix::AddMSinvZImpl(
       }
       else
       {
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < NCols(); i++ )
          {
             vals_X[exp_pos[i]] += alpha * vals_Z[i] / vals_S[i];
@@ -280,7 +286,9 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
       return;
    }
 
+   // the expansion is injective, so the loops below can be run in parallel
    const Index* exp_pos = ExpandedPosIndices();
+   const Index nthreads = IpNumThreadsForDim(NCols());
    const Number* vals_S = dense_S->Values();
    const Number* vals_D = dense_D->Values();
    Number* vals_X = dense_X->Values();
@@ -293,6 +301,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          Number val = alpha * dense_Z->Scalar();
          if( val == 0. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                // ToDo could treat val == 0 extra
@@ -301,6 +310,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                // ToDo could treat val == 0 extra
@@ -313,6 +323,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          const Number* vals_Z = dense_Z->Values();
          if( alpha == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (scalar_R + vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -320,6 +331,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          }
          else if( alpha == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (scalar_R - vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -327,6 +339,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (scalar_R + alpha * vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -340,6 +353,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
       if( dense_Z->IsHomogeneous() )
       {
          Number val = alpha * dense_Z->Scalar();
+         IPOPT_OMP_PARFOR_SIMD(nthreads)
          for( Index i = 0; i < NCols(); i++ )
          {
             vals_X[i] = (vals_R[i] + val * vals_D[exp_pos[i]]) / vals_S[i];
@@ -350,6 +364,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          const Number* vals_Z = dense_Z->Values();
          if( alpha == 1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (vals_R[i] + vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -357,6 +372,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          }
          else if( alpha == -1. )
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (vals_R[i] - vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -364,6 +380,7 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
          }
          else
          {
+            IPOPT_OMP_PARFOR_SIMD(nthreads)
             for( Index i = 0; i < NCols(); i++ )
             {
                vals_X[i] = (vals_R[i] + alpha * vals_Z[i] * vals_D[exp_pos[i]]) / vals_S[i];
@@ -373,6 +390,165 @@ void ExpansionMatrix::SinvBlrmZMTdBrImpl(
    }
 }
 
+Number ExpansionMatrix::FracToBoundMTdImpl(
+   Number        alpha,
+   const Vector& S,
+   const Vector& D,
+   Number        tau
+) const
+{
+   DBG_ASSERT(NCols() == S.Dim());
+   DBG_ASSERT(NRows() == D.Dim());
+   DBG_ASSERT(tau >= 0.);
+
+   const DenseVector* dense_S = static_cast<const DenseVector*>(&S);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&S));
+   const DenseVector* dense_D = static_cast<const DenseVector*>(&D);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&D));
+
+   // the direction is gathered directly from D, so that no temporary
+   // vector for alpha*M^Td needs to be written and read again
+   if( dense_S->IsHomogeneous() || dense_D->IsHomogeneous() )
+   {
+      return Matrix::FracToBoundMTdImpl(alpha, S, D, tau);
+   }
+
+   const Index* exp_pos = ExpandedPosIndices();
+   const Number* vals_S = dense_S->Values();
+   const Number* vals_D = dense_D->Values();
+   const Index nthreads = IpNumThreadsForDim(NCols());
+
+   Number alpha_max = 1.;
+   IPOPT_OMP_PARFOR_MIN(nthreads, alpha_max)
+   for( Index i = 0; i < NCols(); i++ )
+   {
+      Number delta = alpha * vals_D[exp_pos[i]];
+      if( delta < 0. )
+      {
+         alpha_max = Ipopt::Min(alpha_max, -tau / delta * vals_S[i]);
+      }
+   }
+
+   DBG_ASSERT(alpha_max >= 0.);
+   return alpha_max;
+}
+
+void ExpansionMatrix::MSinvZLUImpl(
+   const Vector& S_L,
+   const Vector& Z_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& Z_U,
+   Vector&       X
+) const
+{
+   DBG_ASSERT(NCols() == S_L.Dim());
+   DBG_ASSERT(NCols() == Z_L.Dim());
+   DBG_ASSERT(M_U.NCols() == S_U.Dim());
+   DBG_ASSERT(M_U.NCols() == Z_U.Dim());
+   DBG_ASSERT(NRows() == M_U.NRows());
+   DBG_ASSERT(NRows() == X.Dim());
+
+   const ExpansionMatrix* exp_U = dynamic_cast<const ExpansionMatrix*>(&M_U);
+   const DenseVector* dense_S_L = static_cast<const DenseVector*>(&S_L);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&S_L));
+   const DenseVector* dense_Z_L = static_cast<const DenseVector*>(&Z_L);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&Z_L));
+   const DenseVector* dense_S_U = dynamic_cast<const DenseVector*>(&S_U);
+   const DenseVector* dense_Z_U = dynamic_cast<const DenseVector*>(&Z_U);
+   DenseVector* dense_X = static_cast<DenseVector*>(&X);
+   DBG_ASSERT(dynamic_cast<DenseVector*>(&X));
+
+   // the fused loop below needs the element values of all vectors
+   if( exp_U == NULL || dense_S_U == NULL || dense_Z_U == NULL || dense_S_L->IsHomogeneous()
+       || dense_Z_L->IsHomogeneous() || dense_S_U->IsHomogeneous() || dense_Z_U->IsHomogeneous() )
+   {
+      Matrix::MSinvZLUImpl(S_L, Z_L, M_U, S_U, Z_U, X);
+      return;
+   }
+
+   // run once over X and look up the lower and upper bound of each
+   // element, so that X is written only once and need not be zeroed first
+   const Index* comp_pos_L = CompressedPosIndices();
+   const Index* comp_pos_U = exp_U->CompressedPosIndices();
+   const Number* vals_S_L = dense_S_L->Values();
+   const Number* vals_Z_L = dense_Z_L->Values();
+   const Number* vals_S_U = dense_S_U->Values();
+   const Number* vals_Z_U = dense_Z_U->Values();
+   Number* vals_X = dense_X->Values();
+   const Index nthreads = IpNumThreadsForDim(NRows());
+
+   IPOPT_OMP_PARFOR_SIMD(nthreads)
+   for( Index j = 0; j < NRows(); j++ )
+   {
+      Number sigma = 0.;
+      if( comp_pos_L[j] >= 0 )
+      {
+         sigma += vals_Z_L[comp_pos_L[j]] / vals_S_L[comp_pos_L[j]];
+      }
+      if( comp_pos_U[j] >= 0 )
+      {
+         sigma += vals_Z_U[comp_pos_U[j]] / vals_S_U[comp_pos_U[j]];
+      }
+      vals_X[j] = sigma;
+   }
+}
+
+Number ExpansionMatrix::FracToBoundMTdLUImpl(
+   const Vector& S_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& D,
+   Number        tau
+) const
+{
+   DBG_ASSERT(NCols() == S_L.Dim());
+   DBG_ASSERT(M_U.NCols() == S_U.Dim());
+   DBG_ASSERT(NRows() == M_U.NRows());
+   DBG_ASSERT(NRows() == D.Dim());
+   DBG_ASSERT(tau >= 0.);
+
+   const ExpansionMatrix* exp_U = dynamic_cast<const ExpansionMatrix*>(&M_U);
+   const DenseVector* dense_S_L = static_cast<const DenseVector*>(&S_L);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&S_L));
+   const DenseVector* dense_S_U = dynamic_cast<const DenseVector*>(&S_U);
+   const DenseVector* dense_D = static_cast<const DenseVector*>(&D);
+   DBG_ASSERT(dynamic_cast<const DenseVector*>(&D));
+
+   if( exp_U == NULL || dense_S_U == NULL || dense_S_L->IsHomogeneous() || dense_S_U->IsHomogeneous()
+       || dense_D->IsHomogeneous() )
+   {
+      return Matrix::FracToBoundMTdLUImpl(S_L, M_U, S_U, D, tau);
+   }
+
+   // run once over D and check the lower bound of an element for a
+   // negative and the upper bound for a positive step
+   const Index* comp_pos_L = CompressedPosIndices();
+   const Index* comp_pos_U = exp_U->CompressedPosIndices();
+   const Number* vals_S_L = dense_S_L->Values();
+   const Number* vals_S_U = dense_S_U->Values();
+   const Number* vals_D = dense_D->Values();
+   const Index nthreads = IpNumThreadsForDim(NRows());
+
+   Number alpha_max = 1.;
+   IPOPT_OMP_PARFOR_MIN(nthreads, alpha_max)
+   for( Index j = 0; j < NRows(); j++ )
+   {
+      Number delta = vals_D[j];
+      if( delta < 0. && comp_pos_L[j] >= 0 )
+      {
+         alpha_max = Ipopt::Min(alpha_max, -tau / delta * vals_S_L[comp_pos_L[j]]);
+      }
+      else if( delta > 0. && comp_pos_U[j] >= 0 )
+      {
+         alpha_max = Ipopt::Min(alpha_max, tau / delta * vals_S_U[comp_pos_U[j]]);
+      }
+   }
+
+   DBG_ASSERT(alpha_max >= 0.);
+   return alpha_max;
+}
+
 void ExpansionMatrix::ComputeRowAMaxImpl(
    Vector& rows_norms,
    bool    /*init*/
@@ -421,14 +597,14 @@ void ExpansionMatrix::PrintImplOffset(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sExpansionMatrix \"%s\" with %d rows and %d columns:\n", prefix.c_str(), name.c_str(), NRows(), NCols());
+                        "%sExpansionMatrix \"%s\" with %" IPOPT_INDEX_FORMAT " rows and %" IPOPT_INDEX_FORMAT " columns:\n", prefix.c_str(), name.c_str(), NRows(), NCols());
 
    const Index* exp_pos = ExpandedPosIndices();
 
    for( Index i = 0; i < NCols(); i++ )
    {
       jnlst.PrintfIndented(level, category, indent,
-                           "%s%s[%5d,%5d]=%23.16e  (%d)\n", prefix.c_str(), name.c_str(), exp_pos[i] + row_offset, i + col_offset, 1., i);
+                           "%s%s[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "]=%23.16e  (%" IPOPT_INDEX_FORMAT ")\n", prefix.c_str(), name.c_str(), exp_pos[i] + row_offset, i + col_offset, 1., i);
    }
 }
 
@@ -93,6 +93,30 @@ protected:
       Vector&       X
    ) const;
 
+   virtual Number FracToBoundMTdImpl(
+      Number        alpha,
+      const Vector& S,
+      const Vector& D,
+      Number        tau
+   ) const;
+
+   virtual void MSinvZLUImpl(
+      const Vector& S_L,
+      const Vector& Z_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& Z_U,
+      Vector&       X
+   ) const;
+
+   virtual Number FracToBoundMTdLUImpl(
+      const Vector& S_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& D,
+      Number        tau
+   ) const;
+
    virtual void ComputeRowAMaxImpl(
       Vector& rows_norms,
       bool    init
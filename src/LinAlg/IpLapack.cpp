@@ -56,6 +56,60 @@ extern "C"
       int     uplo_len
    );
 
+   /** LAPACK Fortran subroutine DSYTRF. */
+   void IPOPT_LAPACK_FUNC(dsytrf, DSYTRF)(
+      char*        uplo,
+      ipfint*      n,
+      double*      A,
+      ipfint*      ldA,
+      ipfintarray* IPIV,
+      double*      WORK,
+      ipfint*      LWORK,
+      ipfint*      info,
+      int          uplo_len
+   );
+
+   /** LAPACK Fortran subroutine DSYTRS. */
+   void IPOPT_LAPACK_FUNC(dsytrs, DSYTRS)(
+      char*              uplo,
+      ipfint*            n,
+      ipfint*            nrhs,
+      const double*      A,
+      ipfint*            ldA,
+      const ipfintarray* IPIV,
+      double*            B,
+      ipfint*            ldB,
+      ipfint*            info,
+      int                uplo_len
+   );
+
+   /** LAPACK Fortran subroutine SSYTRF. */
+   void IPOPT_LAPACK_FUNC(ssytrf, SSYTRF)(
+      char*        uplo,
+      ipfint*      n,
+      float*       A,
+      ipfint*      ldA,
+      ipfintarray* IPIV,
+      float*       WORK,
+      ipfint*      LWORK,
+      ipfint*      info,
+      int          uplo_len
+   );
+
+   /** LAPACK Fortran subroutine SSYTRS. */
+   void IPOPT_LAPACK_FUNC(ssytrs, SSYTRS)(
+      char*              uplo,
+      ipfint*            n,
+      ipfint*            nrhs,
+      const float*       A,
+      ipfint*            ldA,
+      const ipfintarray* IPIV,
+      float*             B,
+      ipfint*            ldB,
+      ipfint*            info,
+      int                uplo_len
+   );
+
    /** LAPACK Fortran subroutine DGETRF. */
    void IPOPT_LAPACK_FUNC(dgetrf, DGETRF)(
       ipfint*      m,
@@ -196,6 +250,138 @@ void IpLapackDsyev(
 
 }
 
+void IpLapackDsytrf(
+   Index   ndim,
+   Number* a,
+   Index   lda,
+   Index*  ipiv,
+   Index&  info
+)
+{
+#ifdef IPOPT_HAS_LAPACK
+   ipfint N = ndim, LDA = lda, INFO;
+
+   char UPLO = 'L';
+
+   // First we find out how large LWORK should be
+   ipfint LWORK = -1;
+   double WORK_PROBE;
+   IPOPT_LAPACK_FUNC(dsytrf, DSYTRF)(&UPLO, &N, a, &LDA, ipiv,
+                                    &WORK_PROBE, &LWORK, &INFO, 1);
+   DBG_ASSERT(INFO == 0);
+
+   LWORK = (ipfint) WORK_PROBE;
+   DBG_ASSERT(LWORK > 0);
+
+   double* WORK = new double[LWORK];
+   IPOPT_LAPACK_FUNC(dsytrf, DSYTRF)(&UPLO, &N, a, &LDA, ipiv,
+                                    WORK, &LWORK, &INFO, 1);
+
+   DBG_ASSERT(INFO >= 0);
+   info = INFO;
+
+   delete [] WORK;
+#else
+
+   std::string msg =
+      "Ipopt has been compiled without LAPACK routine DSYTRF, but options are chosen that require this dependency.  Abort.";
+   THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+}
+
+void IpLapackDsytrs(
+   Index         ndim,
+   Index         nrhs,
+   const Number* a,
+   Index         lda,
+   const Index*  ipiv,
+   Number*       b,
+   Index         ldb
+)
+{
+#ifdef IPOPT_HAS_LAPACK
+   ipfint N = ndim, NRHS = nrhs, LDA = lda, LDB = ldb, INFO;
+   char uplo = 'L';
+
+   IPOPT_LAPACK_FUNC(dsytrs, DSYTRS)(&uplo, &N, &NRHS, a, &LDA, ipiv, b, &LDB,
+                                    &INFO, 1);
+   DBG_ASSERT(INFO == 0);
+#else
+
+   std::string msg =
+      "Ipopt has been compiled without LAPACK routine DSYTRS, but options are chosen that require this dependency.  Abort.";
+   THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+}
+
+void IpLapackSsytrf(
+   Index  ndim,
+   float* a,
+   Index  lda,
+   Index* ipiv,
+   Index& info
+)
+{
+#ifdef IPOPT_HAS_LAPACK
+   ipfint N = ndim, LDA = lda, INFO;
+
+   char UPLO = 'L';
+
+   // First we find out how large LWORK should be
+   ipfint LWORK = -1;
+   float WORK_PROBE;
+   IPOPT_LAPACK_FUNC(ssytrf, SSYTRF)(&UPLO, &N, a, &LDA, ipiv,
+                                    &WORK_PROBE, &LWORK, &INFO, 1);
+   DBG_ASSERT(INFO == 0);
+
+   LWORK = (ipfint) WORK_PROBE;
+   DBG_ASSERT(LWORK > 0);
+
+   float* WORK = new float[LWORK];
+   IPOPT_LAPACK_FUNC(ssytrf, SSYTRF)(&UPLO, &N, a, &LDA, ipiv,
+                                    WORK, &LWORK, &INFO, 1);
+
+   DBG_ASSERT(INFO >= 0);
+   info = INFO;
+
+   delete [] WORK;
+#else
+
+   std::string msg =
+      "Ipopt has been compiled without LAPACK routine SSYTRF, but options are chosen that require this dependency.  Abort.";
+   THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+}
+
+void IpLapackSsytrs(
+   Index        ndim,
+   Index        nrhs,
+   const float* a,
+   Index        lda,
+   const Index* ipiv,
+   float*       b,
+   Index        ldb
+)
+{
+#ifdef IPOPT_HAS_LAPACK
+   ipfint N = ndim, NRHS = nrhs, LDA = lda, LDB = ldb, INFO;
+   char uplo = 'L';
+
+   IPOPT_LAPACK_FUNC(ssytrs, SSYTRS)(&uplo, &N, &NRHS, a, &LDA, ipiv, b, &LDB,
+                                    &INFO, 1);
+   DBG_ASSERT(INFO == 0);
+#else
+
+   std::string msg =
+      "Ipopt has been compiled without LAPACK routine SSYTRS, but options are chosen that require this dependency.  Abort.";
+   THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+}
+
 void IpLapackDgetrf(
    Index   ndim,
    Number* a,
@@ -55,6 +55,64 @@ IPOPTLIB_EXPORT void IpLapackDsyev(
    Index&  info
 );
 
+/** Wrapper for LAPACK subroutine DSYTRF.
+ *
+ *  Compute the factorization \f$A = L D L^T\f$ of a symmetric indefinite
+ *  matrix by the blocked Bunch-Kaufman method, where D is block
+ *  diagonal with 1x1 and 2x2 blocks.  Only the lower triangle of a is
+ *  used; on return, it contains L and D as described in the LAPACK
+ *  documentation, and ipiv the interchanges and block structure of D.
+ *  info is the return value from the LAPACK routine.
+ */
+IPOPTLIB_EXPORT void IpLapackDsytrf(
+   Index   ndim,
+   Number* a,
+   Index   lda,
+   Index*  ipiv,
+   Index&  info
+);
+
+/** Wrapper for LAPACK subroutine DSYTRS.
+ *
+ *  Solving a linear system given a factorization computed by
+ *  IpLapackDsytrf.
+ */
+IPOPTLIB_EXPORT void IpLapackDsytrs(
+   Index         ndim,
+   Index         nrhs,
+   const Number* a,
+   Index         lda,
+   const Index*  ipiv,
+   Number*       b,
+   Index         ldb
+);
+
+/** Wrapper for LAPACK subroutine SSYTRF.
+ *
+ *  Same as IpLapackDsytrf, but in single precision.
+ */
+IPOPTLIB_EXPORT void IpLapackSsytrf(
+   Index  ndim,
+   float* a,
+   Index  lda,
+   Index* ipiv,
+   Index& info
+);
+
+/** Wrapper for LAPACK subroutine SSYTRS.
+ *
+ *  Same as IpLapackDsytrs, but in single precision.
+ */
+IPOPTLIB_EXPORT void IpLapackSsytrs(
+   Index        ndim,
+   Index        nrhs,
+   const float* a,
+   Index        lda,
+   const Index* ipiv,
+   float*       b,
+   Index        ldb
+);
+
 /** Wrapper for LAPACK subroutine DGETRF.
  *
  *  Compute LU factorization.
@@ -30,6 +30,39 @@ void Matrix::SinvBlrmZMTdBr(
    SinvBlrmZMTdBrImpl(alpha, S, R, Z, D, X);
 }
 
+Number Matrix::FracToBoundMTd(
+   Number        alpha,
+   const Vector& S,
+   const Vector& D,
+   Number        tau
+) const
+{
+   return FracToBoundMTdImpl(alpha, S, D, tau);
+}
+
+void Matrix::MSinvZLU(
+   const Vector& S_L,
+   const Vector& Z_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& Z_U,
+   Vector&       X
+) const
+{
+   MSinvZLUImpl(S_L, Z_L, M_U, S_U, Z_U, X);
+}
+
+Number Matrix::FracToBoundMTdLU(
+   const Vector& S_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& D,
+   Number        tau
+) const
+{
+   return FracToBoundMTdLUImpl(S_L, M_U, S_U, D, tau);
+}
+
 // Prototype for specialize methods (can and should be overloaded)
 void Matrix::AddMSinvZImpl(
    Number        alpha,
@@ -58,6 +91,53 @@ void Matrix::SinvBlrmZMTdBrImpl(
    X.ElementWiseDivide(S);
 }
 
+Number Matrix::FracToBoundMTdImpl(
+   Number        alpha,
+   const Vector& S,
+   const Vector& D,
+   Number        tau
+) const
+{
+   SmartPtr<Vector> tmp = S.MakeNew();
+   TransMultVector(alpha, D, 0., *tmp);
+   return S.FracToBound(*tmp, tau);
+}
+
+void Matrix::MSinvZLUImpl(
+   const Vector& S_L,
+   const Vector& Z_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& Z_U,
+   Vector&       X
+) const
+{
+   X.Set(0.);
+   AddMSinvZ(1., S_L, Z_L, X);
+   M_U.AddMSinvZ(1., S_U, Z_U, X);
+}
+
+Number Matrix::FracToBoundMTdLUImpl(
+   const Vector& S_L,
+   const Matrix& M_U,
+   const Vector& S_U,
+   const Vector& D,
+   Number        tau
+) const
+{
+   Number alpha_L = 1.;
+   Number alpha_U = 1.;
+   if( S_L.Dim() > 0 )
+   {
+      alpha_L = FracToBoundMTd(1., S_L, D, tau);
+   }
+   if( S_U.Dim() > 0 )
+   {
+      alpha_U = M_U.FracToBoundMTd(-1., S_U, D, tau);
+   }
+   return Min(alpha_L, alpha_U);
+}
+
 bool Matrix::HasValidNumbers() const
 {
    if( valid_cache_tag_ != GetTag() )
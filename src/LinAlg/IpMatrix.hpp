@@ -110,6 +110,47 @@ public:
       const Vector& D,
       Vector&       X
    ) const;
+
+   /** Fraction to the boundary parameter for S along alpha*M^Td.
+    *
+    *  Returns S.FracToBound(alpha*M^Td, tau), without forming the step alpha*M^Td explicitly.
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   Number FracToBoundMTd(
+      Number        alpha,
+      const Vector& S,
+      const Vector& D,
+      Number        tau
+   ) const;
+
+   /** X = Matrix S_L^{-1} Z_L + M_U S_U^{-1} Z_U.
+    *
+    *  This is the primal-dual Hessian term for a pair of lower and upper
+    *  bound matrices (this Matrix and M_U) that map into the same space.
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   void MSinvZLU(
+      const Vector& S_L,
+      const Vector& Z_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& Z_U,
+      Vector&       X
+   ) const;
+
+   /** Fraction to the boundary parameter for S_L along M^Td and S_U along -M_U^Td.
+    *
+    *  Returns the minimum of FracToBoundMTd(1., S_L, D, tau) and
+    *  M_U.FracToBoundMTd(-1., S_U, D, tau).
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   Number FracToBoundMTdLU(
+      const Vector& S_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& D,
+      Number        tau
+   ) const;
    //@}
 
    /** Method for determining if all stored numbers are valid (i.e., no Inf or Nan). */
@@ -242,6 +283,42 @@ protected:
       Vector&       X
    ) const;
 
+   /** Fraction to the boundary parameter for S along alpha*M^Td.
+    *
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   virtual Number FracToBoundMTdImpl(
+      Number        alpha,
+      const Vector& S,
+      const Vector& D,
+      Number        tau
+   ) const;
+
+   /** X = Matrix S_L^{-1} Z_L + M_U S_U^{-1} Z_U.
+    *
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   virtual void MSinvZLUImpl(
+      const Vector& S_L,
+      const Vector& Z_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& Z_U,
+      Vector&       X
+   ) const;
+
+   /** Fraction to the boundary parameter for S_L along M^Td and S_U along -M_U^Td.
+    *
+    *  Should be implemented efficiently for the ExpansionMatrix.
+    */
+   virtual Number FracToBoundMTdLUImpl(
+      const Vector& S_L,
+      const Matrix& M_U,
+      const Vector& S_U,
+      const Vector& D,
+      Number        tau
+   ) const;
+
    /** Method for determining if all stored numbers are valid (i.e., no Inf or Nan).
     *
     *  A default implementation always returning true
@@ -7,6 +7,7 @@
 #include "IpMultiVectorMatrix.hpp"
 #include "IpDenseVector.hpp"
 #include "IpDenseGenMatrix.hpp"
+#include "IpBlas.hpp"
 
 #include <cstdio>
 
@@ -48,6 +49,108 @@ void MultiVectorMatrix::SetVectorNonConst(
    ObjectChanged();
 }
 
+SmartPtr<MultiVectorMatrix> MultiVectorMatrix::MakeNewShiftedMultiVectorMatrix(
+   const Vector& v_new
+) const
+{
+   DBG_ASSERT(NCols() > 0);
+
+   SmartPtr<MultiVectorMatrix> new_V = MakeNewMultiVectorMatrix();
+   for( Index i = 0; i < NCols() - 1; i++ )
+   {
+      new_V->SetVector(i, *ConstVec(i + 1));
+   }
+   new_V->SetVector(NCols() - 1, v_new);
+
+   // hand over the contiguous copy of the column values, so that the
+   // columns that are kept do not need to be copied again
+   new_V->packed_values_.swap(packed_values_);
+   new_V->packed_tags_.swap(packed_tags_);
+   packed_values_.clear();
+   packed_tags_.clear();
+   packed_slots_.clear();
+
+   return new_V;
+}
+
+const Number* MultiVectorMatrix::PackedValues() const
+{
+   const Index nrows = NRows();
+   const Index ncols = NCols();
+   if( nrows == 0 || ncols == 0 )
+   {
+      return NULL;
+   }
+
+   for( Index i = 0; i < ncols; i++ )
+   {
+      if( dynamic_cast<const DenseVector*>(ConstVec(i)) == NULL )
+      {
+         return NULL;
+      }
+   }
+
+   if( packed_tags_.size() != (size_t) ncols || packed_values_.size() != (size_t) nrows * ncols )
+   {
+      packed_values_.resize((size_t) nrows * ncols);
+      packed_tags_.assign(ncols, 0);
+   }
+   packed_slots_.assign(ncols, -1);
+
+   // find the columns whose values are already stored in some slot
+   std::vector<bool> slot_used(ncols, false);
+   for( Index i = 0; i < ncols; i++ )
+   {
+      const Vector* vec = ConstVec(i);
+      for( Index k = 0; k < ncols; k++ )
+      {
+         if( !slot_used[k] && packed_tags_[k] != 0 && !vec->HasChanged(packed_tags_[k]) )
+         {
+            packed_slots_[i] = k;
+            slot_used[k] = true;
+            break;
+         }
+      }
+   }
+
+   // copy the remaining columns into the free slots
+   Index k = 0;
+   for( Index i = 0; i < ncols; i++ )
+   {
+      if( packed_slots_[i] >= 0 )
+      {
+         continue;
+      }
+      while( slot_used[k] )
+      {
+         k++;
+      }
+      const DenseVector* vec = static_cast<const DenseVector*>(ConstVec(i));
+      Number* col = &packed_values_[(size_t) k * nrows];
+      if( vec->IsHomogeneous() )
+      {
+         Number scalar = vec->Scalar();
+         IpBlasDcopy(nrows, &scalar, 0, col, 1);
+      }
+      else
+      {
+         IpBlasDcopy(nrows, vec->Values(), 1, col, 1);
+      }
+      packed_tags_[k] = vec->GetTag();
+      packed_slots_[i] = k;
+      slot_used[k] = true;
+   }
+
+   return &packed_values_[0];
+}
+
+void MultiVectorMatrix::ReleasePackedValues()
+{
+   std::vector<Number>().swap(packed_values_);
+   std::vector<TaggedObject::Tag>().swap(packed_tags_);
+   std::vector<Index>().swap(packed_slots_);
+}
+
 void MultiVectorMatrix::MultVectorImpl(
    Number        alpha,
    const Vector& x,
@@ -59,6 +162,27 @@ void MultiVectorMatrix::MultVectorImpl(
    DBG_ASSERT(NCols() == x.Dim());
    DBG_ASSERT(NRows() == y.Dim());
 
+   // If all columns are DenseVectors, this is a single matrix-vector product
+   DenseVector* dense_y = dynamic_cast<DenseVector*>(&y);
+   if( dense_y != NULL )
+   {
+      const Number* packed = PackedValues();
+      if( packed != NULL )
+      {
+         const DenseVector* dense_x = static_cast<const DenseVector*>(&x);
+         DBG_ASSERT(dynamic_cast<const DenseVector*>(&x));
+         const Number* xvals = dense_x->ExpandedValues();
+         std::vector<Number> xslots(NCols());
+         for( Index i = 0; i < NCols(); i++ )
+         {
+            xslots[packed_slots_[i]] = xvals[i];
+         }
+         // for beta = 0, DGEMV does not read the (possibly uninitialized) values of y
+         IpBlasDgemv(false, NRows(), NCols(), alpha, packed, NRows(), &xslots[0], 1, beta, dense_y->Values(), 1);
+         return;
+      }
+   }
+
    // Take care of the y part of the addition
    if( beta != 0.0 )
    {
@@ -107,9 +231,27 @@ void MultiVectorMatrix::TransMultVectorImpl(
    DenseVector* dense_y = static_cast<DenseVector*>(&y);
    DBG_ASSERT(dynamic_cast<DenseVector*>(&y));
 
+   Number* yvals = dense_y->Values();
+
+   // If all columns and x are DenseVectors, this is a single matrix-vector product
+   const DenseVector* dense_x = dynamic_cast<const DenseVector*>(&x);
+   if( dense_x != NULL )
+   {
+      const Number* packed = PackedValues();
+      if( packed != NULL )
+      {
+         std::vector<Number> yslots(NCols());
+         IpBlasDgemv(true, NRows(), NCols(), alpha, packed, NRows(), dense_x->ExpandedValues(), 1, 0., &yslots[0], 1);
+         for( Index i = 0; i < NCols(); i++ )
+         {
+            yvals[i] = yslots[packed_slots_[i]] + (beta != 0. ? beta * yvals[i] : 0.);
+         }
+         return;
+      }
+   }
+
    // Use the individual dot products to get the matrix (transpose)
    // vector product
-   Number* yvals = dense_y->Values();
    if( beta != 0.0 )
    {
       for( Index i = 0; i < NCols(); i++ )
@@ -142,6 +284,24 @@ void MultiVectorMatrix::LRMultVector(
    DBG_PRINT((1, "alpha = %e beta = %e\n", alpha, beta));
    DBG_PRINT_VECTOR(2, "x", x);
 
+   // If all columns, x, and y are DenseVectors, compute V^T*x and then
+   // y = beta*y + alpha*V*(V^T*x) with two matrix-vector products
+   // (the order of the columns in the contiguous copy does not matter here)
+   const DenseVector* dense_x = dynamic_cast<const DenseVector*>(&x);
+   DenseVector* dense_y = dynamic_cast<DenseVector*>(&y);
+   if( dense_x != NULL && dense_y != NULL )
+   {
+      const Number* packed = PackedValues();
+      if( packed != NULL )
+      {
+         std::vector<Number> vtx(NCols());
+         IpBlasDgemv(true, NRows(), NCols(), 1., packed, NRows(), dense_x->ExpandedValues(), 1, 0., &vtx[0], 1);
+         IpBlasDgemv(false, NRows(), NCols(), alpha, packed, NRows(), &vtx[0], 1, beta, dense_y->Values(), 1);
+         DBG_PRINT_VECTOR(2, "y", y);
+         return;
+      }
+   }
+
    if( beta != 0.0 )
    {
       y.Scal(beta);
@@ -168,6 +328,7 @@ void MultiVectorMatrix::FillWithNewVectors()
       non_const_vecs_[i] = vec_space->MakeNew();
       const_vecs_[i] = NULL;
    }
+   ReleasePackedValues();
    ObjectChanged();
 }
 
@@ -182,6 +343,7 @@ void MultiVectorMatrix::ScaleRows(
    {
       Vec(i)->ElementWiseMultiply(scal_vec);
    }
+   ReleasePackedValues();
    ObjectChanged();
 }
 
@@ -212,6 +374,7 @@ void MultiVectorMatrix::ScaleColumns(
          Vec(i)->Scal(values[i]);
       }
    }
+   ReleasePackedValues();
    ObjectChanged();
 }
 
@@ -233,6 +396,7 @@ void MultiVectorMatrix::AddOneMultiVectorMatrix(
    {
       Vec(i)->AddOneVector(a, *mv1.GetVector(i), c);
    }
+   ReleasePackedValues();
    ObjectChanged();
 }
 
@@ -252,14 +416,59 @@ void MultiVectorMatrix::AddRightMultMatrix(
       FillWithNewVectors();
    }
 
-   // ToDo: For now, we simply use MatrixVector multiplications, but
-   // we might be more efficient (at least in the non-parallel case)
-   // if we used Level 3 Blas
+   const DenseGenMatrix* dgm_C = static_cast<const DenseGenMatrix*>(&C);
+   DBG_ASSERT(dynamic_cast<const DenseGenMatrix*>(&C));
+
+   // If all columns of U are DenseVectors, compute U*C with a single
+   // matrix-matrix product and add its columns to the columns of this matrix
+   const Number* packed_U = U.PackedValues();
+   bool dense_columns = (packed_U != NULL);
+   for( Index i = 0; i < NCols() && dense_columns; i++ )
+   {
+      dense_columns = (dynamic_cast<DenseVector*>(Vec(i)) != NULL);
+   }
+   if( dense_columns )
+   {
+      const Index nrows = NRows();
+      // permute the rows of C according to the order of the columns of U in its contiguous copy
+      const Number* CValues = dgm_C->Values();
+      std::vector<Number> Cslots((size_t) C.NRows() * C.NCols());
+      for( Index j = 0; j < C.NCols(); j++ )
+      {
+         for( Index i = 0; i < C.NRows(); i++ )
+         {
+            Cslots[U.packed_slots_[i] + (size_t) j * C.NRows()] = CValues[i + (size_t) j * C.NRows()];
+         }
+      }
+      std::vector<Number> UC((size_t) nrows * NCols());
+      IpBlasDgemm(false, false, nrows, NCols(), U.NCols(), a, packed_U, nrows, &Cslots[0], C.NRows(), 0., &UC[0],
+                  nrows);
+      for( Index i = 0; i < NCols(); i++ )
+      {
+         DenseVector* dense_vec = static_cast<DenseVector*>(Vec(i));
+         if( b == 0. )
+         {
+            IpBlasDcopy(nrows, &UC[(size_t) i * nrows], 1, dense_vec->Values(), 1);
+         }
+         else
+         {
+            Number* vals = dense_vec->Values();
+            if( b != 1. )
+            {
+               IpBlasDscal(nrows, b, vals, 1);
+            }
+            IpBlasDaxpy(nrows, 1., &UC[(size_t) i * nrows], 1, vals, 1);
+         }
+      }
+      ReleasePackedValues();
+      ObjectChanged();
+      return;
+   }
+
+   // Otherwise, we simply use MatrixVector multiplications
    SmartPtr<const DenseVectorSpace> mydspace = new DenseVectorSpace(C.NRows());
    SmartPtr<DenseVector> mydvec = mydspace->MakeNewDenseVector();
 
-   const DenseGenMatrix* dgm_C = static_cast<const DenseGenMatrix*>(&C);
-   DBG_ASSERT(dynamic_cast<const DenseGenMatrix*>(&C));
    for( Index i = 0; i < NCols(); i++ )
    {
       const Number* CValues = dgm_C->Values();
@@ -270,6 +479,7 @@ void MultiVectorMatrix::AddRightMultMatrix(
       }
       U.MultVector(a, *mydvec, b, *Vec(i));
    }
+   ReleasePackedValues();
    ObjectChanged();
 }
 
@@ -313,7 +523,7 @@ void MultiVectorMatrix::PrintImpl(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sMultiVectorMatrix \"%s\" with %d columns:\n", prefix.c_str(), name.c_str(), NCols());
+                        "%sMultiVectorMatrix \"%s\" with %" IPOPT_INDEX_FORMAT " columns:\n", prefix.c_str(), name.c_str(), NCols());
 
    for( Index i = 0; i < NCols(); i++ )
    {
@@ -321,14 +531,14 @@ void MultiVectorMatrix::PrintImpl(
       {
          DBG_ASSERT(name.size() < 200);
          char buffer[256];
-         Snprintf(buffer, 255, "%s[%2d]", name.c_str(), i);
+         Snprintf(buffer, 255, "%s[%2" IPOPT_INDEX_FORMAT "]", name.c_str(), i);
          std::string term_name = buffer;
          ConstVec(i)->Print(&jnlst, level, category, term_name, indent + 1, prefix);
       }
       else
       {
          jnlst.PrintfIndented(level, category, indent,
-                              "%sVector in column %d is not yet set!\n", prefix.c_str(), i);
+                              "%sVector in column %" IPOPT_INDEX_FORMAT " is not yet set!\n", prefix.c_str(), i);
       }
    }
 }
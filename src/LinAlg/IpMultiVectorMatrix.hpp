@@ -114,6 +114,18 @@ public:
       Number                   b
    );
 
+   /** Create a new MultiVectorMatrix from same MatrixSpace whose
+    *  columns are the columns 1,...,NCols()-1 of this matrix, followed
+    *  by v_new.
+    *
+    *  This is used to maintain a sliding window of vectors. The internal
+    *  contiguous copy of the column values is handed over to the new
+    *  matrix, so that only the values of v_new need to be copied there.
+    */
+   SmartPtr<MultiVectorMatrix> MakeNewShiftedMultiVectorMatrix(
+      const Vector& v_new
+   ) const;
+
    /** Method for initializing all Vectors with new (uninitialized) Vectors. */
    void FillWithNewVectors();
 
@@ -207,6 +219,39 @@ private:
    /** space for storing the non-const Vector's */
    std::vector<SmartPtr<Vector> > non_const_vecs_;
 
+   /**@name Contiguous copy of the column values, see PackedValues
+    *
+    *  The values are stored in slots of NRows() entries each. A slot is
+    *  reused as long as the Vector that has been copied into it has not
+    *  changed, even if it moved to another column.
+    *
+    *  Once a product with this matrix has been computed, the copy takes
+    *  as much memory as the columns themselves, e.g., the L-BFGS history
+    *  is then stored twice. The copy is released by the methods that
+    *  change all columns, since none of its slots could be reused.
+    */
+   //@{
+   mutable std::vector<Number> packed_values_;
+   /** Tags of the Vectors at the time they have been copied into a slot, or 0 */
+   mutable std::vector<TaggedObject::Tag> packed_tags_;
+   /** Slot for each column, valid after a call to PackedValues */
+   mutable std::vector<Index> packed_slots_;
+   //@}
+
+   /** Values of all columns, stored contiguously in column-major order.
+    *
+    *  This is available if all columns are DenseVectors. The values are
+    *  copied into an internal array that is updated only for columns
+    *  that have changed since the previous call, so that products with
+    *  this matrix can use BLAS level 2 and 3 routines. The order of the
+    *  columns in this array is given by packed_slots_.
+    *  Returns NULL if a column is not a DenseVector.
+    */
+   const Number* PackedValues() const;
+
+   /** Release the memory of the contiguous copy of the column values */
+   void ReleasePackedValues();
+
    /** Method for accessing the internal Vectors internally */
    //@{
    inline const Vector* ConstVec(
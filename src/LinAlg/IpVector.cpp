@@ -230,6 +230,30 @@ void Vector::AddVectorQuotientImpl(
    }
 }
 
+void Vector::AddVectorProductImpl(
+   Number        a,
+   const Vector& z,
+   const Vector& s,
+   Number        c
+)
+{
+   DBG_ASSERT(Dim() == z.Dim());
+   DBG_ASSERT(Dim() == s.Dim());
+
+   if( c == 0. )
+   {
+      AddOneVector(a, z, 0.);
+      ElementWiseMultiply(s);
+   }
+   else
+   {
+      SmartPtr<Vector> tmp = MakeNew();
+      tmp->Copy(z);
+      tmp->ElementWiseMultiply(s);
+      AddOneVector(a, *tmp, c);
+   }
+}
+
 bool Vector::HasValidNumbersImpl() const
 {
    Number sum = Asum();
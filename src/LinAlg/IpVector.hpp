@@ -211,6 +211,14 @@ public:
       const Vector& s,
       Number        c
    );
+
+   /** Add the element-wise product of two vectors, y = a * z.*s + c * y. */
+   inline void AddVectorProduct(
+      Number        a,
+      const Vector& z,
+      const Vector& s,
+      Number        c
+   );
    //@}
 
    /** Method for determining if all stored numbers are valid (i.e., no Inf or Nan). */
@@ -366,6 +374,14 @@ protected:
       Number        c
    );
 
+   /** Add the element-wise product of two vectors */
+   virtual void AddVectorProductImpl(
+      Number        a,
+      const Vector& z,
+      const Vector& s,
+      Number        c
+   );
+
    /** Method for determining if all stored numbers are valid (i.e., no Inf or Nan).
     *
     *  A default implementation using Asum is provided. */
@@ -823,6 +839,17 @@ inline void Vector::AddVectorQuotient(
    ObjectChanged();
 }
 
+inline void Vector::AddVectorProduct(
+   Number        a,
+   const Vector& z,
+   const Vector& s,
+   Number        c
+)
+{
+   AddVectorProductImpl(a, z, s, c);
+   ObjectChanged();
+}
+
 inline bool Vector::HasValidNumbers() const
 {
    if( valid_cache_tag_ != GetTag() )
@@ -7,6 +7,7 @@
 #include "IpGenTMatrix.hpp"
 #include "IpDenseVector.hpp"
 #include "IpBlas.hpp"
+#include "IpTripletHelper.hpp"
 
 #include <cmath>
 
@@ -73,31 +74,42 @@ void GenTMatrix::MultVectorImpl(
 
    if( dense_x && dense_y )
    {
-      const Index* irows = Irows();
-      const Index* jcols = Jcols();
+      // gather the products row by row (column by column for the transpose),
+      // so that every entry of y is written by only one thread
+      const Index* start;
+      const Index* pos;
+      const Index* idx;
+      owner_space_->GetRowCompressed(start, pos, idx);
       const Number* val = values_;
       Number* yvals = dense_y->Values();
-      yvals--;
+      const Index nthreads = IpNumThreadsForDim(Nonzeros());
+
       if( dense_x->IsHomogeneous() )
       {
          Number as = alpha * dense_x->Scalar();
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < NRows(); i++ )
          {
-            yvals[*irows] += as * (*val);
-            val++;
-            irows++;
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
+            {
+               sum += val[pos[k]];
+            }
+            yvals[i] += as * sum;
          }
       }
       else
       {
          const Number* xvals = dense_x->Values();
-         xvals--;
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < NRows(); i++ )
          {
-            yvals[*irows] += alpha * (*val) * xvals[*jcols];
-            val++;
-            irows++;
-            jcols++;
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
+            {
+               sum += val[pos[k]] * xvals[idx[k]];
+            }
+            yvals[i] += alpha * sum;
          }
       }
    }
@@ -133,32 +145,42 @@ void GenTMatrix::TransMultVectorImpl(
 
    if( dense_x && dense_y )
    {
-      const Index* irows = Irows();
-      const Index* jcols = Jcols();
+      // gather the products row by row (column by column for the transpose),
+      // so that every entry of y is written by only one thread
+      const Index* start;
+      const Index* pos;
+      const Index* idx;
+      owner_space_->GetColCompressed(start, pos, idx);
       const Number* val = values_;
       Number* yvals = dense_y->Values();
-      yvals--;
+      const Index nthreads = IpNumThreadsForDim(Nonzeros());
 
       if( dense_x->IsHomogeneous() )
       {
          Number as = alpha * dense_x->Scalar();
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < NCols(); i++ )
          {
-            yvals[*jcols] += as * (*val);
-            val++;
-            jcols++;
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
+            {
+               sum += val[pos[k]];
+            }
+            yvals[i] += as * sum;
          }
       }
       else
       {
          const Number* xvals = dense_x->Values();
-         xvals--;
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < NCols(); i++ )
          {
-            yvals[*jcols] += alpha * (*val) * xvals[*irows];
-            val++;
-            irows++;
-            jcols++;
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
+            {
+               sum += val[pos[k]] * xvals[idx[k]];
+            }
+            yvals[i] += alpha * sum;
          }
       }
    }
@@ -226,14 +248,14 @@ void GenTMatrix::PrintImplOffset(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sGenTMatrix \"%s\" of dimension %d by %d with %d nonzero elements:\n", prefix.c_str(), name.c_str(), NRows(),
+                        "%sGenTMatrix \"%s\" of dimension %" IPOPT_INDEX_FORMAT " by %" IPOPT_INDEX_FORMAT " with %" IPOPT_INDEX_FORMAT " nonzero elements:\n", prefix.c_str(), name.c_str(), NRows(),
                         NCols(), Nonzeros());
    if( initialized_ )
    {
       for( Index i = 0; i < Nonzeros(); i++ )
       {
          jnlst.PrintfIndented(level, category, indent,
-                              "%s%s[%5d,%5d]=%23.16e  (%d)\n", prefix.c_str(), name.c_str(), Irows()[i] + offset, Jcols()[i], values_[i], i);
+                              "%s%s[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "]=%23.16e  (%" IPOPT_INDEX_FORMAT ")\n", prefix.c_str(), name.c_str(), Irows()[i] + offset, Jcols()[i], values_[i], i);
       }
    }
    else
@@ -276,4 +298,41 @@ void GenTMatrixSpace::FreeInternalStorage(
    delete[] values;
 }
 
+void GenTMatrixSpace::GetRowCompressed(
+   const Index*& start,
+   const Index*& pos,
+   const Index*& minor_idx
+) const
+{
+   // matrices of this space may be multiplied by different threads
+#ifdef _OPENMP
+   #pragma omp critical(IpoptTMatrixCompress)
+#endif
+   if( row_start_.empty() )
+   {
+      TripletHelper::CompressTriplets(NRows(), Nonzeros(), iRows_, jCols_, false, row_start_, row_pos_, row_cols_);
+   }
+   start = &row_start_[0];
+   pos = row_pos_.empty() ? NULL : &row_pos_[0];
+   minor_idx = row_cols_.empty() ? NULL : &row_cols_[0];
+}
+
+void GenTMatrixSpace::GetColCompressed(
+   const Index*& start,
+   const Index*& pos,
+   const Index*& minor_idx
+) const
+{
+#ifdef _OPENMP
+   #pragma omp critical(IpoptTMatrixCompress)
+#endif
+   if( col_start_.empty() )
+   {
+      TripletHelper::CompressTriplets(NCols(), Nonzeros(), jCols_, iRows_, false, col_start_, col_pos_, col_rows_);
+   }
+   start = &col_start_[0];
+   pos = col_pos_.empty() ? NULL : &col_pos_[0];
+   minor_idx = col_rows_.empty() ? NULL : &col_rows_[0];
+}
+
 } // namespace Ipopt
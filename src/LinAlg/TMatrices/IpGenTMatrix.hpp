@@ -10,6 +10,8 @@
 #include "IpUtils.hpp"
 #include "IpMatrix.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 
@@ -267,6 +269,37 @@ private:
       Number* values
    ) const;
 
+   /** @name Compressed views of the sparsity structure.
+    *
+    *  These are computed on first use and allow the GenTMatrix to
+    *  compute matrix-vector products row by row (or column by column
+    *  for the transpose), so that the rows can be handled by
+    *  different threads.  See TripletHelper::CompressTriplets for the
+    *  meaning of start, pos, and minor_idx.
+    */
+   //@{
+   /** Row-compressed view; minor_idx holds the columns (counting from 0) */
+   void GetRowCompressed(
+      const Index*& start,
+      const Index*& pos,
+      const Index*& minor_idx
+   ) const;
+
+   /** Column-compressed view; minor_idx holds the rows (counting from 0) */
+   void GetColCompressed(
+      const Index*& start,
+      const Index*& pos,
+      const Index*& minor_idx
+   ) const;
+
+   mutable std::vector<Index> row_start_;
+   mutable std::vector<Index> row_pos_;
+   mutable std::vector<Index> row_cols_;
+   mutable std::vector<Index> col_start_;
+   mutable std::vector<Index> col_pos_;
+   mutable std::vector<Index> col_rows_;
+   //@}
+
    friend class GenTMatrix;
 };
 
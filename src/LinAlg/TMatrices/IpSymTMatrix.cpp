@@ -7,6 +7,7 @@
 #include "IpSymTMatrix.hpp"
 #include "IpDenseVector.hpp"
 #include "IpBlas.hpp"
+#include "IpTripletHelper.hpp"
 
 #include <cmath>
 
@@ -73,41 +74,42 @@ void SymTMatrix::MultVectorImpl(
 
    if( dense_x && dense_y )
    {
-      const Index* irn = Irows();
-      const Index* jcn = Jcols();
+      // gather the products row by row, so that every entry of y is
+      // written by only one thread
+      const Index* start;
+      const Index* pos;
+      const Index* idx;
+      owner_space_->GetRowCompressed(start, pos, idx);
       const Number* val = values_;
       Number* yvals = dense_y->Values();
+      const Index nthreads = IpNumThreadsForDim(Nonzeros());
 
       if( dense_x->IsHomogeneous() )
       {
          Number as = alpha * dense_x->Scalar();
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < Dim(); i++ )
          {
-            yvals[*irn - 1] += as * (*val);
-            if( *irn != *jcn )
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
             {
-               // this is not a diagonal element
-               yvals[*jcn - 1] += as * (*val);
+               sum += val[pos[k]];
             }
-            val++;
-            irn++;
-            jcn++;
+            yvals[i] += as * sum;
          }
       }
       else
       {
          const Number* xvals = dense_x->Values();
-         for( Index i = 0; i < Nonzeros(); i++ )
+         IPOPT_OMP_PARFOR(nthreads)
+         for( Index i = 0; i < Dim(); i++ )
          {
-            yvals[*irn - 1] += alpha * (*val) * xvals[*jcn - 1];
-            if( *irn != *jcn )
+            Number sum = 0.;
+            for( Index k = start[i]; k < start[i + 1]; k++ )
             {
-               // this is not a diagonal element
-               yvals[*jcn - 1] += alpha * (*val) * xvals[*irn - 1];
+               sum += val[pos[k]] * xvals[idx[k]];
             }
-            val++;
-            irn++;
-            jcn++;
+            yvals[i] += alpha * sum;
          }
       }
    }
@@ -203,13 +205,13 @@ void SymTMatrix::PrintImpl(
    jnlst.Printf(level, category,
                 "\n");
    jnlst.PrintfIndented(level, category, indent,
-                        "%sSymTMatrix \"%s\" of dimension %d with %d nonzero elements:\n", prefix.c_str(), name.c_str(), Dim(), Nonzeros());
+                        "%sSymTMatrix \"%s\" of dimension %" IPOPT_INDEX_FORMAT " with %" IPOPT_INDEX_FORMAT " nonzero elements:\n", prefix.c_str(), name.c_str(), Dim(), Nonzeros());
    if( initialized_ )
    {
       for( Index i = 0; i < Nonzeros(); i++ )
       {
          jnlst.PrintfIndented(level, category, indent,
-                              "%s%s[%5d,%5d]=%23.16e  (%d)\n", prefix.c_str(), name.c_str(), Irows()[i], Jcols()[i], values_[i], i);
+                              "%s%s[%5" IPOPT_INDEX_FORMAT ",%5" IPOPT_INDEX_FORMAT "]=%23.16e  (%" IPOPT_INDEX_FORMAT ")\n", prefix.c_str(), name.c_str(), Irows()[i], Jcols()[i], values_[i], i);
       }
    }
    else
@@ -256,4 +258,23 @@ void SymTMatrixSpace::FreeInternalStorage(
    delete[] values;
 }
 
+void SymTMatrixSpace::GetRowCompressed(
+   const Index*& start,
+   const Index*& pos,
+   const Index*& minor_idx
+) const
+{
+   // matrices of this space may be multiplied by different threads
+#ifdef _OPENMP
+   #pragma omp critical(IpoptTMatrixCompress)
+#endif
+   if( row_start_.empty() )
+   {
+      TripletHelper::CompressTriplets(Dim(), Nonzeros(), iRows_, jCols_, true, row_start_, row_pos_, row_cols_);
+   }
+   start = &row_start_[0];
+   pos = row_pos_.empty() ? NULL : &row_pos_[0];
+   minor_idx = row_cols_.empty() ? NULL : &row_cols_[0];
+}
+
 } // namespace Ipopt
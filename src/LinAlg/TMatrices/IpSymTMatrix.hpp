@@ -10,6 +10,8 @@
 #include "IpUtils.hpp"
 #include "IpSymMatrix.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 
@@ -248,10 +250,31 @@ private:
    ) const;
    //@}
 
+   /** Row-compressed view of the full symmetric matrix.
+    *
+    *  This is computed on first use and allows the SymTMatrix to
+    *  compute matrix-vector products row by row, so that the rows can
+    *  be handled by different threads.  Off-diagonal elements appear
+    *  in both of their rows.  See TripletHelper::CompressTriplets for
+    *  the meaning of start, pos, and minor_idx.
+    */
+   void GetRowCompressed(
+      const Index*& start,
+      const Index*& pos,
+      const Index*& minor_idx
+   ) const;
+
    const Index nonZeros_;
    Index* iRows_;
    Index* jCols_;
 
+   /**@name Row-compressed view of the sparsity structure */
+   //@{
+   mutable std::vector<Index> row_start_;
+   mutable std::vector<Index> row_pos_;
+   mutable std::vector<Index> row_cols_;
+   //@}
+
    friend class SymTMatrix;
 };
 
@@ -1178,5 +1178,49 @@ void TripletHelper::PutValuesInVector(
    THROW_EXCEPTION(UNKNOWN_VECTOR_TYPE, "Unknown vector type passed to TripletHelper::PutValuesInVector");
 }
 
+void TripletHelper::CompressTriplets(
+   Index               dim,
+   Index               n_entries,
+   const Index*        major,
+   const Index*        minor,
+   bool                symmetric,
+   std::vector<Index>& start,
+   std::vector<Index>& pos,
+   std::vector<Index>& minor_idx
+)
+{
+   // count the entries for each major index
+   start.assign(dim + 1, 0);
+   for( Index p = 0; p < n_entries; p++ )
+   {
+      start[major[p]]++;
+      if( symmetric && major[p] != minor[p] )
+      {
+         start[minor[p]]++;
+      }
+   }
+   for( Index r = 0; r < dim; r++ )
+   {
+      start[r + 1] += start[r];
+   }
+
+   // distribute the entries; next[r] is the next free slot for major index r
+   std::vector<Index> next(start.begin(), start.end() - 1);
+   pos.resize(start[dim]);
+   minor_idx.resize(start[dim]);
+   for( Index p = 0; p < n_entries; p++ )
+   {
+      Index k = next[major[p] - 1]++;
+      pos[k] = p;
+      minor_idx[k] = minor[p] - 1;
+      if( symmetric && major[p] != minor[p] )
+      {
+         k = next[minor[p] - 1]++;
+         pos[k] = p;
+         minor_idx[k] = major[p] - 1;
+      }
+   }
+}
+
 } // namespace Ipopt
 
@@ -10,6 +10,8 @@
 #include "IpTypes.hpp"
 #include "IpException.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
 
@@ -75,6 +77,27 @@ public:
       const double* values,
       Vector&       vector
    );
+
+   /** compute a compressed (row- or column-wise) view of a triplet structure
+    *
+    *  For each major index r = 0..dim-1, the entries start[r] to
+    *  start[r+1]-1 of pos and minor_idx give the positions of the
+    *  triplet entries with major[p] == r+1 and their (0-based) minor
+    *  index.  Entries of the same major index keep the order of the
+    *  triplets.  If symmetric is true, every off-diagonal entry is
+    *  also listed under its minor index, so that the view describes
+    *  the full symmetric matrix.
+    */
+   static void CompressTriplets(
+      Index               dim,
+      Index               n_entries,
+      const Index*        major,
+      const Index*        minor,
+      bool                symmetric,
+      std::vector<Index>& start,
+      std::vector<Index>& pos,
+      std::vector<Index>& minor_idx
+   );
    //@}
 
 private:
@@ -463,7 +463,7 @@ bool CGPenaltyLSAcceptor::TrySecondOrderCorrection(
       theta_soc_old = theta_trial;
       theta_soc_old2 = theta_trial2;
       Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
-                     "Trying second order correction number %d\n", count_soc + 1);
+                     "Trying second order correction number %" IPOPT_INDEX_FORMAT "\n", count_soc + 1);
       // Compute SOC constraint violation
       /*
        Number c_over_r = 0.;
@@ -513,7 +513,7 @@ bool CGPenaltyLSAcceptor::TrySecondOrderCorrection(
       if( accept )
       {
          Jnlst().Printf(J_DETAILED, J_LINE_SEARCH,
-                        "Second order correction step accepted with %d corrections.\n", count_soc + 1);
+                        "Second order correction step accepted with %" IPOPT_INDEX_FORMAT " corrections.\n", count_soc + 1);
          // Accept all SOC quantities
          alpha_primal = alpha_primal_soc;
          actual_delta = delta_soc;
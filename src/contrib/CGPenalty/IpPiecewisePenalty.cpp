@@ -215,7 +215,7 @@ void PiecewisePenalty::Print(
    jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
                 "The current piecewise penalty has %d entries.\n", PiecewisePenalty_list_.size());
    jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
-                "We only allow %d entries.\n", max_piece_number_);
+                "We only allow %" IPOPT_INDEX_FORMAT " entries.\n", max_piece_number_);
    jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
                 "The min piecewise penalty is %d .\n", min_piece_penalty_);
    if( !jnlst.ProduceOutput(J_DETAILED, J_LINE_SEARCH) )
@@ -233,7 +233,7 @@ void PiecewisePenalty::Print(
       }
       count++;
       jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
-                   "%5d ", count);
+                   "%5" IPOPT_INDEX_FORMAT " ", count);
       jnlst.Printf(J_DETAILED, J_LINE_SEARCH,
                    "%23.16e %23.16e  %23.16e \n", iter->pen_r, iter->barrier_obj, iter->infeasi);
    }